@@ -141,6 +141,16 @@ D3MFOpcPackage::D3MFOpcPackage(IOSystem *pIOHandler, const std::string &rFile) :
     std::vector<std::string> fileList;
     mZipArchive->getFileList(fileList);
 
+    // inflate the models and textures of the package up front, in parallel
+    std::vector<std::string> prefetchList;
+    for (const auto &file : fileList) {
+        if (file == D3MF::XmlTag::ROOT_RELATIONSHIPS_ARCHIVE || IsEmbeddedTexture(file) ||
+                BaseImporter::GetExtension(file) == "model") {
+            prefetchList.push_back(file);
+        }
+    }
+    mZipArchive->prefetchFiles(prefetchList);
+
     for (auto &file : fileList) {
         if (file == D3MF::XmlTag::ROOT_RELATIONSHIPS_ARCHIVE) {
             if (!mZipArchive->Exists(file.c_str())) {
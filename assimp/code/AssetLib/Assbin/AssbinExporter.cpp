@@ -47,20 +47,23 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssbinFileWriter.h"
 
+#include <assimp/config.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/IOSystem.hpp>
 
 namespace Assimp {
 
-void ExportSceneAssbin(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene, const ExportProperties * /*pProperties*/) {
+void ExportSceneAssbin(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene, const ExportProperties *pProperties) {
+    const bool mappable = pProperties && pProperties->GetPropertyBool(AI_CONFIG_EXPORT_ASSBIN_MAPPABLE, false);
     DumpSceneToAssbin(
             pFile,
             "\0", // no command(s).
             pIOSystem,
             pScene,
             false, // shortened?
-            false); // compressed?
+            false, // compressed?
+            mappable);
 }
 } // end of namespace Assimp
 
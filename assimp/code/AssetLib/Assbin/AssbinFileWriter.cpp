@@ -43,16 +43,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
 #include "AssbinFileWriter.h"
+#include "Common/ParallelFor.h"
 #include "Common/assbin_chunks.h"
 #include "PostProcessing/ProcessHelper.h"
 
+#include <assimp/AssbinMappedView.h>
 #include <assimp/Exceptional.h>
 #include <assimp/version.h>
 #include <assimp/IOStream.hpp>
 
 #include "zlib.h"
 
+#include <algorithm>
 #include <ctime>
+#include <vector>
 
 #if _MSC_VER
 #pragma warning(push)
@@ -327,6 +331,7 @@ class AssbinFileWriter {
 private:
     bool shortened;
     bool compressed;
+    bool mappable;
 
 protected:
     // -----------------------------------------------------------------------------------
@@ -688,8 +693,8 @@ protected:
         // write node graph
         WriteBinaryNode(&chunk, scene->mRootNode);
 
-        // write all meshes
-        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        // write all meshes, mappable files keep them in the mesh table
+        for (unsigned int i = 0; !mappable && i < scene->mNumMeshes; ++i) {
             const aiMesh *mesh = scene->mMeshes[i];
             WriteBinaryMesh(&chunk, mesh);
         }
@@ -725,14 +730,156 @@ protected:
         }
     }
 
+    // -----------------------------------------------------------------------------------
+    // Append data to a mappable file image at the next multiple of alignment,
+    // returns its file offset
+    static uint64_t AppendMapped(std::vector<uint8_t> &image, const void *data, size_t size,
+            size_t alignment = AI_ASSBIN_MAPPED_ALIGNMENT) {
+        if (0 == size) {
+            return 0;
+        }
+        const size_t offset = (image.size() + alignment - 1) / alignment * alignment;
+        image.resize(offset + size);
+        memcpy(&image[offset], data, size);
+        return offset;
+    }
+
+    // -----------------------------------------------------------------------------------
+    void WriteMappedMesh(std::vector<uint8_t> &image, uint64_t recordOffset, const aiMesh *mesh) {
+        AssbinMappedMesh record = {};
+        record.mPrimitiveTypes = mesh->mPrimitiveTypes;
+        record.mNumVertices = mesh->mNumVertices;
+        record.mNumFaces = mesh->mNumFaces;
+        record.mNumBones = mesh->mNumBones;
+        record.mMaterialIndex = mesh->mMaterialIndex;
+        record.mNameLength = mesh->mName.length;
+        record.mName = AppendMapped(image, mesh->mName.data, mesh->mName.length, 1);
+
+        const size_t vertexBytes = mesh->mNumVertices * sizeof(aiVector3D);
+        record.mVertices = AppendMapped(image, mesh->mVertices, mesh->mVertices ? vertexBytes : 0);
+        record.mNormals = AppendMapped(image, mesh->mNormals, mesh->mNormals ? vertexBytes : 0);
+        if (mesh->mTangents && mesh->mBitangents) {
+            record.mTangents = AppendMapped(image, mesh->mTangents, vertexBytes);
+            record.mBitangents = AppendMapped(image, mesh->mBitangents, vertexBytes);
+        }
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && mesh->mColors[n]; ++n) {
+            record.mColors[n] = AppendMapped(image, mesh->mColors[n], mesh->mNumVertices * sizeof(aiColor4D));
+        }
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && mesh->mTextureCoords[n]; ++n) {
+            record.mNumUVComponents[n] = mesh->mNumUVComponents[n];
+            record.mTextureCoords[n] = AppendMapped(image, mesh->mTextureCoords[n], vertexBytes);
+        }
+
+        // faces as one index buffer plus the offset of each face
+        if (mesh->mNumFaces) {
+            std::vector<uint32_t> offsets(mesh->mNumFaces + 1);
+            std::vector<uint32_t> indices;
+            for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+                const aiFace &f = mesh->mFaces[i];
+                offsets[i] = static_cast<uint32_t>(indices.size());
+                indices.insert(indices.end(), f.mIndices, f.mIndices + f.mNumIndices);
+            }
+            offsets[mesh->mNumFaces] = static_cast<uint32_t>(indices.size());
+            record.mNumIndices = static_cast<uint32_t>(indices.size());
+            record.mFaceOffsets = AppendMapped(image, offsets.data(), offsets.size() * sizeof(uint32_t));
+            record.mIndices = AppendMapped(image, indices.data(), indices.size() * sizeof(uint32_t));
+        }
+
+        if (mesh->mNumBones) {
+            std::vector<AssbinMappedBone> bones(mesh->mNumBones);
+            for (unsigned int a = 0; a < mesh->mNumBones; ++a) {
+                const aiBone *b = mesh->mBones[a];
+                AssbinMappedBone &bone = bones[a];
+                memset(&bone, 0, sizeof(bone));
+                memcpy(bone.mOffsetMatrix, &b->mOffsetMatrix, sizeof(bone.mOffsetMatrix));
+                bone.mNumWeights = b->mNumWeights;
+                bone.mNameLength = b->mName.length;
+                bone.mName = AppendMapped(image, b->mName.data, b->mName.length, 1);
+                bone.mWeights = AppendMapped(image, b->mWeights, b->mNumWeights * sizeof(aiVertexWeight));
+            }
+            record.mBones = AppendMapped(image, bones.data(), bones.size() * sizeof(AssbinMappedBone));
+        }
+
+        memcpy(&image[recordOffset], &record, sizeof(record));
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Write the part of a mappable file following the header: the table header,
+    // the mesh table, all mesh arrays and the scene chunk without meshes
+    void WriteMappedScene(IOStream *out, const aiScene *pScene) {
+#ifdef AI_BUILD_BIG_ENDIAN
+        (void)out;
+        (void)pScene;
+        throw DeadlyExportError("Mappable assbin files can only be written on little-endian hosts");
+#else
+        std::vector<uint8_t> image(AI_ASSBIN_MAPPED_TABLE_OFFSET + sizeof(AssbinMappedHeader));
+
+        AssbinMappedHeader header = {};
+        header.mMagic = AI_ASSBIN_MAPPED_MAGIC;
+        header.mRealSize = sizeof(ai_real);
+        header.mNumMeshes = pScene->mNumMeshes;
+
+        // reserve the mesh table, the records are filled in as the arrays are laid out
+        if (pScene->mNumMeshes) {
+            std::vector<uint8_t> table(pScene->mNumMeshes * sizeof(AssbinMappedMesh), 0);
+            header.mMeshTable = AppendMapped(image, table.data(), table.size());
+        }
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            WriteMappedMesh(image, header.mMeshTable + i * sizeof(AssbinMappedMesh), pScene->mMeshes[i]);
+        }
+
+        AssbinChunkWriter sceneStream(nullptr, 0);
+        WriteBinaryScene(&sceneStream, pScene);
+        header.mSceneChunkSize = sceneStream.Tell();
+        header.mSceneChunk = AppendMapped(image, sceneStream.GetBufferPointer(), sceneStream.Tell());
+
+        header.mFileSize = image.size();
+        memcpy(&image[AI_ASSBIN_MAPPED_TABLE_OFFSET], &header, sizeof(header));
+
+        out->Write(&image[ASSBIN_HEADER_LENGTH], 1, image.size() - ASSBIN_HEADER_LENGTH);
+#endif
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Deflate the serialized scene in independent chunks of ASSBIN_COMPRESSED_CHUNK_SIZE
+    // bytes, so both compression and decompression can use all cores
+    void WriteCompressedChunks(IOStream *out, const uint8_t *data, size_t size) {
+        const size_t numChunks = (size + ASSBIN_COMPRESSED_CHUNK_SIZE - 1) / ASSBIN_COMPRESSED_CHUNK_SIZE;
+        std::vector<std::vector<uint8_t>> chunks(numChunks);
+        ParallelFor(numChunks, [&](size_t i) {
+            const size_t begin = i * ASSBIN_COMPRESSED_CHUNK_SIZE;
+            const uLong chunkSize = static_cast<uLong>(std::min<size_t>(ASSBIN_COMPRESSED_CHUNK_SIZE, size - begin));
+            uLongf compressedSize = compressBound(chunkSize);
+            chunks[i].resize(compressedSize);
+            if (compress2(chunks[i].data(), &compressedSize, data + begin, chunkSize, 9) != Z_OK) {
+                throw DeadlyExportError("Compression failed.");
+            }
+            chunks[i].resize(compressedSize);
+        });
+
+        Write<uint32_t>(out, static_cast<uint32_t>(size));
+        Write<uint32_t>(out, static_cast<uint32_t>(numChunks));
+        for (size_t i = 0; i < numChunks; ++i) {
+            Write<uint32_t>(out, static_cast<uint32_t>(chunks[i].size()));
+            Write<uint32_t>(out, static_cast<uint32_t>(std::min<size_t>(ASSBIN_COMPRESSED_CHUNK_SIZE, size - i * ASSBIN_COMPRESSED_CHUNK_SIZE)));
+        }
+        for (const std::vector<uint8_t> &chunk : chunks) {
+            out->Write(chunk.data(), sizeof(char), chunk.size());
+        }
+    }
+
 public:
-    AssbinFileWriter(bool shortened, bool compressed) :
-            shortened(shortened), compressed(compressed) {
+    AssbinFileWriter(bool shortened, bool compressed, bool mappable) :
+            shortened(shortened), compressed(compressed && !mappable), mappable(mappable) {
     }
 
     // -----------------------------------------------------------------------------------
     // Write a binary model dump
     void WriteBinaryDump(const char *pFile, const char *cmd, IOSystem *pIOSystem, const aiScene *pScene) {
+        if (mappable && shortened) {
+            throw DeadlyExportError("Shortened assbin files cannot be mappable");
+        }
+
         IOStream *out = pIOSystem->Open(pFile, "wb");
         if (!out)
             throw std::runtime_error("Unable to open output file " + std::string(pFile) + '\n');
@@ -764,12 +911,12 @@ public:
             out->Write(s, 44, 1);
             // == 44 bytes
 
-            Write<unsigned int>(out, ASSBIN_VERSION_MAJOR);
+            Write<unsigned int>(out, mappable ? AI_ASSBIN_MAPPED_VERSION_MAJOR : ASSBIN_VERSION_MAJOR);
             Write<unsigned int>(out, ASSBIN_VERSION_MINOR);
             Write<unsigned int>(out, aiGetVersionRevision());
             Write<unsigned int>(out, aiGetCompileFlags());
             Write<uint16_t>(out, shortened);
-            Write<uint16_t>(out, compressed);
+            Write<uint16_t>(out, compressed ? ASSBIN_COMPRESSION_ZLIB_CHUNKED : ASSBIN_COMPRESSION_NONE);
             // ==  20 bytes
 
             char buff[256] = { 0 };
@@ -790,24 +937,12 @@ public:
 
             // Up to here the data is uncompressed. For compressed files, the rest
             // is compressed using standard DEFLATE from zlib.
-            if (compressed) {
+            if (mappable) {
+                WriteMappedScene(out, pScene);
+            } else if (compressed) {
                 AssbinChunkWriter uncompressedStream(nullptr, 0);
                 WriteBinaryScene(&uncompressedStream, pScene);
-
-                uLongf uncompressedSize = static_cast<uLongf>(uncompressedStream.Tell());
-                uLongf compressedSize = (uLongf)compressBound(uncompressedSize);
-                uint8_t *compressedBuffer = new uint8_t[compressedSize];
-
-                int res = compress2(compressedBuffer, &compressedSize, (const Bytef *)uncompressedStream.GetBufferPointer(), uncompressedSize, 9);
-                if (res != Z_OK) {
-                    delete[] compressedBuffer;
-                    throw DeadlyExportError("Compression failed.");
-                }
-
-                out->Write(&uncompressedSize, sizeof(uint32_t), 1);
-                out->Write(compressedBuffer, sizeof(char), compressedSize);
-
-                delete[] compressedBuffer;
+                WriteCompressedChunks(out, static_cast<const uint8_t *>(uncompressedStream.GetBufferPointer()), uncompressedStream.Tell());
             } else {
                 WriteBinaryScene(out, pScene);
             }
@@ -822,8 +957,8 @@ public:
 
 void DumpSceneToAssbin(
         const char *pFile, const char *cmd, IOSystem *pIOSystem,
-        const aiScene *pScene, bool shortened, bool compressed) {
-    AssbinFileWriter fileWriter(shortened, compressed);
+        const aiScene *pScene, bool shortened, bool compressed, bool mappable) {
+    AssbinFileWriter fileWriter(shortened, compressed, mappable);
     fileWriter.WriteBinaryDump(pFile, cmd, pIOSystem, pScene);
 }
 #if _MSC_VER
@@ -52,13 +52,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp {
 
+/** Writes a scene to an assbin file.
+ *  Mappable files (see AssbinMappedView.h) are never compressed or shortened. */
 void ASSIMP_API DumpSceneToAssbin(
         const char *pFile,
         const char *cmd,
         IOSystem *pIOSystem,
         const aiScene *pScene,
         bool shortened,
-        bool compressed);
+        bool compressed,
+        bool mappable = false);
 
 }
 
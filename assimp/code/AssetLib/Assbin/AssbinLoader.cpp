@@ -49,13 +49,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "AssbinLoader.h"
+#include "Common/ParallelFor.h"
 #include "Common/assbin_chunks.h"
+#include <assimp/AssbinMappedView.h>
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/anim.h>
 #include <assimp/importerdesc.h>
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
 #include <memory>
+#include <vector>
 
 #ifdef ASSIMP_BUILD_NO_OWN_ZLIB
 #include <zlib.h>
@@ -430,6 +433,93 @@ void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
     }
 }
 
+// -----------------------------------------------------------------------------------
+static aiString ReadMappedName(const AssbinMappedView &view, uint64_t offset, uint32_t length) {
+    if (length >= AI_MAXLEN) {
+        throw DeadlyImportError("Name exceeds the maximum string length");
+    }
+    aiString name;
+    if (length) {
+        name.Set(std::string(view.GetArray<char>(offset), length));
+    }
+    return name;
+}
+
+// -----------------------------------------------------------------------------------
+template <typename T>
+static T *CopyMappedArray(const AssbinMappedView &view, uint64_t offset, unsigned int count) {
+    const T *source = view.GetArray<T>(offset);
+    if (nullptr == source) {
+        return nullptr;
+    }
+    T *target = new T[count];
+    memcpy(target, source, count * sizeof(T));
+    return target;
+}
+
+// -----------------------------------------------------------------------------------
+void AssbinImporter::ReadMappedMesh(const AssbinMappedView &view, const AssbinMappedMesh &in, aiMesh *mesh) {
+    mesh->mPrimitiveTypes = in.mPrimitiveTypes;
+    mesh->mNumVertices = in.mNumVertices;
+    mesh->mNumFaces = in.mNumFaces;
+    mesh->mNumBones = in.mNumBones;
+    mesh->mMaterialIndex = in.mMaterialIndex;
+    mesh->mName = ReadMappedName(view, in.mName, in.mNameLength);
+
+    // the arrays have the in-memory layout already, so every one is a single copy
+    mesh->mVertices = CopyMappedArray<aiVector3D>(view, in.mVertices, in.mNumVertices);
+    mesh->mNormals = CopyMappedArray<aiVector3D>(view, in.mNormals, in.mNumVertices);
+    mesh->mTangents = CopyMappedArray<aiVector3D>(view, in.mTangents, in.mNumVertices);
+    mesh->mBitangents = CopyMappedArray<aiVector3D>(view, in.mBitangents, in.mNumVertices);
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS; ++n) {
+        mesh->mColors[n] = CopyMappedArray<aiColor4D>(view, in.mColors[n], in.mNumVertices);
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+        mesh->mNumUVComponents[n] = in.mNumUVComponents[n];
+        mesh->mTextureCoords[n] = CopyMappedArray<aiVector3D>(view, in.mTextureCoords[n], in.mNumVertices);
+    }
+
+    if (in.mNumFaces) {
+        const uint32_t *offsets = view.GetArray<uint32_t>(in.mFaceOffsets);
+        const uint32_t *indices = view.GetArray<uint32_t>(in.mIndices);
+        // check all offsets and indices before the first face is allocated
+        if (offsets[0] != 0 || offsets[in.mNumFaces] != in.mNumIndices) {
+            throw DeadlyImportError("Face offsets do not span the index buffer");
+        }
+        for (unsigned int i = 0; i < in.mNumFaces; ++i) {
+            if (offsets[i + 1] < offsets[i] || offsets[i + 1] > in.mNumIndices) {
+                throw DeadlyImportError("Face offsets are not monotonic");
+            }
+        }
+        for (unsigned int i = 0; i < in.mNumIndices; ++i) {
+            if (indices[i] >= in.mNumVertices) {
+                throw DeadlyImportError("Face index out of range");
+            }
+        }
+
+        mesh->mFaces = new aiFace[in.mNumFaces];
+        for (unsigned int i = 0; i < in.mNumFaces; ++i) {
+            aiFace &f = mesh->mFaces[i];
+            f.mNumIndices = offsets[i + 1] - offsets[i];
+            f.mIndices = new unsigned int[f.mNumIndices];
+            memcpy(f.mIndices, indices + offsets[i], f.mNumIndices * sizeof(unsigned int));
+        }
+    }
+
+    if (in.mNumBones) {
+        const AssbinMappedBone *bones = view.GetBones(in);
+        mesh->mBones = new C_STRUCT aiBone *[in.mNumBones];
+        memset(mesh->mBones, 0, in.mNumBones * sizeof(aiBone *));
+        for (unsigned int a = 0; a < in.mNumBones; ++a) {
+            aiBone *b = mesh->mBones[a] = new aiBone();
+            b->mName = ReadMappedName(view, bones[a].mName, bones[a].mNameLength);
+            b->mNumWeights = bones[a].mNumWeights;
+            memcpy(&b->mOffsetMatrix, bones[a].mOffsetMatrix, sizeof(b->mOffsetMatrix));
+            b->mWeights = CopyMappedArray<aiVertexWeight>(view, bones[a].mWeights, bones[a].mNumWeights);
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------------
 void AssbinImporter::ReadBinaryMaterialProperty(IOStream *stream, aiMaterialProperty *prop) {
     if (Read<uint32_t>(stream) != ASSBIN_CHUNK_AIMATERIALPROPERTY)
@@ -614,13 +704,15 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
     //scene->mRootNode = new aiNode[1];
     ReadBinaryNode(stream, &scene->mRootNode, (aiNode *)nullptr);
 
-    // Read all meshes
+    // Read all meshes, mappable files store them outside of the scene chunk
     if (scene->mNumMeshes) {
         scene->mMeshes = new aiMesh *[scene->mNumMeshes];
         memset(scene->mMeshes, 0, scene->mNumMeshes * sizeof(aiMesh *));
         for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
             scene->mMeshes[i] = new aiMesh();
-            ReadBinaryMesh(stream, scene->mMeshes[i]);
+            if (!mappable) {
+                ReadBinaryMesh(stream, scene->mMeshes[i]);
+            }
         }
     }
 
@@ -675,6 +767,67 @@ void AssbinImporter::ReadBinaryScene(IOStream *stream, aiScene *scene) {
     }
 }
 
+// -----------------------------------------------------------------------------------
+std::unique_ptr<uint8_t[]> AssbinImporter::ReadCompressedChunks(IOStream *stream, size_t &uncompressedSize) {
+    uncompressedSize = Read<uint32_t>(stream);
+    const uint32_t numChunks = Read<uint32_t>(stream);
+
+    struct Chunk {
+        size_t compressedSize;
+        size_t uncompressedSize;
+        size_t offset; // into the uncompressed data
+    };
+    const size_t available = stream->FileSize() - stream->Tell();
+    if (numChunks > available / (2 * sizeof(uint32_t))) {
+        throw DeadlyImportError("Invalid compressed chunk table.");
+    }
+    std::vector<Chunk> chunks(numChunks);
+    size_t compressedTotal = 0, uncompressedTotal = 0;
+    for (Chunk &chunk : chunks) {
+        chunk.compressedSize = Read<uint32_t>(stream);
+        chunk.uncompressedSize = Read<uint32_t>(stream);
+        chunk.offset = uncompressedTotal;
+        compressedTotal += chunk.compressedSize;
+        uncompressedTotal += chunk.uncompressedSize;
+    }
+    if (uncompressedTotal != uncompressedSize || compressedTotal > stream->FileSize() - stream->Tell()) {
+        throw DeadlyImportError("Invalid compressed chunk table.");
+    }
+
+    // Inflate a batch of chunks at a time, so only a slice of the compressed
+    // data is held next to the uncompressed scene
+    static constexpr size_t BatchSize = 16 * ASSBIN_COMPRESSED_CHUNK_SIZE;
+    std::unique_ptr<uint8_t[]> uncompressedData(new uint8_t[uncompressedSize]);
+    std::vector<uint8_t> batch;
+    std::vector<size_t> batchOffsets;
+    for (size_t first = 0; first < chunks.size();) {
+        size_t last = first;
+        batchOffsets.clear();
+        size_t batchSize = 0;
+        do {
+            batchOffsets.push_back(batchSize);
+            batchSize += chunks[last++].compressedSize;
+        } while (last < chunks.size() && batchSize + chunks[last].compressedSize <= BatchSize);
+
+        batch.resize(batchSize);
+        if (stream->Read(batch.data(), 1, batchSize) != batchSize) {
+            throw DeadlyImportError("Unexpected end of compressed data.");
+        }
+
+        ParallelFor(last - first, [&](size_t i) {
+            const Chunk &chunk = chunks[first + i];
+            uLongf size = static_cast<uLongf>(chunk.uncompressedSize);
+            const int res = uncompress(uncompressedData.get() + chunk.offset, &size,
+                    batch.data() + batchOffsets[i], static_cast<uLong>(chunk.compressedSize));
+            if (res != Z_OK || size != chunk.uncompressedSize) {
+                throw DeadlyImportError("Zlib decompression failed.");
+            }
+        });
+        first = last;
+    }
+    return uncompressedData;
+}
+
 // -----------------------------------------------------------------------------------
 void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSystem *pIOHandler) {
     IOStream *stream = pIOHandler->Open(pFile, "rb");
@@ -687,7 +840,8 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
 
     unsigned int versionMajor = Read<unsigned int>(stream);
     unsigned int versionMinor = Read<unsigned int>(stream);
-    if (versionMinor != ASSBIN_VERSION_MINOR || versionMajor != ASSBIN_VERSION_MAJOR) {
+    mappable = versionMajor == AI_ASSBIN_MAPPED_VERSION_MAJOR;
+    if (versionMinor > ASSBIN_VERSION_MINOR || (versionMajor != ASSBIN_VERSION_MAJOR && !mappable)) {
         pIOHandler->Close(stream);
         throw DeadlyImportError("Invalid version, data format not compatible!");
     }
@@ -696,7 +850,14 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
     /*unsigned int compileFlags =*/Read<unsigned int>(stream);
 
     shortened = Read<uint16_t>(stream) > 0;
-    compressed = Read<uint16_t>(stream) > 0;
+    const uint16_t compression = Read<uint16_t>(stream);
+    compressed = compression != ASSBIN_COMPRESSION_NONE;
+
+    // chunked compression came with minor version 1
+    if (compression > ASSBIN_COMPRESSION_ZLIB_CHUNKED || (compression == ASSBIN_COMPRESSION_ZLIB_CHUNKED && versionMinor < 1)) {
+        pIOHandler->Close(stream);
+        throw DeadlyImportError("ASSBIN: Unknown compression method ", compression);
+    }
 
     if (shortened) {
         pIOHandler->Close(stream);
@@ -707,7 +868,44 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
     stream->Seek(128, aiOrigin_CUR); // options
     stream->Seek(64, aiOrigin_CUR); // padding
 
-    if (compressed) {
+    if (mappable) {
+        // IOSystem offers no mapping, so read the whole file at once and take
+        // the mesh arrays from it with one copy each
+        const size_t fileSize = stream->FileSize();
+        std::unique_ptr<uint8_t[]> data(new uint8_t[fileSize]);
+        stream->Seek(0, aiOrigin_SET);
+        const size_t len = stream->Read(data.get(), 1, fileSize);
+        pIOHandler->Close(stream);
+
+        AssbinMappedView view;
+        if (len != fileSize || !view.Open(data.get(), fileSize)) {
+            throw DeadlyImportError("ASSBIN: Invalid mappable file ", pFile);
+        }
+
+        MemoryIOStream io(view.GetSceneChunk(), view.GetSceneChunkSize());
+        ReadBinaryScene(&io, pScene);
+        if (pScene->mNumMeshes != view.GetNumMeshes()) {
+            throw DeadlyImportError("ASSBIN: Mesh table does not match the scene");
+        }
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            ReadMappedMesh(view, view.GetMesh(i), pScene->mMeshes[i]);
+        }
+        return;
+    }
+
+    if (compression == ASSBIN_COMPRESSION_ZLIB_CHUNKED) {
+        std::unique_ptr<uint8_t[]> uncompressedData;
+        size_t uncompressedSize = 0;
+        try {
+            uncompressedData = ReadCompressedChunks(stream, uncompressedSize);
+        } catch (...) {
+            pIOHandler->Close(stream);
+            throw;
+        }
+
+        MemoryIOStream io(uncompressedData.get(), uncompressedSize);
+        ReadBinaryScene(&io, pScene);
+    } else if (compressed) {
         uLongf uncompressedSize = Read<uint32_t>(stream);
         uLongf compressedSize = static_cast<uLongf>(stream->FileSize() - stream->Tell());
 
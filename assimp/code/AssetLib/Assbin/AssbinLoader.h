@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_ASSBINIMPORTER_H_INC
 
 #include <assimp/BaseImporter.h>
+#include <memory>
 
 struct aiMesh;
 struct aiNode;
@@ -62,6 +63,9 @@ struct aiCamera;
 
 namespace Assimp {
 
+class AssbinMappedView;
+struct AssbinMappedMesh;
+
 // ---------------------------------------------------------------------------------
 /** Importer class for 3D Studio r3 and r4 3DS files
  */
@@ -70,6 +74,7 @@ class AssbinImporter : public BaseImporter
 private:
     bool shortened;
     bool compressed;
+    bool mappable;
 
 public:
     bool CanRead(const std::string& pFile,
@@ -78,9 +83,11 @@ public:
     void InternReadFile(
     const std::string& pFile,aiScene* pScene,IOSystem* pIOHandler) override;
     void ReadHeader();
+    std::unique_ptr<uint8_t[]> ReadCompressedChunks( IOStream * stream, size_t& uncompressedSize );
     void ReadBinaryScene( IOStream * stream, aiScene* pScene );
     void ReadBinaryNode( IOStream * stream, aiNode** mRootNode, aiNode* parent );
     void ReadBinaryMesh( IOStream * stream, aiMesh* mesh );
+    void ReadMappedMesh( const AssbinMappedView& view, const AssbinMappedMesh& in, aiMesh* mesh );
     void ReadBinaryBone( IOStream * stream, aiBone* bone );
     void ReadBinaryMaterial(IOStream * stream, aiMaterial* mat);
     void ReadBinaryMaterialProperty(IOStream * stream, aiMaterialProperty* prop);
@@ -154,11 +154,12 @@ void ColladaLoader::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     mAnims.clear();
 
     // parse the input file
-    ColladaParser parser(pIOHandler, pFile);
+    ColladaParser parser(pIOHandler, pFile, m_cancel);
 
     if (!parser.mRootNode) {
         throw DeadlyImportError("Collada: File came out empty. Something is wrong here.");
     }
+    CheckCancel();
 
     // reserve some storage to avoid unnecessary reallocates
     newMats.reserve(parser.mMaterialLibrary.size() * 2u);
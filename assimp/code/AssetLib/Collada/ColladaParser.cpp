@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_COLLADA_IMPORTER
 
 #include "ColladaParser.h"
+#include "Common/CancelToken.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/StringUtils.h>
 #include <assimp/ZipArchiveIOSystem.h>
@@ -411,12 +412,13 @@ static void ReadCamera(XmlNode &node, Camera &camera) {
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
-ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
+ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile, const CancelToken *cancel) :
         mFileName(pFile),
         mRootNode(nullptr),
         mUnitSize(1.0f),
         mUpDirection(UP_Y),
-        mFormat(FV_1_5_n) {
+        mFormat(FV_1_5_n),
+        mCancel(cancel) {
     if (nullptr == pIOHandler) {
         throw DeadlyImportError("IOSystem is nullptr.");
     }
@@ -1360,6 +1362,10 @@ void ColladaParser::ReadGeometryLibrary(XmlNode &node) {
     for (XmlNode &currentNode : node.children()) {
         const std::string &currentName = currentNode.name();
         if (currentName == "geometry") {
+            if (nullptr != mCancel) {
+                mCancel->Check();
+            }
+
             // read ID. Another entry which is "optional" by design but obligatory in reality
 
             std::string id;
@@ -56,6 +56,7 @@
 namespace Assimp {
 
 class ZipArchiveIOSystem;
+class CancelToken;
 
 // ------------------------------------------------------------------------------------------
 /** Parser helper class for the Collada loader.
@@ -70,8 +71,8 @@ public:
     /// Map for generic metadata as aiString.
     using StringMetaData = std::map<std::string, aiString>;
 
-    /// Constructor from XML file.
-    ColladaParser(IOSystem *pIOHandler, const std::string &pFile);
+    /// Constructor from XML file, the optional token aborts the reading.
+    ColladaParser(IOSystem *pIOHandler, const std::string &pFile, const CancelToken *cancel = nullptr);
 
     /// Destructor
     ~ColladaParser();
@@ -301,6 +302,9 @@ private:
 
     /// Collada file format version
     Collada::FormatVersion mFormat;
+
+    /// Cancellation state of the running import, may be nullptr
+    const CancelToken *mCancel;
 };
 
 // ------------------------------------------------------------------------------------------------
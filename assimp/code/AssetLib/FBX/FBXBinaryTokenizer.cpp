@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXTokenizer.h"
 #include "FBXUtil.h"
+#include "Common/CancelToken.h"
 #include <assimp/defs.h>
 #include <stdint.h>
 #include <cstdint>
@@ -302,7 +303,10 @@ void ReadData(const char*& sbegin_out, const char*& send_out, const char* input,
 
 
 // ------------------------------------------------------------------------------------------------
-bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const char *input, const char *&cursor, const char *end, bool const is64bits) {
+bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const char *input, const char *&cursor, const char *end,
+        bool const is64bits, const CancelToken *cancel) {
+    const size_t begin_offset = Offset(input, cursor);
+
     // the first word contains the offset at which this block ends
 	const uint64_t end_offset = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
 
@@ -354,6 +358,11 @@ bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const
         TokenizeError("property length not reached, something is wrong",input, cursor);
     }
 
+    // look at the cancel token whenever the scope header crossed a check interval
+    if (nullptr != cancel && begin_offset / CancelToken::CheckInterval != Offset(input, cursor) / CancelToken::CheckInterval) {
+        cancel->Check();
+    }
+
     // at the end of each nested block, there is a NUL record to indicate
     // that the sub-scope exists (i.e. to distinguish between P: and P : {})
     // this NUL record is 13 bytes long on 32 bit version and 25 bytes long on 64 bit.
@@ -368,7 +377,7 @@ bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const
 
         // XXX this is vulnerable to stack overflowing ..
         while(Offset(input, cursor) < end_offset - sentinel_block_length) {
-            ReadScope(output_tokens, token_allocator, input, cursor, input + end_offset - sentinel_block_length, is64bits);
+            ReadScope(output_tokens, token_allocator, input, cursor, input + end_offset - sentinel_block_length, is64bits, cancel);
         }
         output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_CLOSE_BRACKET, Offset(input, cursor) ));
 
@@ -391,7 +400,7 @@ bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const
 
 // ------------------------------------------------------------------------------------------------
 // TODO: Test FBX Binary files newer than the 7500 version to check if the 64 bits address behaviour is consistent
-void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &token_allocator) {
+void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &token_allocator, const CancelToken *cancel) {
 	ai_assert(input);
 	ASSIMP_LOG_DEBUG("Tokenizing binary FBX file");
 
@@ -424,7 +433,7 @@ void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length,
     try
     {
         while (cursor < end ) {
-            if (!ReadScope(output_tokens, token_allocator, input, cursor, input + length, is64bits)) {
+            if (!ReadScope(output_tokens, token_allocator, input, cursor, input + length, is64bits, cancel)) {
                 break;
             }
         }
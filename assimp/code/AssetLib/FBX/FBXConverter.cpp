@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXParser.h"
 #include "FBXProperties.h"
 #include "FBXUtil.h"
+#include "Common/CancelToken.h"
 
 #include <assimp/MathFunctions.h>
 #include <assimp/StringComparison.h>
@@ -123,7 +124,7 @@ static void correctRootTransform(const aiScene *scene) {
     scene->mRootNode->mTransformation *= mat;
 }
 
-FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones) :
+FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones, const CancelToken *cancel) :
         defaultMaterialIndex(),
         mMeshes(),
         lights(),
@@ -137,7 +138,8 @@ FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBo
         anim_fps(),
         mSceneOut(out),
         doc(doc),
-        mRemoveEmptyBones(removeEmptyBones) {
+        mRemoveEmptyBones(removeEmptyBones),
+        mCancel(cancel) {
 
 
     // animations need to be converted first since this will
@@ -276,6 +278,9 @@ void FBXConverter::ConvertNodes(uint64_t id, aiNode *parent, aiNode *root_node,
         const Model *const model = dynamic_cast<const Model *>(object);
 
         if (nullptr != model) {
+            if (nullptr != mCancel) {
+                mCancel->Check();
+            }
             nodes_chain.clear();
             post_nodes_chain.clear();
             aiMatrix4x4 new_abs_transform = parent_transform;
@@ -973,6 +978,9 @@ void FBXConverter::ConvertModel(const Model &model, aiNode *parent, aiNode *root
         const MeshGeometry *const mesh = dynamic_cast<const MeshGeometry *>(geo);
         const LineGeometry *const line = dynamic_cast<const LineGeometry *>(geo);
         if (mesh) {
+            if (nullptr != mCancel) {
+                mCancel->Check();
+            }
             const std::vector<unsigned int> &indices = ConvertMesh(*mesh, model, parent, root_node, absolute_transform);
             std::copy(indices.begin(), indices.end(), std::back_inserter(meshes));
         } else if (line) {
@@ -3808,8 +3816,8 @@ void FBXConverter::ConvertOrphanedEmbeddedTextures() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones) {
-    FBXConverter converter(out, doc, removeEmptyBones);
+void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones, const CancelToken *cancel) {
+    FBXConverter converter(out, doc, removeEmptyBones, cancel);
 }
 
 } // namespace FBX
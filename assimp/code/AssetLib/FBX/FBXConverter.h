@@ -72,6 +72,9 @@ struct morphKeyData {
 using morphAnimData = std::map<int64_t, morphKeyData*> ;
 
 namespace Assimp {
+
+class CancelToken;
+
 namespace FBX {
 
 class MeshGeometry;
@@ -91,8 +94,9 @@ class Document;
  *  @param out Empty scene to be populated
  *  @param doc Parsed FBX document
  *  @param removeEmptyBones Will remove bones, which do not have any references to vertices.
+ *  @param cancel Cancellation state of the import, checked per model and mesh. May be nullptr.
  */
-void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones);
+void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones, const CancelToken *cancel = nullptr);
 
 /** Dummy class to encapsulate the conversion process */
 class FBXConverter {
@@ -123,7 +127,7 @@ public:
     };
 
 public:
-    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones);
+    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones, const CancelToken *cancel = nullptr);
     ~FBXConverter();
 
 private:
@@ -465,6 +469,7 @@ private:
     aiScene* const mSceneOut;
     const FBX::Document& doc;
     bool mRemoveEmptyBones;
+    const CancelToken *mCancel;
     static void BuildBoneList(aiNode *current_node, const aiNode *root_node, const aiScene *scene,
                              std::vector<aiBone*>& bones);
 
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXExportProperty.h"
 #include "FBXCommon.h"
 #include "FBXUtil.h"
+#include "Common/SceneIndex.h"
 
 #include <assimp/version.h> // aiGetVersion
 #include <assimp/IOSystem.hpp>
@@ -1095,6 +1096,9 @@ void FBXExporter::WriteObjects () {
     object_node.EndProperties(outstream, binary, indent);
     object_node.BeginChildren(outstream, binary, indent);
 
+    // bones and animation channels refer to nodes by name
+    SceneIndex sceneIndex(mScene);
+
     bool bJoinIdenticalVertices = mProperties->GetPropertyBool("bJoinIdenticalVertices", true);
     // save vertex_indices as it is needed later
     std::vector<std::vector<int32_t>> vVertexIndice(mScene->mNumMeshes);
@@ -1928,7 +1932,7 @@ void FBXExporter::WriteObjects () {
             if (elem != node_by_bone.end()) {
                 n = elem->second;
             } else {
-                n = mScene->mRootNode->FindNode(b->mName);
+                n = sceneIndex.FindNode(b->mName);
                 if (!n) {
                     // this should never happen
                     std::stringstream err;
@@ -2379,7 +2383,7 @@ void FBXExporter::WriteObjects () {
         for (size_t nai = 0; nai < anim->mNumChannels; ++nai) {
             const aiNodeAnim* na = anim->mChannels[nai];
             // get the corresponding aiNode
-            const aiNode* node = mScene->mRootNode->FindNode(na->mNodeName);
+            const aiNode* node = sceneIndex.FindNode(na->mNodeName);
             // and its transform
             const aiMatrix4x4 node_xfm = get_world_transform(node, mScene);
             aiVector3D T, R, S;
@@ -2423,7 +2427,7 @@ void FBXExporter::WriteObjects () {
         for (size_t nai = 0; nai < anim->mNumChannels; ++nai) {
             const aiNodeAnim* na = anim->mChannels[nai];
             // get the corresponding aiNode
-            const aiNode* node = mScene->mRootNode->FindNode(na->mNodeName);
+            const aiNode* node = sceneIndex.FindNode(na->mNodeName);
             // and its transform
             const aiMatrix4x4 node_xfm = get_world_transform(node, mScene);
             aiVector3D T, R, S;
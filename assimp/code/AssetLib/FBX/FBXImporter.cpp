@@ -153,20 +153,23 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 		bool is_binary = false;
 		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
 			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+            TokenizeBinary(tokens, begin, contents.size(), tempAllocator, m_cancel);
 		} else {
-            Tokenize(tokens, begin, tempAllocator);
+            Tokenize(tokens, begin, tempAllocator, m_cancel);
 		}
+		CheckCancel();
 
 		// use this information to construct a very rudimentary
 		// parse-tree representing the FBX scope structure
         Parser parser(tokens, tempAllocator, is_binary);
+		CheckCancel();
 
 		// take the raw parse-tree and convert it to a FBX DOM
 		Document doc(parser, mSettings);
+		CheckCancel();
 
 		// convert the FBX DOM to aiScene
-		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones, m_cancel);
 
 		// size relative to cm
 		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
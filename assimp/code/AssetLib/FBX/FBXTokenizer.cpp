@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXTokenizer.h"
 #include "FBXUtil.h"
+#include "Common/CancelToken.h"
 #include <assimp/Exceptional.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -131,7 +132,7 @@ void ProcessDataToken(TokenList &output_tokens, StackAllocator &token_allocator,
 }
 
 // ------------------------------------------------------------------------------------------------
-void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token_allocator) {
+void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token_allocator, const CancelToken *cancel) {
 	ai_assert(input);
 	ASSIMP_LOG_DEBUG("Tokenizing ASCII FBX file");
 
@@ -146,6 +147,9 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
     const char *token_begin = nullptr, *token_end = nullptr;
     for (const char* cur = input;*cur;column += (*cur == '\t' ? ASSIMP_FBX_TAB_WIDTH : 1), ++cur) {
         const char c = *cur;
+        if (nullptr != cancel) {
+            cancel->Check(static_cast<size_t>(cur - input));
+        }
 
         if (IsLineEnd(c)) {
             comment = false;
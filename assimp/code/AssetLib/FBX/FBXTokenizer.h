@@ -53,6 +53,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 
 namespace Assimp {
+
+class CancelToken;
+
 namespace FBX {
 
 /** Rough classification for text FBX tokens used for constructing the
@@ -167,8 +170,9 @@ typedef std::vector< TokenPtr > TokenList;
  *
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Textual input buffer to be processed, 0-terminated.
+ * @param cancel Cancellation state of the import, checked every few kilobytes. May be nullptr.
  * @throw DeadlyImportError if something goes wrong */
-void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &tokenAllocator);
+void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &tokenAllocator, const CancelToken *cancel = nullptr);
 
 
 /** Tokenizer function for binary FBX files.
@@ -178,8 +182,9 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Binary input buffer to be processed.
  * @param length Length of input buffer, in bytes. There is no 0-terminal.
+ * @param cancel Cancellation state of the import, checked every few kilobytes. May be nullptr.
  * @throw DeadlyImportError if something goes wrong */
-void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &tokenAllocator);
+void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &tokenAllocator, const CancelToken *cancel = nullptr);
 
 
 } // ! FBX
@@ -260,7 +260,10 @@ void IFCImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         ThrowException("missing IfcProject entity");
     }
 
+    CheckCancel();
+
     ConversionData conv(*db, proj->To<Schema_2x3::IfcProject>(), pScene, settings);
+    conv.cancel = m_cancel;
     SetUnits(conv);
     SetCoordinateSpace(conv);
     ProcessSpatialStructures(conv);
@@ -628,6 +631,9 @@ void ProcessMetadata(uint64_t relDefinesByPropertiesID, ConversionData &conv, Me
 aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el, ConversionData &conv,
         std::vector<TempOpening> *collect_openings = nullptr) {
     const STEP::DB::RefMap &refs = conv.db.GetRefs();
+    if (nullptr != conv.cancel) {
+        conv.cancel->Check();
+    }
 
     // skip over space and annotation nodes - usually, these have no meaning in Assimp's context
     bool skipGeometry = false;
@@ -813,6 +819,7 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
     } catch (...) {
         // it hurts, but I don't want to pull boost::ptr_vector into -noboost only for these few spots here
         std::for_each(subnodes.begin(), subnodes.end(), delete_fun<aiNode>());
+        delete nd;
         throw;
     }
 
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IFCReaderGen_2x3.h"
 #include "IFCLoader.h"
 #include "AssetLib/Step/STEPFile.h"
+#include "Common/CancelToken.h"
 
 #include <assimp/mesh.h>
 #include <assimp/material.h>
@@ -178,6 +179,7 @@ struct ConversionData
         , settings(settings)
         , apply_openings()
         , collect_openings()
+        , cancel()
     {}
 
     ~ConversionData() {
@@ -221,6 +223,9 @@ struct ConversionData
     std::vector<TempOpening>* collect_openings;
 
     std::set<uint64_t> already_processed;
+
+    // Cancellation state of the running import, may be nullptr
+    const CancelToken* cancel;
 };
 
 
@@ -53,35 +53,22 @@ namespace Assimp {
 namespace ObjFile {
 
 struct Object;
-struct Face;
 struct Material;
 
 // ------------------------------------------------------------------------------------------------
-//! \struct Face
-//! \brief  Data structure for a simple obj-face, describes discredit,l.ation and materials
+//! \struct FaceIndex
+//! \brief  Indices of one corner of an obj-face, one v/vt/vn triplet
 // ------------------------------------------------------------------------------------------------
-struct Face {
-    using IndexArray = std::vector<unsigned int>;
-
-    //! Primitive type
-    aiPrimitiveType mPrimitiveType;
-    //! Vertex indices
-    IndexArray m_vertices;
-    //! Normal indices
-    IndexArray m_normals;
-    //! Texture coordinates indices
-    IndexArray m_texturCoords;
-    //! Pointer to assigned material
-    Material *m_pMaterial;
-
-    //! \brief  Default constructor
-    Face(aiPrimitiveType pt = aiPrimitiveType_POLYGON) :
-            mPrimitiveType(pt), m_vertices(), m_normals(), m_texturCoords(), m_pMaterial(nullptr) {
-        // empty
-    }
-
-    //! \brief  Destructor
-    ~Face() = default;
+struct FaceIndex {
+    //! Marks a missing texture coordinate or normal index
+    static const unsigned int NoIndex = ~0u;
+
+    //! Vertex index
+    unsigned int m_vertex;
+    //! Texture coordinate index or NoIndex
+    unsigned int m_texturCoord;
+    //! Normal index or NoIndex
+    unsigned int m_normal;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -231,8 +218,13 @@ struct Mesh {
     static const unsigned int NoMaterial = ~0u;
     /// The name for the mesh
     std::string m_name;
-    /// Array with pointer to all stored faces
-    std::vector<Face*> m_Faces;
+    /// Primitive type of each face
+    std::vector<aiPrimitiveType> m_FaceTypes;
+    /// Face i uses the corners m_FaceOffsets[i] up to m_FaceOffsets[i+1],
+    /// there is one more offset than faces
+    std::vector<unsigned int> m_FaceOffsets;
+    /// Index triplets of the corners of all faces
+    std::vector<FaceIndex> m_FaceIndices;
     /// Assigned material
     Material *m_pMaterial;
     /// Number of stored indices.
@@ -247,6 +239,7 @@ struct Mesh {
     /// Constructor
     explicit Mesh(const std::string &name) :
             m_name(name),
+            m_FaceOffsets(1, 0u),
             m_pMaterial(nullptr),
             m_uiNumIndices(0),
             m_uiMaterialIndex(NoMaterial),
@@ -255,11 +248,28 @@ struct Mesh {
     }
 
     /// Destructor
-    ~Mesh() {
-        for (std::vector<Face *>::iterator it = m_Faces.begin();
-                it != m_Faces.end(); ++it) {
-            delete *it;
-        }
+    ~Mesh() = default;
+
+    /// Returns the number of stored faces
+    size_t getNumFaces() const {
+        return m_FaceTypes.size();
+    }
+
+    /// Returns the number of corners of a face
+    unsigned int getNumFaceIndices(size_t face) const {
+        return m_FaceOffsets[face + 1] - m_FaceOffsets[face];
+    }
+
+    /// Returns the first corner of a face
+    const FaceIndex *getFaceIndices(size_t face) const {
+        return m_FaceIndices.data() + m_FaceOffsets[face];
+    }
+
+    /// Appends a face with the given corners
+    void addFace(aiPrimitiveType type, const std::vector<FaceIndex> &indices) {
+        m_FaceTypes.push_back(type);
+        m_FaceIndices.insert(m_FaceIndices.end(), indices.begin(), indices.end());
+        m_FaceOffsets.push_back(static_cast<unsigned int>(m_FaceIndices.size()));
     }
 };
 
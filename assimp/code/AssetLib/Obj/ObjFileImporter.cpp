@@ -144,7 +144,7 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file, m_cancel);
 
     // And create the proper return structures out of it
     CreateDataFromImport(parser.GetModel(), pScene);
@@ -272,11 +272,13 @@ aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile
     appendChildToParentNode(pParent, pNode);
 
     for (size_t i = 0; i < pObject->m_Meshes.size(); ++i) {
+        CheckCancel();
         unsigned int meshId = pObject->m_Meshes[i];
         std::unique_ptr<aiMesh> pMesh = createTopology(pModel, pObject, meshId);
         if (pMesh != nullptr) {
             if (pMesh->mNumFaces > 0) {
                 MeshArray.push_back(std::move(pMesh));
+                MeshFinished(MeshArray.back().get(), static_cast<unsigned int>(MeshArray.size() - 1));
             }
         }
     }
@@ -319,7 +321,7 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         return nullptr;
     }
 
-    if (pObjMesh->m_Faces.empty()) {
+    if (pObjMesh->getNumFaces() == 0) {
         return nullptr;
     }
 
@@ -328,21 +330,19 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         pMesh->mName.Set(pObjMesh->m_name);
     }
 
-    for (size_t index = 0; index < pObjMesh->m_Faces.size(); index++) {
-        const ObjFile::Face *inp = pObjMesh->m_Faces[index];
-        if (inp == nullptr) {
-            continue;
-        }
-
-        if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size() - 1);
+    const size_t numObjFaces = pObjMesh->getNumFaces();
+    for (size_t index = 0; index < numObjFaces; index++) {
+        const aiPrimitiveType type = pObjMesh->m_FaceTypes[index];
+        const unsigned int numIndices = pObjMesh->getNumFaceIndices(index);
+        if (type == aiPrimitiveType_LINE) {
+            pMesh->mNumFaces += numIndices - 1;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
-        } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size());
+        } else if (type == aiPrimitiveType_POINT) {
+            pMesh->mNumFaces += numIndices;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
         } else {
             ++pMesh->mNumFaces;
-            if (inp->m_vertices.size() > 3) {
+            if (numIndices > 3) {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
             } else {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
@@ -360,17 +360,18 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         unsigned int outIndex = 0u;
 
         // Copy all data from all stored meshes
-        for (auto &face : pObjMesh->m_Faces) {
-            const ObjFile::Face *inp = face;
-            if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
-                for (size_t i = 0; i < inp->m_vertices.size() - 1; ++i) {
+        for (size_t index = 0; index < numObjFaces; index++) {
+            const aiPrimitiveType type = pObjMesh->m_FaceTypes[index];
+            const unsigned int uiNumIndices = pObjMesh->getNumFaceIndices(index);
+            if (type == aiPrimitiveType_LINE) {
+                for (size_t i = 0; i < uiNumIndices - 1; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 2;
                     f.mIndices = new unsigned int[2];
                 }
                 continue;
-            } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
-                for (size_t i = 0; i < inp->m_vertices.size(); ++i) {
+            } else if (type == aiPrimitiveType_POINT) {
+                for (size_t i = 0; i < uiNumIndices; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 1;
                     f.mIndices = new unsigned int[1];
@@ -379,8 +380,7 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
             }
 
             aiFace *pFace = &pMesh->mFaces[outIndex++];
-            const unsigned int uiNumIndices = (unsigned int)face->m_vertices.size();
-            uiIdxCount += pFace->mNumIndices = (unsigned int)uiNumIndices;
+            uiIdxCount += pFace->mNumIndices = uiNumIndices;
             if (pFace->mNumIndices > 0) {
                 pFace->mIndices = new unsigned int[uiNumIndices];
             }
@@ -442,10 +442,14 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
     // Copy vertices, normals and textures into aiMesh instance
     bool normalsok = true, uvok = true;
     unsigned int newIndex = 0, outIndex = 0;
-    for (auto sourceFace : pObjMesh->m_Faces) {
+    for (size_t faceIndex = 0; faceIndex < pObjMesh->getNumFaces(); faceIndex++) {
+        const aiPrimitiveType type = pObjMesh->m_FaceTypes[faceIndex];
+        const ObjFile::FaceIndex *corners = pObjMesh->getFaceIndices(faceIndex);
+        const unsigned int numCorners = pObjMesh->getNumFaceIndices(faceIndex);
+
         // Copy all index arrays
-        for (size_t vertexIndex = 0, outVertexIndex = 0; vertexIndex < sourceFace->m_vertices.size(); vertexIndex++) {
-            const unsigned int vertex = sourceFace->m_vertices.at(vertexIndex);
+        for (size_t vertexIndex = 0, outVertexIndex = 0; vertexIndex < numCorners; vertexIndex++) {
+            const unsigned int vertex = corners[vertexIndex].m_vertex;
             if (vertex >= pModel->mVertices.size()) {
                 throw DeadlyImportError("OBJ: vertex index out of range");
             }
@@ -457,8 +461,8 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             pMesh->mVertices[newIndex] = pModel->mVertices[vertex];
 
             // Copy all normals
-            if (normalsok && !pModel->mNormals.empty() && vertexIndex < sourceFace->m_normals.size()) {
-                const unsigned int normal = sourceFace->m_normals.at(vertexIndex);
+            const unsigned int normal = corners[vertexIndex].m_normal;
+            if (normalsok && pMesh->mNormals && normal != ObjFile::FaceIndex::NoIndex) {
                 if (normal >= pModel->mNormals.size()) {
                     normalsok = false;
                 } else {
@@ -473,9 +477,8 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             }
 
             // Copy all texture coordinates
-            if (uvok && !pModel->mTextureCoord.empty() && vertexIndex < sourceFace->m_texturCoords.size()) {
-                const unsigned int tex = sourceFace->m_texturCoords.at(vertexIndex);
-
+            const unsigned int tex = corners[vertexIndex].m_texturCoord;
+            if (uvok && pMesh->mTextureCoords[0] && tex != ObjFile::FaceIndex::NoIndex) {
                 if (tex >= pModel->mTextureCoord.size()) {
                     uvok = false;
                 } else {
@@ -487,16 +490,16 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             // Get destination face
             aiFace *pDestFace = &pMesh->mFaces[outIndex];
 
-            const bool last = (vertexIndex == sourceFace->m_vertices.size() - 1);
-            if (sourceFace->mPrimitiveType != aiPrimitiveType_LINE || !last) {
+            const bool last = (vertexIndex == numCorners - 1);
+            if (type != aiPrimitiveType_LINE || !last) {
                 pDestFace->mIndices[outVertexIndex] = newIndex;
                 outVertexIndex++;
             }
 
-            if (sourceFace->mPrimitiveType == aiPrimitiveType_POINT) {
+            if (type == aiPrimitiveType_POINT) {
                 outIndex++;
                 outVertexIndex = 0;
-            } else if (sourceFace->mPrimitiveType == aiPrimitiveType_LINE) {
+            } else if (type == aiPrimitiveType_LINE) {
                 outVertexIndex = 0;
 
                 if (!last)
@@ -509,7 +512,7 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
                         }
 
                         pMesh->mVertices[newIndex + 1] = pMesh->mVertices[newIndex];
-                        if (!sourceFace->m_normals.empty() && !pModel->mNormals.empty()) {
+                        if (normal != ObjFile::FaceIndex::NoIndex && pMesh->mNormals) {
                             pMesh->mNormals[newIndex + 1] = pMesh->mNormals[newIndex];
                         }
                         if (!pModel->mTextureCoord.empty()) {
@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileData.h"
 #include "ObjFileMtlImporter.h"
 #include "ObjTools.h"
+#include "Common/CancelToken.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/ParsingUtils.h>
@@ -66,13 +67,14 @@ ObjFileParser::ObjFileParser() :
         mEnd(&m_buffer[Buffersize]),
         m_pIO(nullptr),
         m_progress(nullptr),
+        m_cancel(nullptr),
         m_originalObjFileName() {
     std::fill_n(m_buffer, Buffersize, '\0');
 }
 
 ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName,
         IOSystem *io, ProgressHandler *progress,
-        const std::string &originalObjFileName) :
+        const std::string &originalObjFileName, const CancelToken *cancel) :
         m_DataIt(),
         m_DataItEnd(),
         m_pModel(nullptr),
@@ -80,6 +82,7 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
         m_buffer(),
         m_pIO(io),
         m_progress(progress),
+        m_cancel(cancel),
         m_originalObjFileName(originalObjFileName) {
     std::fill_n(m_buffer, Buffersize, '\0');
 
@@ -116,7 +119,11 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
 
     bool insideCstype = false;
     std::vector<char> buffer;
+    size_t lineCount = 0;
     while (streamBuffer.getNextDataLine(buffer, '\\')) {
+        if (nullptr != m_cancel) {
+            m_cancel->Check(lineCount++);
+        }
         m_DataIt = buffer.begin();
         m_DataItEnd = buffer.end();
         mEnd = &buffer[buffer.size() - 1] + 1;
@@ -445,7 +452,8 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         return;
     }
 
-    ObjFile::Face *face = new ObjFile::Face(type);
+    m_faceIndices.clear();
+    unsigned int numTexCoords = 0;
     bool hasNormal = false;
 
     const int vSize = static_cast<unsigned int>(m_pModel->mVertices.size());
@@ -498,54 +506,38 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
                 iPos = 2; // skip texture coords for normals if there are no tex coords
             }
 
-            if (iVal > 0) {
-                // Store parsed index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(iVal - 1);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(iVal - 1);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(iVal - 1);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
-            } else if (iVal < 0) {
-                // Store relatively index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(vSize + iVal);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(vtSize + iVal);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(vnSize + iVal);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
-            } else {
+            if (iVal == 0) {
                 //On error, std::atoi will return 0 which is not a valid value
-                delete face;
                 throw DeadlyImportError("OBJ: Invalid face index.");
             }
+
+            // Store parsed or relative index, texture coordinates and normals
+            // belong to the corner started by the last vertex index
+            if (0 == iPos) {
+                const unsigned int index = static_cast<unsigned int>(iVal > 0 ? iVal - 1 : vSize + iVal);
+                m_faceIndices.push_back({ index, ObjFile::FaceIndex::NoIndex, ObjFile::FaceIndex::NoIndex });
+            } else if (m_faceIndices.empty()) {
+                // no vertex index to attach it to, ignore it
+            } else if (1 == iPos) {
+                m_faceIndices.back().m_texturCoord = static_cast<unsigned int>(iVal > 0 ? iVal - 1 : vtSize + iVal);
+                ++numTexCoords;
+            } else if (2 == iPos) {
+                m_faceIndices.back().m_normal = static_cast<unsigned int>(iVal > 0 ? iVal - 1 : vnSize + iVal);
+                hasNormal = true;
+            } else {
+                reportErrorTokenInFace();
+            }
         }
         m_DataIt += iStep;
     }
 
-    if (face->m_vertices.empty()) {
+    if (m_faceIndices.empty()) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
+        // skip line
         m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
-        delete face;
         return;
     }
 
-    // Set active material, if one set
-    if (nullptr != m_pModel->mCurrentMaterial) {
-        face->m_pMaterial = m_pModel->mCurrentMaterial;
-    } else {
-        face->m_pMaterial = m_pModel->mDefaultMaterial;
-    }
-
     // Create a default object, if nothing is there
     if (nullptr == m_pModel->mCurrentObject) {
         createObject(DefaultObjName);
@@ -557,9 +549,9 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     }
 
     // Store the face
-    m_pModel->mCurrentMesh->m_Faces.emplace_back(face);
-    m_pModel->mCurrentMesh->m_uiNumIndices += static_cast<unsigned int>(face->m_vertices.size());
-    m_pModel->mCurrentMesh->m_uiUVCoordinates[0] += static_cast<unsigned int>(face->m_texturCoords.size());
+    m_pModel->mCurrentMesh->addFace(type, m_faceIndices);
+    m_pModel->mCurrentMesh->m_uiNumIndices += static_cast<unsigned int>(m_faceIndices.size());
+    m_pModel->mCurrentMesh->m_uiUVCoordinates[0] += numTexCoords;
     if (!m_pModel->mCurrentMesh->m_hasNormals && hasNormal) {
         m_pModel->mCurrentMesh->m_hasNormals = true;
     }
@@ -867,7 +859,7 @@ bool ObjFileParser::needsNewMesh(const std::string &materialName) {
     if (curMatIdx != int(ObjFile::Mesh::NoMaterial) && curMatIdx != matIdx
             // no need create a new mesh if no faces in current
             // lets say 'usemtl' goes straight after 'g'
-            && !m_pModel->mCurrentMesh->m_Faces.empty()) {
+            && m_pModel->mCurrentMesh->getNumFaces() != 0) {
         // New material -> only one material per mesh, so we need to create a new
         // material
         newMat = true;
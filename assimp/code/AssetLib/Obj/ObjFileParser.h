@@ -59,6 +59,7 @@ namespace Assimp {
 class ObjFileImporter;
 class IOSystem;
 class ProgressHandler;
+class CancelToken;
 
 // ------------------------------------------------------------------------------------------------
 /// \class  ObjFileParser
@@ -74,7 +75,8 @@ public:
     /// @brief  The default constructor.
     ObjFileParser();
     /// @brief  Constructor with data array.
-    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName,
+            const CancelToken *cancel = nullptr);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -150,8 +152,12 @@ private:
     IOSystem *m_pIO;
     //! Pointer to progress handler
     ProgressHandler *m_progress;
+    //! Cancellation state of the import, may be nullptr
+    const CancelToken *m_cancel;
     /// Path to the current model, name of the obj file where the buffer comes from
     const std::string m_originalObjFileName;
+    /// Corners of the face being parsed, reused for all faces
+    std::vector<ObjFile::FaceIndex> m_faceIndices;
 };
 
 } // Namespace Assimp
@@ -133,6 +133,10 @@ const aiImporterDesc *PLYImporter::GetInfo() const {
 // ------------------------------------------------------------------------------------------------
 // Imports the given file into the given scene structure.
 void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSystem *pIOHandler) {
+    // drop what a cancelled or failed previous import left behind
+    delete mGeneratedMesh;
+    mGeneratedMesh = nullptr;
+
     const std::string mode = "rb";
     std::unique_ptr<IOStream> fileStream(pIOHandler->Open(pFile, mode));
     if (!fileStream) {
@@ -267,6 +271,7 @@ static constexpr ai_uint NotSet = 0xFFFFFFFF;
 void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos) {
     ai_assert(nullptr != pcElement);
     ai_assert(nullptr != instElement);
+    CheckCancel(pos);
 
     ai_uint aiPositions[3] = { NotSet, NotSet, NotSet };
     PLY::EDataType aiTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
@@ -476,6 +481,92 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Decode a run of binary vertex records using a precompiled layout
+void PLYImporter::LoadVerticesBinary(const PLY::Element *pcElement, const PLY::BinaryVertexLayout &layout,
+        const char *pCur, unsigned int pos, unsigned int count, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != pCur || 0 == count);
+    CheckCancel();
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (pos > mGeneratedMesh->mNumVertices || count > mGeneratedMesh->mNumVertices - pos) {
+        throw DeadlyImportError("Invalid .ply file: Too many vertices");
+    }
+
+    const BinaryVertexLayout::Channel *pos3 = layout.aPosition;
+    const BinaryVertexLayout::Channel *nrm3 = layout.aNormal;
+    const BinaryVertexLayout::Channel *clr4 = layout.aColor;
+    const BinaryVertexLayout::Channel *uv2 = layout.aTexCoord;
+
+    const bool haveNormal = nrm3[0].IsSet() || nrm3[1].IsSet() || nrm3[2].IsSet();
+    const bool haveColor = clr4[0].IsSet() || clr4[1].IsSet() || clr4[2].IsSet() || clr4[3].IsSet();
+    const bool haveTextureCoords = uv2[0].IsSet() || uv2[1].IsSet();
+
+    if (haveNormal && nullptr == mGeneratedMesh->mNormals) {
+        mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (haveColor && nullptr == mGeneratedMesh->mColors[0]) {
+        mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
+    }
+    if (haveTextureCoords && nullptr == mGeneratedMesh->mTextureCoords[0]) {
+        mGeneratedMesh->mNumUVComponents[0] = 2;
+        mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+
+    for (unsigned int i = 0; i < count; ++i, pCur += layout.uiStride) {
+        const unsigned int idx = pos + i;
+        auto decode = [pCur, p_bBE](const BinaryVertexLayout::Channel &c) {
+            return PLY::PropertyInstance::DecodeValueBinary(pCur + c.uiOffset, c.eType, p_bBE);
+        };
+
+        aiVector3D &vOut = mGeneratedMesh->mVertices[idx];
+        for (unsigned int c = 0; c < 3; ++c) {
+            if (pos3[c].IsSet()) {
+                vOut[c] = PLY::PropertyInstance::ConvertTo<ai_real>(decode(pos3[c]), pos3[c].eType);
+            }
+        }
+
+        if (haveNormal) {
+            aiVector3D &nOut = mGeneratedMesh->mNormals[idx];
+            for (unsigned int c = 0; c < 3; ++c) {
+                if (nrm3[c].IsSet()) {
+                    nOut[c] = PLY::PropertyInstance::ConvertTo<ai_real>(decode(nrm3[c]), nrm3[c].eType);
+                }
+            }
+        }
+
+        if (haveColor) {
+            // assume 1.0 for the alpha channel if it is not set
+            aiColor4D &cOut = mGeneratedMesh->mColors[0][idx];
+            cOut = aiColor4D(0.0, 0.0, 0.0, 1.0);
+            for (unsigned int c = 0; c < 4; ++c) {
+                if (clr4[c].IsSet()) {
+                    cOut[c] = NormalizeColorValue(decode(clr4[c]), clr4[c].eType);
+                }
+            }
+        }
+
+        if (haveTextureCoords) {
+            aiVector3D &tOut = mGeneratedMesh->mTextureCoords[0][idx];
+            for (unsigned int c = 0; c < 2; ++c) {
+                if (uv2[c].IsSet()) {
+                    tOut[c] = PLY::PropertyInstance::ConvertTo<ai_real>(decode(uv2[c]), uv2[c].eType);
+                }
+            }
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
 ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
@@ -509,6 +600,7 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
         unsigned int pos) {
     ai_assert(nullptr != pcElement);
     ai_assert(nullptr != instElement);
+    CheckCancel(pos);
 
     if (mGeneratedMesh == nullptr) {
         throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
@@ -672,6 +764,35 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Decode a binary vertex index list straight into a face
+void PLYImporter::LoadFaceBinary(const PLY::Element *pcElement, unsigned int pos, const char *pCur,
+        unsigned int numIndices, PLY::EDataType eType, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    CheckCancel(pos);
+
+    if (mGeneratedMesh == nullptr) {
+        throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
+    }
+
+    if (mGeneratedMesh->mFaces == nullptr) {
+        mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+        mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    } else if (mGeneratedMesh->mNumFaces < pcElement->NumOccur) {
+        throw DeadlyImportError("Invalid .ply file: Too many faces");
+    }
+
+    aiFace &face = mGeneratedMesh->mFaces[pos];
+    face.mNumIndices = numIndices;
+    face.mIndices = new unsigned int[numIndices];
+
+    const unsigned int size = PLY::PropertyInstance::GetTypeSize(eType);
+    for (unsigned int a = 0; a < numIndices; ++a, pCur += size) {
+        face.mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(
+                PLY::PropertyInstance::DecodeValueBinary(pCur, eType, p_bBE), eType);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get a RGBA color in [0...1] range
 void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avList,
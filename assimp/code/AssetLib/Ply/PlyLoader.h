@@ -84,6 +84,18 @@ public:
     */
     void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Extract a run of binary vertex records, starting at pCur
+    */
+    void LoadVerticesBinary(const PLY::Element *pcElement, const PLY::BinaryVertexLayout &layout,
+            const char *pCur, unsigned int pos, unsigned int count, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    /** Extract a face from a binary index list, starting at pCur
+    */
+    void LoadFaceBinary(const PLY::Element *pcElement, unsigned int pos, const char *pCur,
+            unsigned int numIndices, PLY::EDataType eType, bool p_bBE);
+
 protected:
     // -------------------------------------------------------------------
     /** Return importer meta information.
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/fast_atof.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
 
@@ -70,6 +71,24 @@ std::string to_string(EElementSemantic e) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Make sure at least lsize bytes are available at pCur, reading the next file blocks if needed
+static void EnsureBinaryData(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, unsigned int lsize) {
+    while (bufferSize < lsize) {
+        std::vector<char> nbuffer;
+        if (!streamBuffer.getNextBlock(nbuffer)) {
+            throw DeadlyImportError("Invalid .ply file: File corrupted");
+        }
+
+        // concat buffer contents
+        buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
+        buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = buffer.empty() ? nullptr : (char *)&buffer[0];
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 PLY::EDataType PLY::Property::ParseDataType(std::vector<char> &buffer) {
     ai_assert(!buffer.empty());
@@ -343,6 +362,89 @@ bool PLY::Element::ParseElement(IOStreamBuffer<char> &streamBuffer, std::vector<
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool PLY::BinaryVertexLayout::Compile(const PLY::Element *pcElement, PLY::BinaryVertexLayout *p_pcOut) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != p_pcOut);
+
+    unsigned int offset = 0, cnt = 0;
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        const unsigned int size = PLY::PropertyInstance::GetTypeSize(prop.eType);
+        if (prop.bIsList || 0 == size) {
+            return false;
+        }
+
+        Channel *channel = nullptr;
+        switch (prop.Semantic) {
+        case EST_XCoord:
+        case EST_YCoord:
+        case EST_ZCoord:
+            channel = &p_pcOut->aPosition[prop.Semantic - EST_XCoord];
+            break;
+        case EST_XNormal:
+        case EST_YNormal:
+        case EST_ZNormal:
+            channel = &p_pcOut->aNormal[prop.Semantic - EST_XNormal];
+            break;
+        case EST_Red:
+        case EST_Green:
+        case EST_Blue:
+        case EST_Alpha:
+            channel = &p_pcOut->aColor[prop.Semantic - EST_Red];
+            break;
+        case EST_UTextureCoord:
+        case EST_VTextureCoord:
+            channel = &p_pcOut->aTexCoord[prop.Semantic - EST_UTextureCoord];
+            break;
+        default:
+            break;
+        }
+
+        if (nullptr != channel) {
+            // the last declaration of a channel wins, as in PLYImporter::LoadVertex
+            channel->uiOffset = offset;
+            channel->eType = prop.eType;
+            ++cnt;
+        }
+        offset += size;
+    }
+
+    p_pcOut->uiStride = offset;
+    return 0 != cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::BinaryFaceLayout::Compile(const PLY::Element *pcElement, PLY::BinaryFaceLayout *p_pcOut) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != p_pcOut);
+
+    bool haveList = false;
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        if (prop.bIsList) {
+            // only a single vertex index list is supported, texture coordinates
+            // and other lists take the generic path
+            if (haveList || PLY::EST_VertexIndex != prop.Semantic ||
+                    0 == PLY::PropertyInstance::GetTypeSize(prop.eFirstType) ||
+                    0 == PLY::PropertyInstance::GetTypeSize(prop.eType)) {
+                return false;
+            }
+            haveList = true;
+            p_pcOut->eCountType = prop.eFirstType;
+            p_pcOut->eIndexType = prop.eType;
+            continue;
+        }
+
+        const unsigned int size = PLY::PropertyInstance::GetTypeSize(prop.eType);
+        if (0 == size) {
+            return false;
+        }
+        (haveList ? p_pcOut->uiSuffix : p_pcOut->uiPrefix) += size;
+    }
+
+    return haveList;
+}
+
+// ------------------------------------------------------------------------------------------------
 bool PLY::DOM::SkipSpaces(std::vector<char> &buffer) {
     const char *pCur = buffer.empty() ? nullptr : (char *)&buffer[0];
     const char *end = pCur + buffer.size();
@@ -631,6 +733,21 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // vertex and face records with a common layout are decoded directly into the mesh
+    if (nullptr == p_pcOut && nullptr != loader) {
+        if (pcElement->eSemantic == EEST_Vertex) {
+            PLY::BinaryVertexLayout layout;
+            if (PLY::BinaryVertexLayout::Compile(pcElement, &layout)) {
+                return ParseVertexListBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, layout, loader, p_bBE);
+            }
+        } else if (pcElement->eSemantic == EEST_Face) {
+            PLY::BinaryFaceLayout layout;
+            if (PLY::BinaryFaceLayout::Compile(pcElement, &layout)) {
+                return ParseFaceListBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, layout, loader, p_bBE);
+            }
+        }
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -658,6 +775,73 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementInstanceList::ParseVertexListBinary(
+        IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        const PLY::Element *pcElement,
+        const PLY::BinaryVertexLayout &layout,
+        PLYImporter *loader,
+        bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != loader);
+    ai_assert(0 != layout.uiStride);
+
+    // hand over all complete records of the current block at once
+    unsigned int i = 0;
+    while (i < pcElement->NumOccur) {
+        EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, layout.uiStride);
+
+        const unsigned int count = std::min(pcElement->NumOccur - i, bufferSize / layout.uiStride);
+        loader->LoadVerticesBinary(pcElement, layout, pCur, i, count, p_bBE);
+
+        pCur += count * layout.uiStride;
+        bufferSize -= count * layout.uiStride;
+        i += count;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementInstanceList::ParseFaceListBinary(
+        IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        const PLY::Element *pcElement,
+        const PLY::BinaryFaceLayout &layout,
+        PLYImporter *loader,
+        bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != loader);
+
+    const unsigned int countSize = PLY::PropertyInstance::GetTypeSize(layout.eCountType);
+    const unsigned int indexSize = PLY::PropertyInstance::GetTypeSize(layout.eIndexType);
+    for (unsigned int i = 0; i < pcElement->NumOccur; ++i) {
+        EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, layout.uiPrefix + countSize);
+        pCur += layout.uiPrefix;
+        bufferSize -= layout.uiPrefix;
+
+        const PLY::PropertyInstance::ValueUnion v = PLY::PropertyInstance::DecodeValueBinary(pCur, layout.eCountType, p_bBE);
+        const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, layout.eCountType);
+        pCur += countSize;
+        bufferSize -= countSize;
+
+        const uint64_t listSize = static_cast<uint64_t>(iNum) * indexSize + layout.uiSuffix;
+        if (listSize > UINT32_MAX) {
+            throw DeadlyImportError("Invalid .ply file: Index list too large");
+        }
+        EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, static_cast<unsigned int>(listSize));
+        loader->LoadFaceBinary(pcElement, i, pCur, iNum, layout.eIndexType, p_bBE);
+
+        pCur += listSize;
+        bufferSize -= static_cast<unsigned int>(listSize);
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::ElementInstance::ParseInstance(const char *&pCur, const char *end,
         const PLY::Element *pcElement,
@@ -848,147 +1032,144 @@ bool PLY::PropertyInstance::ParseValue(const char *&pCur,
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
-        std::vector<char> &buffer,
-        const char *&pCur,
-        unsigned int &bufferSize,
-        PLY::EDataType eType,
-        PLY::PropertyInstance::ValueUnion *out,
-        bool p_bBE) {
-    ai_assert(nullptr != out);
-
-    // calc element size
-    unsigned int lsize = 0;
+unsigned int PLY::PropertyInstance::GetTypeSize(PLY::EDataType eType) {
     switch (eType) {
     case EDT_Char:
     case EDT_UChar:
-        lsize = 1;
-        break;
+        return 1;
 
     case EDT_UShort:
     case EDT_Short:
-        lsize = 2;
-        break;
+        return 2;
 
     case EDT_UInt:
     case EDT_Int:
     case EDT_Float:
-        lsize = 4;
-        break;
+        return 4;
 
     case EDT_Double:
-        lsize = 8;
-        break;
+        return 8;
 
     case EDT_INVALID:
     default:
         break;
     }
 
-    // read the next file block if needed
-    if (bufferSize < lsize) {
-        std::vector<char> nbuffer;
-        if (streamBuffer.getNextBlock(nbuffer)) {
-            // concat buffer contents
-            buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
-            buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
-            nbuffer.clear();
-            bufferSize = static_cast<unsigned int>(buffer.size());
-            pCur = (char *)&buffer[0];
-        } else {
-            throw DeadlyImportError("Invalid .ply file: File corrupted");
-        }
-    }
+    return 0;
+}
 
-    bool ret = true;
+// ------------------------------------------------------------------------------------------------
+PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DecodeValueBinary(const char *pCur,
+        PLY::EDataType eType,
+        bool p_bBE) {
+    ai_assert(nullptr != pCur);
+
+    PLY::PropertyInstance::ValueUnion out;
+    out.iUInt = 0;
     switch (eType) {
     case EDT_UInt: {
         uint32_t t;
         memcpy(&t, pCur, sizeof(uint32_t));
-        pCur += sizeof(uint32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UShort: {
         uint16_t t;
         memcpy(&t, pCur, sizeof(uint16_t));
-        pCur += sizeof(uint16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UChar: {
         uint8_t t;
         memcpy(&t, pCur, sizeof(uint8_t));
-        pCur += sizeof(uint8_t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_Int: {
         int32_t t;
         memcpy(&t, pCur, sizeof(int32_t));
-        pCur += sizeof(int32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Short: {
         int16_t t;
         memcpy(&t, pCur, sizeof(int16_t));
-        pCur += sizeof(int16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Char: {
         int8_t t;
         memcpy(&t, pCur, sizeof(int8_t));
-        pCur += sizeof(int8_t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Float: {
         float t;
         memcpy(&t, pCur, sizeof(float));
-        pCur += sizeof(float);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fFloat = t;
+        out.fFloat = t;
         break;
     }
     case EDT_Double: {
         double t;
         memcpy(&t, pCur, sizeof(double));
-        pCur += sizeof(double);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fDouble = t;
+        out.fDouble = t;
         break;
     }
     default:
-        ret = false;
+        break;
     }
 
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        PLY::EDataType eType,
+        PLY::PropertyInstance::ValueUnion *out,
+        bool p_bBE) {
+    ai_assert(nullptr != out);
+
+    // calc element size
+    const unsigned int lsize = GetTypeSize(eType);
+    if (0 == lsize) {
+        return false;
+    }
+
+    // read the next file block if needed
+    EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, lsize);
+
+    *out = DecodeValueBinary(pCur, eType, p_bBE);
+    pCur += lsize;
     bufferSize -= lsize;
 
-    return ret;
+    return true;
 }
 
 } // namespace Assimp
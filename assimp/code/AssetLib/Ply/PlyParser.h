@@ -345,12 +345,98 @@ public:
     static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
 
+    // -------------------------------------------------------------------
+    //! Get the size of a binary value in bytes, 0 for invalid types
+    static unsigned int GetTypeSize(EDataType eType);
+
+    // -------------------------------------------------------------------
+    //! Decode a binary value from memory. pCur must point to at least
+    //! GetTypeSize(eType) valid bytes
+    static ValueUnion DecodeValueBinary(const char *pCur, EDataType eType, bool p_bBE);
+
     // -------------------------------------------------------------------
     //! Convert a property value to a given type TYPE
     template <typename TYPE>
     static TYPE ConvertTo(ValueUnion v, EDataType eType);
 };
 
+// ---------------------------------------------------------------------------------
+/** \brief Precompiled record layout of a binary vertex element
+ *
+ * A vertex element which contains scalar properties only has a fixed record
+ * size, so the offset and type of each channel can be resolved once from the
+ * header. Whole runs of records are then decoded straight from the read buffer
+ * into the mesh, without building an ElementInstance per vertex.
+ */
+class BinaryVertexLayout {
+public:
+    //! Location of a single channel inside of a vertex record
+    struct Channel {
+        //! Byte offset relative to the start of the record
+        unsigned int uiOffset = 0;
+
+        //! Data type, EDT_INVALID if the channel is not present
+        EDataType eType = EDT_INVALID;
+
+        bool IsSet() const {
+            return EDT_INVALID != eType;
+        }
+    };
+
+    //! Default constructor
+    BinaryVertexLayout() AI_NO_EXCEPT = default;
+
+    //! Size of one vertex record in bytes
+    unsigned int uiStride = 0;
+
+    //! x, y, z position
+    Channel aPosition[3];
+
+    //! x, y, z normal
+    Channel aNormal[3];
+
+    //! red, green, blue, alpha
+    Channel aColor[4];
+
+    //! u, v texture coordinate
+    Channel aTexCoord[2];
+
+    // -------------------------------------------------------------------
+    //! Compile the layout for a vertex element. Returns false if the
+    //! element contains lists or unknown data types, or if none of its
+    //! properties is used by the importer.
+    static bool Compile(const Element *pcElement, BinaryVertexLayout *p_pcOut);
+};
+
+// ---------------------------------------------------------------------------------
+/** \brief Precompiled record layout of a binary face element
+ *
+ * Covers face elements with a single vertex index list, optionally surrounded
+ * by scalar properties which are skipped.
+ */
+class BinaryFaceLayout {
+public:
+    //! Default constructor
+    BinaryFaceLayout() AI_NO_EXCEPT = default;
+
+    //! Number of bytes in front of the index list
+    unsigned int uiPrefix = 0;
+
+    //! Number of bytes behind the index list
+    unsigned int uiSuffix = 0;
+
+    //! Data type of the list size
+    EDataType eCountType = EDT_INVALID;
+
+    //! Data type of the indices
+    EDataType eIndexType = EDT_INVALID;
+
+    // -------------------------------------------------------------------
+    //! Compile the layout for a face element. Returns false if the
+    //! element does not match the supported layout.
+    static bool Compile(const Element *pcElement, BinaryFaceLayout *p_pcOut);
+};
+
 // ---------------------------------------------------------------------------------
 /** \brief Class for an element instance in a PLY file
  */
@@ -395,6 +481,16 @@ public:
     //! Parse a binary element instance list
     static bool ParseInstanceListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Parse a binary vertex list using a precompiled layout
+    static bool ParseVertexListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, const BinaryVertexLayout &layout, PLYImporter* loader, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Parse a binary face list using a precompiled layout
+    static bool ParseFaceListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, const BinaryFaceLayout &layout, PLYImporter* loader, bool p_bBE);
 };
 // ---------------------------------------------------------------------------------
 /** \brief Class to represent the document object model of an ASCII or binary
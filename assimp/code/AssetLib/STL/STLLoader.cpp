@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
 #include <memory>
 
 namespace Assimp {
@@ -121,6 +122,47 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
     }
     return isASCII;
 }
+
+// Decodes the 15 bit facet color of a binary STL
+static aiColor4D DecodeFacetColor(uint16_t color, bool bIsMaterialise) {
+    aiColor4D clr;
+    clr.a = 1.0;
+    const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
+    if (bIsMaterialise) // this is reversed
+    {
+        clr.r = (color & 0x1fu) * invVal;
+        clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+        clr.b = ((color & (0x1fu << 10)) >> 10u) * invVal;
+    } else {
+        clr.b = (color & 0x1fu) * invVal;
+        clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+        clr.r = ((color & (0x1fu << 10)) >> 10u) * invVal;
+    }
+    return clr;
+}
+
+// Key of a welded vertex: the raw position bits plus the facet color
+struct WeldKey {
+    uint32_t bits[3];
+    uint16_t color;
+
+    bool operator==(const WeldKey &other) const {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1] &&
+               bits[2] == other.bits[2] && color == other.color;
+    }
+};
+
+static uint32_t HashWeldKey(const WeldKey &key) {
+    uint32_t h = key.color;
+    for (uint32_t b : key.bits) {
+        h ^= b + 0x9e3779b9u + (h << 6) + (h >> 2);
+    }
+    // final avalanche, the table index is taken from the low bits
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -128,7 +170,8 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
 STLImporter::STLImporter() :
         mBuffer(),
         mFileSize(0),
-        mScene() {
+        mScene(),
+        mWeldVertices(false) {
     // empty
 }
 
@@ -143,6 +186,12 @@ bool STLImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool /
     return SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens));
 }
 
+// ------------------------------------------------------------------------------------------------
+// Setup configuration properties for the loader
+void STLImporter::SetupProperties(const Importer *pImp) {
+    mWeldVertices = pImp->GetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, false);
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *STLImporter::GetInfo() const {
     return &desc;
@@ -445,6 +494,39 @@ bool STLImporter::LoadBinaryFile() {
         throw DeadlyImportError("STL: file is empty. There are no facets defined");
     }
 
+    if (mWeldVertices) {
+        LoadBinaryFacesWelded(pMesh, sz, bIsMaterialise);
+    } else {
+        LoadBinaryFaces(pMesh, sz, bIsMaterialise);
+    }
+
+    aiNode *root = mScene->mRootNode;
+
+    // allocate one node
+    aiNode *node = new aiNode();
+    node->mParent = root;
+
+    root->mNumChildren = 1u;
+    root->mChildren = new aiNode *[root->mNumChildren];
+    root->mChildren[0] = node;
+
+    // add all created meshes to the single node
+    node->mNumMeshes = mScene->mNumMeshes;
+    node->mMeshes = new unsigned int[mScene->mNumMeshes];
+    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+        node->mMeshes[i] = i;
+    }
+
+    if (bIsMaterialise && !pMesh->mColors[0]) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read the binary facets, three unique vertices per facet
+void STLImporter::LoadBinaryFaces(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise) {
     pMesh->mNumVertices = pMesh->mNumFaces * 3;
 
     aiVector3D *vp = pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
@@ -454,6 +536,8 @@ bool STLImporter::LoadBinaryFile() {
     aiVector3f theVec3F;
 
     for (unsigned int i = 0; i < pMesh->mNumFaces; ++i) {
+        CheckCancel(i);
+
         // NOTE: Blender sometimes writes empty normals ... this is not
         // our fault ... the RemoveInvalidData helper step should fix that
 
@@ -510,49 +594,100 @@ bool STLImporter::LoadBinaryFile() {
                 ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
             }
             aiColor4D *clr = &pMesh->mColors[0][i * 3];
-            clr->a = 1.0;
-            const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
-            if (bIsMaterialise) // this is reversed
-            {
-                clr->r = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->b = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            } else {
-                clr->b = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->r = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            }
+            *clr = DecodeFacetColor(color, bIsMaterialise);
             // assign the color to all vertices of the face
             *(clr + 1) = *clr;
             *(clr + 2) = *clr;
         }
     }
 
+
     // now copy faces
     addFacesToMesh(pMesh);
+}
 
-    aiNode *root = mScene->mRootNode;
+// ------------------------------------------------------------------------------------------------
+// Read the binary facets and weld the vertices on the fly
+void STLImporter::LoadBinaryFacesWelded(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise) {
+    const unsigned int numFaces = pMesh->mNumFaces;
+
+    // open addressing table of vertex indices, the load factor stays below 0.5
+    size_t tableSize = 16;
+    while (tableSize < numFaces * 6ull) {
+        tableSize <<= 1;
+    }
+    const size_t tableMask = tableSize - 1;
+    std::vector<unsigned int> table(tableSize, UINT_MAX);
 
-    // allocate one node
-    aiNode *node = new aiNode();
-    node->mParent = root;
+    std::vector<WeldKey> keys;
+    std::vector<aiVector3D> normals;
+    keys.reserve(numFaces);
+    normals.reserve(numFaces);
+    bool hasColors = false;
 
-    root->mNumChildren = 1u;
-    root->mChildren = new aiNode *[root->mNumChildren];
-    root->mChildren[0] = node;
+    pMesh->mFaces = new aiFace[numFaces];
+    for (unsigned int i = 0; i < numFaces; ++i) {
+        CheckCancel(i);
 
-    // add all created meshes to the single node
-    node->mNumMeshes = mScene->mNumMeshes;
-    node->mMeshes = new unsigned int[mScene->mNumMeshes];
-    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
-        node->mMeshes[i] = i;
+        float rec[12];
+        ::memcpy(rec, sz, sizeof(rec));
+        uint16_t color;
+        ::memcpy(&color, sz + sizeof(rec), sizeof(color));
+        sz += 50;
+
+        // only facets carrying a color are distinguished, 0 selects the default color
+        const uint16_t clrKey = (color & (1 << 15)) ? color : 0;
+        hasColors = hasColors || clrKey != 0;
+
+        // NOTE: Blender sometimes writes empty normals, those simply don't contribute
+        const aiVector3D faceNormal(rec[0], rec[1], rec[2]);
+
+        aiFace &face = pMesh->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int v = 0; v < 3; ++v) {
+            WeldKey key;
+            for (unsigned int c = 0; c < 3; ++c) {
+                // adding +0 maps -0 to +0, so both share one vertex
+                const float f = rec[3 + v * 3 + c] + 0.0f;
+                ::memcpy(&key.bits[c], &f, sizeof(float));
+            }
+            key.color = clrKey;
+
+            size_t slot = HashWeldKey(key) & tableMask;
+            while (table[slot] != UINT_MAX && !(keys[table[slot]] == key)) {
+                slot = (slot + 1) & tableMask;
+            }
+            if (table[slot] == UINT_MAX) {
+                table[slot] = static_cast<unsigned int>(keys.size());
+                keys.push_back(key);
+                normals.emplace_back();
+            }
+
+            const unsigned int idx = table[slot];
+            normals[idx] += faceNormal;
+            face.mIndices[v] = idx;
+        }
     }
 
-    if (bIsMaterialise && !pMesh->mColors[0]) {
-        // use the color as diffuse material color
-        return true;
+    pMesh->mNumVertices = static_cast<unsigned int>(keys.size());
+    pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
+    pMesh->mNormals = new aiVector3D[pMesh->mNumVertices];
+    if (hasColors) {
+        pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+        ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
     }
-    return false;
+
+    for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        float pos[3];
+        ::memcpy(pos, keys[i].bits, sizeof(pos));
+        pMesh->mVertices[i] = aiVector3D(pos[0], pos[1], pos[2]);
+        pMesh->mNormals[i] = normals[i].NormalizeSafe();
+        if (hasColors) {
+            pMesh->mColors[0][i] = keys[i].color ? DecodeFacetColor(keys[i].color, bIsMaterialise) : mClrColorDefault;
+        }
+    }
+
+    ASSIMP_LOG_DEBUG("STL: Welded ", numFaces * 3, " facet vertices into ", pMesh->mNumVertices);
 }
 
 void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNode *node) {
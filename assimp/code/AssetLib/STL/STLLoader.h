@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Forward declarations
 struct aiNode;
+struct aiMesh;
 
 namespace Assimp {
 
@@ -75,6 +76,13 @@ public:
      */
     bool CanRead( const std::string& pFile, IOSystem* pIOHandler, bool checkSig) const override;
 
+    /**
+     * @brief   Called prior to ReadFile().
+     *  The function is a request to the importer to update its configuration
+     *  basing on the Importer's configuration property list.
+     */
+    void SetupProperties(const Importer* pImp) override;
+
 protected:
 
     /**
@@ -96,6 +104,17 @@ protected:
      */
     bool LoadBinaryFile();
 
+    /**
+     * @brief   Reads the binary facets, three unique vertices per facet.
+     */
+    void LoadBinaryFaces(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise);
+
+    /**
+     * @brief   Reads the binary facets into an indexed mesh, sharing
+     *  vertices with identical positions and facet colors.
+     */
+    void LoadBinaryFacesWelded(aiMesh *pMesh, const unsigned char *sz, bool bIsMaterialise);
+
     /**
      * @brief   Loads a ASCII text .stl file
      */
@@ -116,6 +135,9 @@ protected:
 
     /** Default vertex color */
     aiColor4D mClrColorDefault;
+
+    /** Configuration option: weld vertices of binary files */
+    bool mWeldVertices;
 };
 
 } // end of namespace Assimp
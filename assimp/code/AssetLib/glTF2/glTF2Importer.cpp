@@ -498,6 +498,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
 
         for (unsigned int p = 0; p < mesh.primitives.size(); ++p) {
             Mesh::Primitive &prim = mesh.primitives[p];
+            CheckCancel();
 
             Mesh::Primitive::Attributes &attr = prim.attributes;
 
@@ -1716,12 +1717,14 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     if (asset.scene) {
         pScene->mName = asset.scene->name;
     }
+    CheckCancel();
 
     // Copy the data out
     ImportEmbeddedTextures(asset);
     ImportMaterials(asset);
 
     ImportMeshes(asset);
+    CheckCancel();
 
     ImportCameras(asset);
     ImportLights(asset);
@@ -0,0 +1,235 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file AnimationEvaluator.cpp
+ *  @brief Implementation of the AnimationEvaluator helper class.
+ */
+
+#include <assimp/AnimationEvaluator.h>
+#include <assimp/ai_assert.h>
+#include <assimp/anim.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+using namespace Assimp;
+
+namespace {
+
+// number of keys stepped over before the search falls back to bisection
+const unsigned int MaxForwardSteps = 4;
+
+// ------------------------------------------------------------------------------------------------
+// Returns the index of the last key at or before pTime, 0 if there is none.
+// The search starts at the key used last, which is the common case during playback.
+template <typename TKey>
+unsigned int FindKey(const TKey *keys, unsigned int numKeys, double pTime, unsigned int cursor) {
+    if (cursor >= numKeys || keys[cursor].mTime > pTime) {
+        cursor = 0;
+    }
+    for (unsigned int step = 0; cursor + 1 < numKeys && keys[cursor + 1].mTime <= pTime; ++step) {
+        if (step == MaxForwardSteps) {
+            const TKey *next = std::upper_bound(keys + cursor + 1, keys + numKeys, pTime,
+                    [](double t, const TKey &key) { return t < key.mTime; });
+            return static_cast<unsigned int>(next - keys) - 1;
+        }
+        ++cursor;
+    }
+    return cursor;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the interpolation factor between key and the next one, or a
+// negative value if the value of key is to be used as is.
+template <typename TKey>
+ai_real KeyFactor(const TKey *keys, unsigned int numKeys, unsigned int index, double pTime) {
+    const TKey &key = keys[index];
+    if (index + 1 >= numKeys || pTime <= key.mTime || aiAnimInterpolation_Step == key.mInterpolation) {
+        return ai_real(-1.0);
+    }
+    const double span = keys[index + 1].mTime - key.mTime;
+    if (span <= 0.0) {
+        return ai_real(-1.0);
+    }
+    return static_cast<ai_real>((pTime - key.mTime) / span);
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D SampleVector(const aiVectorKey *keys, unsigned int numKeys, unsigned int index, double pTime) {
+    const ai_real factor = KeyFactor(keys, numKeys, index, pTime);
+    if (factor < 0) {
+        return keys[index].mValue;
+    }
+    return keys[index].mValue + (keys[index + 1].mValue - keys[index].mValue) * factor;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiQuaternion SampleQuaternion(const aiQuatKey *keys, unsigned int numKeys, unsigned int index, double pTime) {
+    const ai_real factor = KeyFactor(keys, numKeys, index, pTime);
+    if (factor < 0) {
+        return keys[index].mValue;
+    }
+    aiQuaternion out;
+    aiQuaternion::Interpolate(out, keys[index].mValue, keys[index + 1].mValue, factor);
+    return out;
+}
+
+} // namespace
+
+const unsigned int AnimationEvaluator::NoNode;
+
+// ------------------------------------------------------------------------------------------------
+AnimationEvaluator::AnimationEvaluator(const aiScene *pScene, const aiAnimation *pAnimation) :
+        mAnimation(nullptr) {
+    ai_assert(nullptr != pScene);
+    ai_assert(nullptr != pScene->mRootNode);
+
+    // flatten the hierarchy breadth first, so parents precede their children
+    mNodes.push_back(pScene->mRootNode);
+    mParents.push_back(NoNode);
+    for (unsigned int i = 0; i < mNodes.size(); ++i) {
+        const aiNode *node = mNodes[i];
+        for (unsigned int c = 0; c < node->mNumChildren; ++c) {
+            mNodes.push_back(node->mChildren[c]);
+            mParents.push_back(i);
+        }
+    }
+
+    mLocal.resize(mNodes.size());
+    mGlobal.resize(mNodes.size());
+    SetAnimation(pAnimation);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimationEvaluator::SetAnimation(const aiAnimation *pAnimation) {
+    mAnimation = pAnimation;
+    mChannels.clear();
+    for (size_t i = 0; i < mNodes.size(); ++i) {
+        mLocal[i] = mNodes[i]->mTransformation;
+    }
+    if (nullptr == pAnimation) {
+        return;
+    }
+
+    // the first node of a name wins, like in FindNode()
+    std::unordered_map<std::string, unsigned int> nodesByName;
+    nodesByName.reserve(mNodes.size());
+    for (unsigned int i = 0; i < mNodes.size(); ++i) {
+        nodesByName.emplace(mNodes[i]->mName.C_Str(), i);
+    }
+
+    mChannels.resize(pAnimation->mNumChannels);
+    for (unsigned int i = 0; i < pAnimation->mNumChannels; ++i) {
+        Channel &channel = mChannels[i];
+        channel.mPositionKey = channel.mRotationKey = channel.mScalingKey = 0;
+
+        const auto it = nodesByName.find(pAnimation->mChannels[i]->mNodeName.C_Str());
+        channel.mNode = it == nodesByName.end() ? NoNode : it->second;
+        if (NoNode != channel.mNode) {
+            mNodes[channel.mNode]->mTransformation.Decompose(channel.mScaling, channel.mRotation, channel.mPosition);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimationEvaluator::Evaluate(double pTime) {
+    double ticks = pTime;
+    if (nullptr != mAnimation) {
+        // same default as the importers that don't know the tick rate
+        ticks *= mAnimation->mTicksPerSecond != 0.0 ? mAnimation->mTicksPerSecond : 25.0;
+        if (mAnimation->mDuration > 0.0) {
+            ticks = std::fmod(ticks, mAnimation->mDuration);
+            if (ticks < 0.0) {
+                ticks += mAnimation->mDuration;
+            }
+        }
+    }
+    EvaluateTicks(ticks);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimationEvaluator::EvaluateTicks(double pTicks) {
+    for (unsigned int i = 0; nullptr != mAnimation && i < mChannels.size(); ++i) {
+        Channel &channel = mChannels[i];
+        if (NoNode == channel.mNode) {
+            continue;
+        }
+        const aiNodeAnim *anim = mAnimation->mChannels[i];
+
+        aiVector3D position = channel.mPosition;
+        if (anim->mNumPositionKeys) {
+            channel.mPositionKey = FindKey(anim->mPositionKeys, anim->mNumPositionKeys, pTicks, channel.mPositionKey);
+            position = SampleVector(anim->mPositionKeys, anim->mNumPositionKeys, channel.mPositionKey, pTicks);
+        }
+        aiQuaternion rotation = channel.mRotation;
+        if (anim->mNumRotationKeys) {
+            channel.mRotationKey = FindKey(anim->mRotationKeys, anim->mNumRotationKeys, pTicks, channel.mRotationKey);
+            rotation = SampleQuaternion(anim->mRotationKeys, anim->mNumRotationKeys, channel.mRotationKey, pTicks);
+        }
+        aiVector3D scaling = channel.mScaling;
+        if (anim->mNumScalingKeys) {
+            channel.mScalingKey = FindKey(anim->mScalingKeys, anim->mNumScalingKeys, pTicks, channel.mScalingKey);
+            scaling = SampleVector(anim->mScalingKeys, anim->mNumScalingKeys, channel.mScalingKey, pTicks);
+        }
+        mLocal[channel.mNode] = aiMatrix4x4(scaling, rotation, position);
+    }
+
+    // a single pass suffices as parents come first
+    mGlobal[0] = mLocal[0];
+    for (size_t i = 1; i < mNodes.size(); ++i) {
+        mGlobal[i] = mGlobal[mParents[i]] * mLocal[i];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int AnimationEvaluator::FindNode(const char *name) const {
+    ai_assert(nullptr != name);
+    for (unsigned int i = 0; i < mNodes.size(); ++i) {
+        if (!::strcmp(mNodes[i]->mName.C_Str(), name)) {
+            return i;
+        }
+    }
+    return NoNode;
+}
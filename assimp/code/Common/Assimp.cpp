@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "CApi/CInterfaceIOWrapper.h"
 #include "Importer.h"
+#include "ImporterRegistry.h"
 #include "ScenePrivate.h"
 
 #include <list>
@@ -107,17 +108,12 @@ static std::string gLastErrorString;
 /** Verbose logging active or not? */
 static aiBool gVerboseLogging = false;
 
-/** will return all registered importers. */
-void GetImporterInstanceList(std::vector<BaseImporter *> &out);
-
-/** will delete all registered importers. */
-void DeleteImporterInstanceList(std::vector<BaseImporter *> &out);
-
 } // namespace Assimp
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-/** Global mutex to manage the access to the log-stream map */
-static std::mutex gLogStreamMutex;
+/** Global mutex to manage the access to the log-stream map, recursive as
+ *  deleting a redirector while holding it locks it again */
+static std::recursive_mutex gLogStreamMutex;
 #endif
 
 // ------------------------------------------------------------------------------------------------
@@ -131,7 +127,7 @@ public:
 
     ~LogToCallbackRedirector() override {
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-        std::lock_guard<std::mutex> lock(gLogStreamMutex);
+        std::lock_guard<std::recursive_mutex> lock(gLogStreamMutex);
 #endif
         // (HACK) Check whether the 'stream.user' pointer points to a
         // custom LogStream allocated by #aiGetPredefinedLogStream.
@@ -390,7 +386,7 @@ ASSIMP_API void aiAttachLogStream(const aiLogStream *stream) {
     ASSIMP_BEGIN_EXCEPTION_REGION();
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-    std::lock_guard<std::mutex> lock(gLogStreamMutex);
+    std::lock_guard<std::recursive_mutex> lock(gLogStreamMutex);
 #endif
 
     LogStream *lg = new LogToCallbackRedirector(*stream);
@@ -408,7 +404,7 @@ ASSIMP_API aiReturn aiDetachLogStream(const aiLogStream *stream) {
     ASSIMP_BEGIN_EXCEPTION_REGION();
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-    std::lock_guard<std::mutex> lock(gLogStreamMutex);
+    std::lock_guard<std::recursive_mutex> lock(gLogStreamMutex);
 #endif
     // find the log-stream associated with this data
     LogStreamMap::iterator it = gActiveLogStreams.find(*stream);
@@ -436,7 +432,7 @@ ASSIMP_API aiReturn aiDetachLogStream(const aiLogStream *stream) {
 ASSIMP_API void aiDetachAllLogStreams(void) {
     ASSIMP_BEGIN_EXCEPTION_REGION();
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-    std::lock_guard<std::mutex> lock(gLogStreamMutex);
+    std::lock_guard<std::recursive_mutex> lock(gLogStreamMutex);
 #endif
     Logger *logger(DefaultLogger::get());
     if (nullptr == logger) {
@@ -673,19 +669,15 @@ ASSIMP_API C_STRUCT const aiImporterDesc *aiGetImporterDesc(const char *extensio
     if (nullptr == extension) {
         return nullptr;
     }
-    const aiImporterDesc *desc(nullptr);
-    std::vector<BaseImporter *> out;
-    GetImporterInstanceList(out);
-    for (size_t i = 0; i < out.size(); ++i) {
-        if (0 == strncmp(out[i]->GetInfo()->mFileExtensions, extension, strlen(extension))) {
-            desc = out[i]->GetInfo();
-            break;
+    const ImporterRegistry &registry = ImporterRegistry::Get();
+    for (size_t i = 0; i < registry.GetCount(); ++i) {
+        const aiImporterDesc *desc = registry.GetPrototype(i)->GetInfo();
+        if (0 == strncmp(desc->mFileExtensions, extension, strlen(extension))) {
+            return desc;
         }
     }
 
-    DeleteImporterInstanceList(out);
-
-    return desc;
+    return nullptr;
 }
 
 // ------------------------------------------------------------------------------------------------
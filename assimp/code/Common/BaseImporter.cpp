@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileSystemFilter.h"
 #include "Importer.h"
+#include "MeshStreamer.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/ByteSwapper.h>
 #include <assimp/ParsingUtils.h>
@@ -69,19 +70,6 @@ bool IsGcsVersion(const std::string &s) {
     });
 }
 
-// Removes a possible version hash from a filename, as found for example in
-// gcs uris (e.g. `gs://bucket/model.glb#1234`), see also
-// https://github.com/GoogleCloudPlatform/gsutil/blob/c80f329bc3c4011236c78ce8910988773b2606cb/gslib/storage_url.py#L39.
-std::string StripVersionHash(const std::string &filename) {
-    const std::string::size_type pos = filename.find_last_of('#');
-    // Only strip if the hash is behind a possible file extension and the part
-    // behind the hash is a version string.
-    if (pos != std::string::npos && pos > filename.find_last_of('.') &&
-        IsGcsVersion(filename.substr(pos + 1))) {
-        return filename.substr(0, pos);
-    }
-    return filename;
-}
 }  // namespace
 
 using namespace Assimp;
@@ -114,6 +102,8 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     if (nullptr == m_progress) {
         return nullptr;
     }
+    m_cancel = &pImp->Pimpl()->mCancel;
+    m_meshStreamer = pImp->Pimpl()->mMeshStreamer;
 
     ai_assert(m_progress);
 
@@ -139,13 +129,38 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
         m_ErrorText = err.what();
         ASSIMP_LOG_ERROR(err.what());
         m_Exception = std::current_exception();
+        m_cancel = nullptr;
+        m_meshStreamer = nullptr;
         return nullptr;
     }
 
+    m_cancel = nullptr;
+    m_meshStreamer = nullptr;
     // return what we gathered from the import.
     return sc.release();
 }
 
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::CheckCancel() const {
+    if (nullptr != m_cancel) {
+        m_cancel->Check();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::CheckCancel(size_t counter) const {
+    if (nullptr != m_cancel) {
+        m_cancel->Check(counter);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseImporter::MeshFinished(aiMesh *mesh, unsigned int meshIndex) {
+    if (nullptr != m_meshStreamer) {
+        m_meshStreamer->Push(mesh, meshIndex);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseImporter::SetupProperties(const Importer *) {
     // the default implementation does nothing
@@ -280,6 +295,21 @@ void BaseImporter::GetExtensionList(std::set<std::string> &extensions) {
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Removes a possible version hash from a filename, as found for example in
+// gcs uris (e.g. `gs://bucket/model.glb#1234`), see also
+// https://github.com/GoogleCloudPlatform/gsutil/blob/c80f329bc3c4011236c78ce8910988773b2606cb/gslib/storage_url.py#L39.
+/*static*/ std::string BaseImporter::StripVersionHash(const std::string &filename) {
+    const std::string::size_type pos = filename.find_last_of('#');
+    // Only strip if the hash is behind a possible file extension and the part
+    // behind the hash is a version string.
+    if (pos != std::string::npos && pos > filename.find_last_of('.') &&
+        IsGcsVersion(filename.substr(pos + 1))) {
+        return filename.substr(0, pos);
+    }
+    return filename;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get file extension from path
 std::string BaseImporter::GetExtension(const std::string &pFile) {
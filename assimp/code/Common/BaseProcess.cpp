@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ScenePrivate.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -53,12 +54,18 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          cancel() {
     // empty
 }
 
 // ------------------------------------------------------------------------------------------------
 void BaseProcess::ExecuteOnScene(Importer *pImp) {
+    RunOnScene(pImp, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::RunOnScene(Importer *pImp, bool meshesDone) {
     ai_assert( nullptr != pImp );
     if (pImp == nullptr) {
         return;
@@ -76,10 +83,24 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
     }
 
     SetupProperties(pImp);
+    cancel = &pImp->Pimpl()->mCancel;
+
+    // the application may have modified the scene since the last step
+    InvalidateSceneIndex(pImp->Pimpl()->mScene);
 
     // catch exceptions thrown inside the PostProcess-Step
     try {
-        Execute(pImp->Pimpl()->mScene);
+        CheckCancel();
+        if (meshesDone) {
+            ExecuteAfterMeshes(pImp->Pimpl()->mScene);
+        } else {
+            Execute(pImp->Pimpl()->mScene);
+        }
+
+        // steps may rename, add or remove elements
+        if (pImp->Pimpl()->mScene) {
+            InvalidateSceneIndex(pImp->Pimpl()->mScene);
+        }
     } catch (const std::exception &err) {
 
         // extract error description
@@ -90,6 +111,22 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
         delete pImp->Pimpl()->mScene;
         pImp->Pimpl()->mScene = nullptr;
     }
+    cancel = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsMeshLocal() const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteOnMesh(aiMesh * /*pMesh*/, unsigned int /*meshIndex*/) {
+    // only mesh-local steps are called here
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteAfterMeshes(aiScene * /*pScene*/) {
+    // the default implementation does nothing
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -44,14 +44,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_BASEPROCESS_H
 
 #include <assimp/GenericProperty.h>
+#include "Common/CancelToken.h"
 
 #include <map>
 
 struct aiScene;
+struct aiMesh;
 
 namespace Assimp {
 
 class Importer;
+class MeshStreamer;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -164,6 +167,7 @@ private:
 };
 
 #define AI_SPP_SPATIAL_SORT "$Spat"
+#define AI_SPP_VERTEX_ADJACENCY "$Adj"
 
 // ---------------------------------------------------------------------------
 /** The BaseProcess defines a common interface for all post processing steps.
@@ -177,6 +181,7 @@ private:
  */
 class ASSIMP_API BaseProcess {
     friend class Importer;
+    friend class MeshStreamer;
 
 public:
     /** @brief Constructor to be privately used by Importer */
@@ -226,6 +231,26 @@ public:
      */
     virtual void Execute(aiScene *pScene) = 0;
 
+    // -------------------------------------------------------------------
+    /** Check whether the step works on each mesh on its own, without
+     *  looking at other meshes or changing the number of meshes. Such
+     *  steps can run mesh by mesh while the import is still going on,
+     *  see #AI_CONFIG_IMPORT_MESH_STREAMING. */
+    virtual bool IsMeshLocal() const;
+
+    // -------------------------------------------------------------------
+    /** Executes a mesh-local step on a single mesh.
+     *  @param pMesh The mesh to work at.
+     *  @param meshIndex Index of the mesh in the final scene. */
+    virtual void ExecuteOnMesh(aiMesh *pMesh, unsigned int meshIndex);
+
+    // -------------------------------------------------------------------
+    /** Called instead of Execute() once all meshes went through
+     *  ExecuteOnMesh(). Handles the parts of a mesh-local step that
+     *  don't concern meshes, the default does nothing.
+     *  @param pScene The imported data to work at. */
+    virtual void ExecuteAfterMeshes(aiScene *pScene);
+
     // -------------------------------------------------------------------
     /** Assign a new SharedPostProcessInfo to the step. This object
      *  allows multiple post-process steps to share data.
@@ -242,12 +267,32 @@ public:
         return shared;
     }
 
+private:
+    // -------------------------------------------------------------------
+    /** Shared implementation of ExecuteOnScene(), runs ExecuteAfterMeshes()
+     *  instead of Execute() if the meshes were streamed. */
+    void RunOnScene(Importer *pImp, bool meshesDone);
+
 protected:
+    // -------------------------------------------------------------------
+    /** Throws if the import was cancelled or ran out of time. Steps call
+     *  this at bounded intervals, e.g. once per mesh. Does nothing if the
+     *  step wasn't started by ExecuteOnScene().
+    */
+    void CheckCancel() const {
+        if (nullptr != cancel) {
+            cancel->Check();
+        }
+    }
+
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Cancellation state of the running import, may be nullptr */
+    const CancelToken *cancel;
 };
 
 } // end of namespace Assimp
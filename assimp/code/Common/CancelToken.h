@@ -0,0 +1,126 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file CancelToken.h
+ *  @brief Cooperative cancellation of imports.
+ */
+#pragma once
+#ifndef AI_CANCELTOKEN_H_INC
+#define AI_CANCELTOKEN_H_INC
+
+#include <assimp/Exceptional.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Tells long running code that the import should stop.
+ *
+ *  The token is set either explicitly from any thread or by a deadline.
+ *  Importers and post-processing steps call Check() at bounded intervals,
+ *  which throws a DeadlyImportError so the usual error handling frees all
+ *  partially built data.
+ */
+class CancelToken {
+public:
+    /// Number of calls between two real checks in Check(counter).
+    static constexpr size_t CheckInterval = 4096;
+
+    CancelToken() :
+            mCancelled(false), mHasDeadline(false), mDeadline() {
+        // empty
+    }
+
+    /// @brief  Clears the token and starts a new time limit.
+    /// @param  timeLimit   The limit in milliseconds, 0 for none.
+    void Reset(unsigned int timeLimit) {
+        mCancelled.store(false);
+        mHasDeadline = 0 != timeLimit;
+        if (mHasDeadline) {
+            mDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeLimit);
+        }
+    }
+
+    /// @brief  Requests the import to stop, may be called from any thread.
+    void Cancel() {
+        mCancelled.store(true);
+    }
+
+    /// @brief  Returns true if the import should stop.
+    bool IsCancelled() const {
+        if (mCancelled.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        if (mHasDeadline && std::chrono::steady_clock::now() >= mDeadline) {
+            mCancelled.store(true);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief  Throws if the import should stop.
+    void Check() const {
+        if (IsCancelled()) {
+            throw DeadlyImportError("Import cancelled");
+        }
+    }
+
+    /// @brief  Throws if the import should stop, but only looks every
+    ///         CheckInterval values of a running counter.
+    void Check(size_t counter) const {
+        if (0 == counter % CheckInterval) {
+            Check();
+        }
+    }
+
+private:
+    mutable std::atomic<bool> mCancelled;
+    bool mHasDeadline;
+    std::chrono::steady_clock::time_point mDeadline;
+};
+
+} // Namespace Assimp
+
+#endif // AI_CANCELTOKEN_H_INC
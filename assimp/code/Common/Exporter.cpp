@@ -385,6 +385,11 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                 pimpl->mProgressHandler->UpdateFileWrite(1, 4);
 
                 std::unique_ptr<aiScene> scenecopy(scenecopy_tmp);
+
+                // post-processing steps expect faces owning their indices
+                for (unsigned int a = 0; a < scenecopy->mNumMeshes; ++a) {
+                    scenecopy->mMeshes[a]->ReleaseIndexBuffer();
+                }
                 const ScenePrivateData* const priv = ScenePriv(pScene);
 
                 // steps that are not idempotent, i.e. we might need to run them again, usually to get back to the
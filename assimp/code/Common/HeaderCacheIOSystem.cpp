@@ -0,0 +1,237 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file HeaderCacheIOSystem.cpp
+ *  @brief Implementation of the HeaderCacheIOSystem class.
+ */
+
+#include "Common/HeaderCacheIOSystem.h"
+
+#include <assimp/IOStream.hpp>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Stream over the cached header, opens the real file only when reading past it
+class HeaderCacheIOStream : public IOStream {
+public:
+    HeaderCacheIOStream(IOSystem *io, const std::string &file, const std::vector<uint8_t> &header, size_t fileSize) :
+            mIO(io), mFile(file), mHeader(header), mFileSize(fileSize), mPos(0), mStream(nullptr) {
+        // empty
+    }
+
+    ~HeaderCacheIOStream() override {
+        if (nullptr != mStream) {
+            mIO->Close(mStream);
+        }
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        ai_assert(nullptr != pvBuffer);
+        ai_assert(0 != pSize);
+
+        // the whole file may fit into the cache
+        size_t count = pCount;
+        if (mHeader.size() == mFileSize) {
+            count = std::min(pCount, (mFileSize - std::min(mPos, mFileSize)) / pSize);
+        }
+        if (mPos + count * pSize <= mHeader.size()) {
+            ::memcpy(pvBuffer, mHeader.data() + mPos, count * pSize);
+            mPos += count * pSize;
+            return count;
+        }
+
+        if (nullptr == mStream) {
+            mStream = mIO->Open(mFile.c_str(), "rb");
+            if (nullptr == mStream) {
+                return 0;
+            }
+        }
+        if (aiReturn_SUCCESS != mStream->Seek(mPos, aiOrigin_SET)) {
+            return 0;
+        }
+        const size_t read = mStream->Read(pvBuffer, pSize, pCount);
+        mPos += read * pSize;
+        return read;
+    }
+
+    size_t Write(const void *, size_t, size_t) override {
+        return 0;
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        size_t pos = pOffset;
+        if (aiOrigin_CUR == pOrigin) {
+            pos = mPos + pOffset;
+        } else if (aiOrigin_END == pOrigin) {
+            if (pOffset > mFileSize) {
+                return aiReturn_FAILURE;
+            }
+            pos = mFileSize - pOffset;
+        }
+        if (pos > mFileSize) {
+            return aiReturn_FAILURE;
+        }
+        mPos = pos;
+        return aiReturn_SUCCESS;
+    }
+
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    size_t FileSize() const override {
+        return mFileSize;
+    }
+
+    void Flush() override {
+        // empty
+    }
+
+private:
+    IOSystem *mIO;
+    const std::string &mFile;
+    const std::vector<uint8_t> &mHeader;
+    size_t mFileSize;
+    size_t mPos;
+    IOStream *mStream;
+};
+
+} // Namespace
+
+// ------------------------------------------------------------------------------------------------
+HeaderCacheIOSystem::HeaderCacheIOSystem(IOSystem *io, const std::string &file, size_t cacheSize) :
+        mWrapped(io), mFile(file), mHeader(), mFileSize(0), mValid(false) {
+    ai_assert(nullptr != io);
+
+    IOStream *stream = mWrapped->Open(mFile.c_str(), "rb");
+    if (nullptr == stream) {
+        return;
+    }
+
+    mFileSize = stream->FileSize();
+    mHeader.resize(std::min(mFileSize, cacheSize));
+    if (!mHeader.empty()) {
+        mHeader.resize(stream->Read(mHeader.data(), 1, mHeader.size()));
+    }
+    mWrapped->Close(stream);
+    mValid = true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::Exists(const char *pFile) const {
+    return mWrapped->Exists(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+char HeaderCacheIOSystem::getOsSeparator() const {
+    return mWrapped->getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream *HeaderCacheIOSystem::Open(const char *pFile, const char *pMode) {
+    ai_assert(nullptr != pFile);
+    ai_assert(nullptr != pMode);
+
+    // only reads of the cached file itself are served from memory
+    if (mValid && mFile == pFile && nullptr == ::strpbrk(pMode, "wa+")) {
+        return new HeaderCacheIOStream(mWrapped, mFile, mHeader, mFileSize);
+    }
+    return mWrapped->Open(pFile, pMode);
+}
+
+// ------------------------------------------------------------------------------------------------
+void HeaderCacheIOSystem::Close(IOStream *pFile) {
+    if (nullptr != dynamic_cast<HeaderCacheIOStream *>(pFile)) {
+        delete pFile;
+        return;
+    }
+    mWrapped->Close(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mWrapped->ComparePaths(one, second);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::PushDirectory(const std::string &path) {
+    return mWrapped->PushDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &HeaderCacheIOSystem::CurrentDirectory() const {
+    return mWrapped->CurrentDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t HeaderCacheIOSystem::StackSize() const {
+    return mWrapped->StackSize();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::PopDirectory() {
+    return mWrapped->PopDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::CreateDirectory(const std::string &path) {
+    return mWrapped->CreateDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::ChangeDirectory(const std::string &path) {
+    return mWrapped->ChangeDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::DeleteFile(const std::string &file) {
+    return mWrapped->DeleteFile(file);
+}
+
+} // Namespace Assimp
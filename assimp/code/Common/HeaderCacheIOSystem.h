@@ -0,0 +1,111 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file HeaderCacheIOSystem.h
+ *  @brief IOSystem wrapper which keeps the first bytes of one file in memory.
+ */
+#pragma once
+#ifndef AI_HEADERCACHEIOSYSTEM_H_INC
+#define AI_HEADERCACHEIOSYSTEM_H_INC
+
+#include <assimp/IOSystem.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Wraps an IOSystem while the importer looks for a loader.
+ *
+ *  The file to be imported is opened once, its size and first bytes are
+ *  kept. Streams opened for this file are served from the cached bytes
+ *  and only fall back to the wrapped IOSystem for reads beyond them, so
+ *  all signature checks together cost a single open. Everything else is
+ *  forwarded to the wrapped IOSystem.
+ */
+class ASSIMP_API HeaderCacheIOSystem : public IOSystem {
+public:
+    /// Default number of cached bytes
+    static const size_t DefaultCacheSize = 4096;
+
+    /// @brief  Reads the header of a file.
+    /// @param  io          The IOSystem to wrap, must outlive this instance.
+    /// @param  file        The file to cache.
+    /// @param  cacheSize   Number of bytes to keep.
+    HeaderCacheIOSystem(IOSystem *io, const std::string &file, size_t cacheSize = DefaultCacheSize);
+    ~HeaderCacheIOSystem() override = default;
+
+    /// @brief  Returns true if the cached file could be opened.
+    bool IsValid() const {
+        return mValid;
+    }
+
+    /// @brief  Returns the size of the cached file, 0 if it couldn't be opened.
+    size_t GetFileSize() const {
+        return mFileSize;
+    }
+
+    bool Exists(const char *pFile) const override;
+    char getOsSeparator() const override;
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+    void Close(IOStream *pFile) override;
+    bool ComparePaths(const char *one, const char *second) const override;
+    bool PushDirectory(const std::string &path) override;
+    const std::string &CurrentDirectory() const override;
+    size_t StackSize() const override;
+    bool PopDirectory() override;
+    bool CreateDirectory(const std::string &path) override;
+    bool ChangeDirectory(const std::string &path) override;
+    bool DeleteFile(const std::string &file) override;
+
+private:
+    IOSystem *mWrapped;
+    std::string mFile;
+    std::vector<uint8_t> mHeader;
+    size_t mFileSize;
+    bool mValid;
+};
+
+} // Namespace Assimp
+
+#endif // AI_HEADERCACHEIOSYSTEM_H_INC
@@ -63,8 +63,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Internal headers
 // ------------------------------------------------------------------------------------------------
 #include "Common/Importer.h"
+#include "Common/ImporterRegistry.h"
+#include "Common/HeaderCacheIOSystem.h"
 #include "Common/BaseProcess.h"
 #include "Common/DefaultProgressHandler.h"
+#include "Common/MeshStreamer.h"
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
@@ -78,6 +81,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Profiler.h>
 #include <assimp/commonMetaData.h>
 
+#include <algorithm>
 #include <exception>
 #include <set>
 #include <memory>
@@ -89,13 +93,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
 #   include "PostProcessing/ValidateDataStructure.h"
 #endif
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+#   include "PostProcessing/GenerateLODsProcess.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+#   include "PostProcessing/GenMeshletsProcess.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+#   include "PostProcessing/QuantizeVerticesProcess.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
+#   include "PostProcessing/ReduceKeyframesProcess.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_PACKINDICES_PROCESS
+#   include "PostProcessing/PackIndicesProcess.h"
+#endif
 
 using namespace Assimp::Profiling;
 using namespace Assimp::Formatter;
 
 namespace Assimp {
     // ImporterRegistry.cpp
-    void GetImporterInstanceList(std::vector< BaseImporter* >& out);
 	void DeleteImporterInstanceList(std::vector< BaseImporter* >& out);
 
     // PostStepRegistry.cpp
@@ -144,6 +162,37 @@ void AllocateFromAssimpHeap::operator delete[] ( void* data)    {
     return ::operator delete[](data);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the importer at an index, built-in importers are created on first use
+static BaseImporter *GetImporterInstance(ImporterPimpl *pimpl, size_t index) {
+    BaseImporter *&imp = pimpl->mImporter[index];
+    if (nullptr == imp) {
+        imp = ImporterRegistry::Get().Create(pimpl->mRegistryIndex[index]);
+    }
+    return imp;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get an importer for queries which don't touch its state, this avoids creating built-in ones
+static const BaseImporter *GetImporterForQuery(const ImporterPimpl *pimpl, size_t index) {
+    if (nullptr != pimpl->mImporter[index]) {
+        return pimpl->mImporter[index];
+    }
+    return ImporterRegistry::Get().GetPrototype(pimpl->mRegistryIndex[index]);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Collect the lower-case file extensions of the importer at an index
+static void GetImporterExtensions(const ImporterPimpl *pimpl, size_t index, std::set<std::string> &out) {
+    const size_t registryIndex = pimpl->mRegistryIndex[index];
+    if (registryIndex != ImporterRegistry::NoIndex) {
+        const std::set<std::string> &extensions = ImporterRegistry::Get().GetExtensions(registryIndex);
+        out.insert(extensions.begin(), extensions.end());
+        return;
+    }
+    pimpl->mImporter[index]->GetExtensionList(out);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Importer constructor.
 Importer::Importer()
@@ -159,7 +208,13 @@ Importer::Importer()
     pimpl->mProgressHandler = new DefaultProgressHandler();
     pimpl->mIsDefaultProgressHandler = true;
 
-    GetImporterInstanceList(pimpl->mImporter);
+    // The importers themselves are created on first use
+    const size_t numImporters = ImporterRegistry::Get().GetCount();
+    pimpl->mImporter.resize(numImporters, nullptr);
+    pimpl->mRegistryIndex.resize(numImporters);
+    for (size_t i = 0; i < numImporters; ++i) {
+        pimpl->mRegistryIndex[i] = i;
+    }
     GetPostProcessingStepInstanceList(pimpl->mPostProcessingSteps);
 
     // Allocate a SharedPostProcessInfo object and store pointers to it in all post-process steps in the list.
@@ -240,6 +295,7 @@ aiReturn Importer::RegisterLoader(BaseImporter* pImp) {
 
     // add the loader
     pimpl->mImporter.push_back(pImp);
+    pimpl->mRegistryIndex.push_back(ImporterRegistry::NoIndex);
     ASSIMP_LOG_INFO("Registering custom importer for these file extensions: ", baked);
     ASSIMP_END_EXCEPTION_REGION(aiReturn);
 
@@ -259,6 +315,7 @@ aiReturn Importer::UnregisterLoader(BaseImporter* pImp) {
         pimpl->mImporter.end(),pImp);
 
     if (it != pimpl->mImporter.end())   {
+        pimpl->mRegistryIndex.erase(pimpl->mRegistryIndex.begin() + std::distance(pimpl->mImporter.begin(), it));
         pimpl->mImporter.erase(it);
         ASSIMP_LOG_INFO("Unregistering custom importer: ");
         return AI_SUCCESS;
@@ -416,6 +473,28 @@ void Importer::SetExtraVerbose(bool bDo) {
     pimpl->bExtraVerbose = bDo;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Give all faces their own index arrays back, post-processing steps rely on owning them.
+// Meshlets and quantized vertices are dropped as well, they would be stale after any further step.
+static void ReleaseMeshBuffers(aiScene *scene) {
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        aiMesh *mesh = scene->mMeshes[i];
+        mesh->ReleaseIndexBuffer();
+        delete mesh->mMeshletData;
+        mesh->mMeshletData = nullptr;
+        delete mesh->mQuantizedVertices;
+        mesh->mQuantizedVertices = nullptr;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Abort the running import, may be called from any thread
+void Importer::Cancel() {
+    ai_assert(nullptr != pimpl);
+
+    pimpl->mCancel.Cancel();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get the current scene
 const aiScene* Importer::GetScene() const {
@@ -598,6 +677,9 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
     WriteLogOpening(pFile);
 
+    // The time limit covers loading and post-processing
+    pimpl->mCancel.Reset(static_cast<unsigned int>(GetPropertyInteger(AI_CONFIG_IMPORT_TIME_LIMIT, 0)));
+
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     try
 #endif // ! ASSIMP_CATCH_GLOBAL_EXCEPTIONS
@@ -623,41 +705,53 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             profiler->BeginRegion("total");
         }
 
+        // Open the file only once, signature checks and the size query share its first bytes
+        HeaderCacheIOSystem headerIO(pimpl->mIOHandler, pFile);
+
         // Find an worker class which can handle the file extension.
         // Multiple importers may be able to handle the same extension (.xml!); gather them all.
         SetPropertyInteger("importerIndex", -1);
         struct ImporterAndIndex {
-            BaseImporter * importer;
+            const BaseImporter * importer;
             unsigned int   index;
         };
         std::vector<ImporterAndIndex> possibleImporters;
-        for (unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
 
-            // Every importer has a list of supported extensions.
-            std::set<std::string> extensions;
-            pimpl->mImporter[a]->GetExtensionList(extensions);
+        // Built-in importers are looked up by the file extension(s), custom ones check their list.
+        std::vector<size_t> registryCandidates;
+        ImporterRegistry::Get().FindByFile(pFile, registryCandidates);
+        for (unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
+            const size_t registryIndex = pimpl->mRegistryIndex[a];
+            bool candidate = false;
+            if (registryIndex != ImporterRegistry::NoIndex) {
+                candidate = std::binary_search(registryCandidates.begin(), registryCandidates.end(), registryIndex);
+            } else {
+                std::set<std::string> extensions;
+                pimpl->mImporter[a]->GetExtensionList(extensions);
+                candidate = BaseImporter::HasExtension(pFile, extensions);
+            }
 
-            if (BaseImporter::HasExtension(pFile, extensions)) {
-                ImporterAndIndex candidate = { pimpl->mImporter[a], a };
-                possibleImporters.push_back(candidate);
+            if (candidate) {
+                ImporterAndIndex entry = { GetImporterForQuery(pimpl, a), a };
+                possibleImporters.push_back(entry);
             }
         }
 
         // If just one importer supports this extension, pick it and close the case.
         BaseImporter* imp = nullptr;
         if (1 == possibleImporters.size()) {
-            imp = possibleImporters[0].importer;
+            imp = GetImporterInstance(pimpl, possibleImporters[0].index);
             SetPropertyInteger("importerIndex", possibleImporters[0].index);
         }
         // If multiple importers claim this file extension, ask them to look at the actual file data to decide.
         // This can happen e.g. with XML (COLLADA vs. Irrlicht).
         else {
             for (std::vector<ImporterAndIndex>::const_iterator it = possibleImporters.begin(); it < possibleImporters.end(); ++it) {
-                BaseImporter & importer = *it->importer;
+                const BaseImporter & importer = *it->importer;
 
                 ASSIMP_LOG_INFO("Found a possible importer: " + std::string(importer.GetInfo()->mName) + "; trying signature-based detection");
-                if (importer.CanRead( pFile, pimpl->mIOHandler, true)) {
-                    imp = &importer;
+                if (importer.CanRead( pFile, &headerIO, true)) {
+                    imp = GetImporterInstance(pimpl, it->index);
                     SetPropertyInteger("importerIndex", it->index);
                     break;
                 }
@@ -670,8 +764,8 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             // not so bad yet ... try format auto detection.
             ASSIMP_LOG_INFO("File extension not known, trying signature-based detection");
             for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-                if( pimpl->mImporter[a]->CanRead( pFile, pimpl->mIOHandler, true)) {
-                    imp = pimpl->mImporter[a];
+                if( GetImporterForQuery(pimpl, a)->CanRead( pFile, &headerIO, true)) {
+                    imp = GetImporterInstance(pimpl, a);
                     SetPropertyInteger("importerIndex", a);
                     break;
                 }
@@ -685,13 +779,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         }
 
         // Get file size for progress handler
-        IOStream * fileIO = pimpl->mIOHandler->Open( pFile );
-        uint32_t fileSize = 0;
-        if (fileIO)
-        {
-            fileSize = static_cast<uint32_t>(fileIO->FileSize());
-            pimpl->mIOHandler->Close( fileIO );
-        }
+        const uint32_t fileSize = static_cast<uint32_t>(headerIO.GetFileSize());
 
         // Dispatch the reading to the worker class for this format
         const aiImporterDesc *desc( imp->GetInfo() );
@@ -706,6 +794,10 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             profiler->BeginRegion("import");
         }
 
+        // Importers may hand out finished meshes while they are still running
+        MeshStreamer streamer(this, pFlags);
+        pimpl->mMeshStreamer = streamer.IsActive() ? &streamer : nullptr;
+
         pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
         pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
 
@@ -747,8 +839,31 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
                 profiler->EndRegion("preprocess");
             }
 
+            // Stream the meshes the importer didn't hand out itself
+            if (streamer.IsActive()) {
+                try {
+                    streamer.Flush(pimpl->mScene);
+                } catch (const std::exception &e) {
+                    pimpl->mErrorString = e.what();
+                    ASSIMP_LOG_ERROR(pimpl->mErrorString);
+                    delete pimpl->mScene;
+                    pimpl->mScene = nullptr;
+                }
+            }
+
             // Ensure that the validation process won't be called twice
-            ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+            if (pimpl->mScene) {
+                pimpl->mInReadFile = true;
+                ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+                pimpl->mInReadFile = false;
+            }
+
+            // Without streaming the meshes are handed out once they are done
+            if (pimpl->mScene && !streamer.IsActive() && GetPropertyBool(AI_CONFIG_IMPORT_MESH_STREAMING, false)) {
+                for (unsigned int i = 0; i < pimpl->mScene->mNumMeshes; ++i) {
+                    pimpl->mProgressHandler->MeshReady(i, pimpl->mScene->mMeshes[i]);
+                }
+            }
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -756,6 +871,8 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             pimpl->mException = imp->GetException();
         }
 
+        pimpl->mMeshStreamer = nullptr;
+
         // clear any data allocated by post-process steps
         pimpl->mPPShared->Clean();
 
@@ -796,14 +913,26 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
         return nullptr;
     }
 
+    // The LOD generation, the meshlets, the quantization, the key reduction and the
+    // contiguous index buffer are not bound to a flag
+    const bool generateLods = GetPropertyInteger(AI_CONFIG_PP_LOD_LEVELS, 0) > 0;
+    const bool genMeshlets = GetPropertyBool(AI_CONFIG_PP_ML_ENABLE, false);
+    const bool quantize = GetPropertyBool(AI_CONFIG_PP_QV_ENABLE, false);
+    const bool reduceKeys = GetPropertyBool(AI_CONFIG_PP_RK_ENABLE, false);
+    const bool packIndices = GetPropertyBool(AI_CONFIG_PP_PI_ENABLE, false);
+
     // If no flags are given, return the current scene with no further action
-    if (!pFlags) {
+    if (!pFlags && !generateLods && !genMeshlets && !quantize && !reduceKeys && !packIndices) {
         return pimpl->mScene;
     }
 
     // In debug builds: run basic flag validation
     ai_assert(_ValidateFlags(pFlags));
     ASSIMP_LOG_INFO("Entering post processing pipeline");
+    if (!pimpl->mInReadFile) {
+        pimpl->mCancel.Reset(static_cast<unsigned int>(GetPropertyInteger(AI_CONFIG_IMPORT_TIME_LIMIT, 0)));
+    }
+    ReleaseMeshBuffers(pimpl->mScene);
 
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
     // The ValidateDS process plays an exceptional role. It isn't contained in the global
@@ -830,6 +959,9 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
+    // Mesh-local steps already ran on every mesh if ReadFile() streamed them
+    const bool meshesStreamed = pimpl->mInReadFile && nullptr != pimpl->mMeshStreamer;
+
     std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
@@ -839,7 +971,11 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
                 profiler->BeginRegion("postprocess");
             }
 
-            process->ExecuteOnScene ( this );
+            if (meshesStreamed && process->IsMeshLocal()) {
+                process->RunOnScene(this, true);
+            } else {
+                process->ExecuteOnScene ( this );
+            }
 
             if (profiler) {
                 profiler->EndRegion("postprocess");
@@ -864,6 +1000,40 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
 #endif  // no validation
 #endif // ! DEBUG
     }
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+    // The levels of detail are simplified from the fully processed meshes
+    if (generateLods && pimpl->mScene) {
+        GenerateLODsProcess lod;
+        lod.ExecuteOnScene(this);
+    }
+#endif
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+    // Meshlets are built from the final faces, including those of the levels of detail
+    if (genMeshlets && pimpl->mScene) {
+        GenMeshletsProcess ml;
+        ml.ExecuteOnScene(this);
+    }
+#endif
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+    if (quantize && pimpl->mScene) {
+        QuantizeVerticesProcess qv;
+        qv.ExecuteOnScene(this);
+    }
+#endif
+#ifndef ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
+    if (reduceKeys && pimpl->mScene) {
+        ReduceKeyframesProcess rk;
+        rk.ExecuteOnScene(this);
+    }
+#endif
+#ifndef ASSIMP_BUILD_NO_PACKINDICES_PROCESS
+    // Packing the indices must come last, all other steps expect faces owning their indices
+    if (packIndices && pimpl->mScene) {
+        PackIndicesProcess pi;
+        pi.ExecuteOnScene(this);
+    }
+#endif
     pimpl->mProgressHandler->UpdatePostProcess( static_cast<int>(pimpl->mPostProcessingSteps.size()),
         static_cast<int>(pimpl->mPostProcessingSteps.size()) );
 
@@ -899,6 +1069,8 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
 
     // In debug builds: run basic flag validation
     ASSIMP_LOG_INFO( "Entering customized post processing pipeline" );
+    pimpl->mCancel.Reset(static_cast<unsigned int>(GetPropertyInteger(AI_CONFIG_IMPORT_TIME_LIMIT, 0)));
+    ReleaseMeshBuffers(pimpl->mScene);
 
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
     // The ValidateDS process plays an exceptional role. It isn't contained in the global
@@ -979,7 +1151,7 @@ const aiImporterDesc* Importer::GetImporterInfo(size_t index) const {
     if (index >= pimpl->mImporter.size()) {
         return nullptr;
     }
-    return pimpl->mImporter[index]->GetInfo();
+    return GetImporterForQuery(pimpl, index)->GetInfo();
 }
 
 
@@ -990,7 +1162,7 @@ BaseImporter* Importer::GetImporter (size_t index) const {
     if (index >= pimpl->mImporter.size()) {
         return nullptr;
     }
-    return pimpl->mImporter[index];
+    return GetImporterInstance(pimpl, index);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1018,14 +1190,12 @@ size_t Importer::GetImporterIndex (const char* szExtension) const {
     }
     ext = ai_tolower(ext);
     std::set<std::string> str;
-    for (std::vector<BaseImporter*>::const_iterator i =  pimpl->mImporter.begin();i != pimpl->mImporter.end();++i)  {
+    for (size_t i = 0; i < pimpl->mImporter.size(); ++i) {
         str.clear();
 
-        (*i)->GetExtensionList(str);
-        for (std::set<std::string>::const_iterator it = str.begin(); it != str.end(); ++it) {
-            if (ext == *it) {
-                return std::distance(static_cast< std::vector<BaseImporter*>::const_iterator >(pimpl->mImporter.begin()), i);
-            }
+        GetImporterExtensions(pimpl, i, str);
+        if (str.find(ext) != str.end()) {
+            return i;
         }
     }
     ASSIMP_END_EXCEPTION_REGION(size_t);
@@ -1039,8 +1209,8 @@ void Importer::GetExtensionList(aiString& szOut) const {
 
     ASSIMP_BEGIN_EXCEPTION_REGION();
     std::set<std::string> str;
-    for (std::vector<BaseImporter*>::const_iterator i =  pimpl->mImporter.begin();i != pimpl->mImporter.end();++i)  {
-        (*i)->GetExtensionList(str);
+    for (size_t i = 0; i < pimpl->mImporter.size(); ++i) {
+        GetImporterExtensions(pimpl, i, str);
     }
 
 	// List can be empty
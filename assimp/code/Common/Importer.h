@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 #include <string>
 #include <assimp/matrix4x4.h>
+#include "Common/CancelToken.h"
 
 struct aiScene;
 
@@ -58,6 +59,7 @@ namespace Assimp {
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class MeshStreamer;
 
 
 //! @cond never
@@ -88,9 +90,14 @@ public:
     ProgressHandler* mProgressHandler;
     bool mIsDefaultProgressHandler;
 
-    /** Format-specific importer worker objects - one for each format we can read.*/
+    /** Format-specific importer worker objects - one for each format we can read.
+     *  Built-in importers are created on first use, so entries may be nullptr.*/
     std::vector< BaseImporter* > mImporter;
 
+    /** Index into the ImporterRegistry for each entry of mImporter,
+     *  ImporterRegistry::NoIndex for custom importers. */
+    std::vector< size_t > mRegistryIndex;
+
     /** Post processing steps we can apply at the imported data. */
     std::vector< BaseProcess* > mPostProcessingSteps;
 
@@ -126,6 +133,17 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Cancellation state of the running import */
+    CancelToken mCancel;
+
+    /** True while ReadFile() runs the post-processing, which then
+     *  shares the time limit of the import */
+    bool mInReadFile;
+
+    /** Streams finished meshes during ReadFile(), nullptr if meshes
+     *  aren't streamed */
+    MeshStreamer* mMeshStreamer;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -139,6 +157,7 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mProgressHandler( nullptr ),
         mIsDefaultProgressHandler( false ),
         mImporter(),
+        mRegistryIndex(),
         mPostProcessingSteps(),
         mScene( nullptr ),
         mErrorString(),
@@ -149,7 +168,10 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mCancel(),
+        mInReadFile( false ),
+        mMeshStreamer( nullptr ) {
     // empty
 }
 //! @endcond
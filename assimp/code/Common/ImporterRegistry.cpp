@@ -46,8 +46,12 @@ directly (unless you are adding new loaders), instead use the
 corresponding preprocessor flag to selectively disable formats.
 */
 
+#include "Common/ImporterRegistry.h"
+
 #include <assimp/anim.h>
 #include <assimp/BaseImporter.h>
+#include <assimp/StringUtils.h>
+#include <algorithm>
 #include <vector>
 #include <cstdlib>
 
@@ -212,7 +216,13 @@ corresponding preprocessor flag to selectively disable formats.
 namespace Assimp {
 
 // ------------------------------------------------------------------------------------------------
-void GetImporterInstanceList(std::vector<BaseImporter *> &out) {
+template <class T>
+static BaseImporter *CreateImporter() {
+    return new T();
+}
+
+// ------------------------------------------------------------------------------------------------
+static void GetImporterFactoryList(std::vector<ImporterFactory> &out) {
 
     // Some importers may be unimplemented or otherwise unsuitable for general use
     // in their current state. Devs can set ASSIMP_ENABLE_DEV_IMPORTERS in their
@@ -229,167 +239,207 @@ void GetImporterInstanceList(std::vector<BaseImporter *> &out) {
     (void)devImportersEnabled;
 
     // ----------------------------------------------------------------------------
-    // Add an instance of each worker class here
+    // Add a factory for each worker class here
     // (register_new_importers_here)
     // ----------------------------------------------------------------------------
     out.reserve(64);
 #if !defined(ASSIMP_BUILD_NO_USD_IMPORTER)
-    out.push_back(new USDImporter());
+    out.push_back(&CreateImporter<USDImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_X_IMPORTER)
-    out.push_back(new XFileImporter());
+    out.push_back(&CreateImporter<XFileImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_OBJ_IMPORTER)
-    out.push_back(new ObjFileImporter());
+    out.push_back(&CreateImporter<ObjFileImporter>);
 #endif
 #ifndef ASSIMP_BUILD_NO_AMF_IMPORTER
-    out.push_back(new AMFImporter());
+    out.push_back(&CreateImporter<AMFImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_3DS_IMPORTER)
-    out.push_back(new Discreet3DSImporter());
+    out.push_back(&CreateImporter<Discreet3DSImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_M3D_IMPORTER)
-    out.push_back(new M3DImporter());
+    out.push_back(&CreateImporter<M3DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MD3_IMPORTER)
-    out.push_back(new MD3Importer());
+    out.push_back(&CreateImporter<MD3Importer>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MD2_IMPORTER)
-    out.push_back(new MD2Importer());
+    out.push_back(&CreateImporter<MD2Importer>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_PLY_IMPORTER)
-    out.push_back(new PLYImporter());
+    out.push_back(&CreateImporter<PLYImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MDL_IMPORTER)
-    out.push_back(new MDLImporter());
+    out.push_back(&CreateImporter<MDLImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_ASE_IMPORTER)
 #if (!defined ASSIMP_BUILD_NO_3DS_IMPORTER)
-    out.push_back(new ASEImporter());
+    out.push_back(&CreateImporter<ASEImporter>);
 #endif
 #endif
 #if (!defined ASSIMP_BUILD_NO_HMP_IMPORTER)
-    out.push_back(new HMPImporter());
+    out.push_back(&CreateImporter<HMPImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_SMD_IMPORTER)
-    out.push_back(new SMDImporter());
+    out.push_back(&CreateImporter<SMDImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MDC_IMPORTER)
-    out.push_back(new MDCImporter());
+    out.push_back(&CreateImporter<MDCImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MD5_IMPORTER)
-    out.push_back(new MD5Importer());
+    out.push_back(&CreateImporter<MD5Importer>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_STL_IMPORTER)
-    out.push_back(new STLImporter());
+    out.push_back(&CreateImporter<STLImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_LWO_IMPORTER)
-    out.push_back(new LWOImporter());
+    out.push_back(&CreateImporter<LWOImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_DXF_IMPORTER)
-    out.push_back(new DXFImporter());
+    out.push_back(&CreateImporter<DXFImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_NFF_IMPORTER)
-    out.push_back(new NFFImporter());
+    out.push_back(&CreateImporter<NFFImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_RAW_IMPORTER)
-    out.push_back(new RAWImporter());
+    out.push_back(&CreateImporter<RAWImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_SIB_IMPORTER)
-    out.push_back(new SIBImporter());
+    out.push_back(&CreateImporter<SIBImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_OFF_IMPORTER)
-    out.push_back(new OFFImporter());
+    out.push_back(&CreateImporter<OFFImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_AC_IMPORTER)
-    out.push_back(new AC3DImporter());
+    out.push_back(&CreateImporter<AC3DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_BVH_IMPORTER)
-    out.push_back(new BVHLoader());
+    out.push_back(&CreateImporter<BVHLoader>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_IRRMESH_IMPORTER)
-    out.push_back(new IRRMeshImporter());
+    out.push_back(&CreateImporter<IRRMeshImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_IRR_IMPORTER)
-    out.push_back(new IRRImporter());
+    out.push_back(&CreateImporter<IRRImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_Q3D_IMPORTER)
-    out.push_back(new Q3DImporter());
+    out.push_back(&CreateImporter<Q3DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_B3D_IMPORTER)
-    out.push_back(new B3DImporter());
+    out.push_back(&CreateImporter<B3DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_COLLADA_IMPORTER)
-    out.push_back(new ColladaLoader());
+    out.push_back(&CreateImporter<ColladaLoader>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_TERRAGEN_IMPORTER)
-    out.push_back(new TerragenImporter());
+    out.push_back(&CreateImporter<TerragenImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_CSM_IMPORTER)
-    out.push_back(new CSMImporter());
+    out.push_back(&CreateImporter<CSMImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_3D_IMPORTER)
-    out.push_back(new UnrealImporter());
+    out.push_back(&CreateImporter<UnrealImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_LWS_IMPORTER)
-    out.push_back(new LWSImporter());
+    out.push_back(&CreateImporter<LWSImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_OGRE_IMPORTER)
-    out.push_back(new Ogre::OgreImporter());
+    out.push_back(&CreateImporter<Ogre::OgreImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_OPENGEX_IMPORTER)
-    out.push_back(new OpenGEX::OpenGEXImporter());
+    out.push_back(&CreateImporter<OpenGEX::OpenGEXImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_MS3D_IMPORTER)
-    out.push_back(new MS3DImporter());
+    out.push_back(&CreateImporter<MS3DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_COB_IMPORTER)
-    out.push_back(new COBImporter());
+    out.push_back(&CreateImporter<COBImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_BLEND_IMPORTER)
-    out.push_back(new BlenderImporter());
+    out.push_back(&CreateImporter<BlenderImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_Q3BSP_IMPORTER)
-    out.push_back(new Q3BSPFileImporter());
+    out.push_back(&CreateImporter<Q3BSPFileImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_NDO_IMPORTER)
-    out.push_back(new NDOImporter());
+    out.push_back(&CreateImporter<NDOImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_IFC_IMPORTER)
-    out.push_back(new IFCImporter());
+    out.push_back(&CreateImporter<IFCImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_XGL_IMPORTER)
-    out.push_back(new XGLImporter());
+    out.push_back(&CreateImporter<XGLImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_FBX_IMPORTER)
-    out.push_back(new FBXImporter());
+    out.push_back(&CreateImporter<FBXImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_ASSBIN_IMPORTER)
-    out.push_back(new AssbinImporter());
+    out.push_back(&CreateImporter<AssbinImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_GLTF_IMPORTER && !defined ASSIMP_BUILD_NO_GLTF1_IMPORTER)
-    out.push_back(new glTFImporter());
+    out.push_back(&CreateImporter<glTFImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_GLTF_IMPORTER && !defined ASSIMP_BUILD_NO_GLTF2_IMPORTER)
-    out.push_back(new glTF2Importer());
+    out.push_back(&CreateImporter<glTF2Importer>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_C4D_IMPORTER)
-    out.push_back(new C4DImporter());
+    out.push_back(&CreateImporter<C4DImporter>);
 #endif
 #if (!defined ASSIMP_BUILD_NO_3MF_IMPORTER)
-    out.push_back(new D3MFImporter());
+    out.push_back(&CreateImporter<D3MFImporter>);
 #endif
 #ifndef ASSIMP_BUILD_NO_X3D_IMPORTER
-    out.push_back(new X3DImporter());
+    out.push_back(&CreateImporter<X3DImporter>);
 #endif
 #ifndef ASSIMP_BUILD_NO_MMD_IMPORTER
-    out.push_back(new MMDImporter());
+    out.push_back(&CreateImporter<MMDImporter>);
 #endif
 #ifndef ASSIMP_BUILD_NO_IQM_IMPORTER
-    out.push_back(new IQMImporter());
+    out.push_back(&CreateImporter<IQMImporter>);
 #endif
 }
 
+// ------------------------------------------------------------------------------------------------
+ImporterRegistry::ImporterRegistry() {
+    GetImporterFactoryList(mFactories);
+
+    mPrototypes.reserve(mFactories.size());
+    mExtensions.resize(mFactories.size());
+    for (size_t i = 0; i < mFactories.size(); ++i) {
+        mPrototypes.emplace_back(mFactories[i]());
+
+        std::set<std::string> extensions;
+        mPrototypes[i]->GetExtensionList(extensions);
+        for (const std::string &ext : extensions) {
+            const std::string lower = ai_tolower(ext);
+            mExtensions[i].insert(lower);
+            mByExtension[lower].push_back(i);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const ImporterRegistry &ImporterRegistry::Get() {
+    static const ImporterRegistry registry;
+    return registry;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImporterRegistry::FindByFile(const std::string &file, std::vector<size_t> &out) const {
+    const std::string name = ai_tolower(BaseImporter::StripVersionHash(file));
+
+    // every part after a dot may be an extension, e.g. mesh.xml and xml
+    for (std::string::size_type pos = name.find('.'); pos != std::string::npos; pos = name.find('.', pos + 1)) {
+        auto it = mByExtension.find(name.substr(pos + 1));
+        if (it != mByExtension.end()) {
+            out.insert(out.end(), it->second.begin(), it->second.end());
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
 /** will delete all registered importers. */
 void DeleteImporterInstanceList(std::vector<BaseImporter *> &deleteList) {
     for (size_t i = 0; i < deleteList.size(); ++i) {
@@ -0,0 +1,116 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file ImporterRegistry.h
+ *  @brief Declares the static table of all built-in importers.
+ */
+#pragma once
+#ifndef AI_IMPORTER_REGISTRY_H_INC
+#define AI_IMPORTER_REGISTRY_H_INC
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Assimp {
+
+class BaseImporter;
+
+/// Creates a new instance of a built-in importer.
+using ImporterFactory = BaseImporter *(*)();
+
+// ---------------------------------------------------------------------------
+/** @brief Immutable table of all built-in importers.
+ *
+ *  The table is built once per process and shared by all Importer
+ *  instances, which only create the importers they actually use. It keeps a
+ *  prototype instance of each importer, which must only be used for queries
+ *  that don't touch the importer state (GetInfo(), CanRead()).
+ */
+class ImporterRegistry {
+public:
+    /// Marks an importer which is not part of the registry.
+    static constexpr size_t NoIndex = ~static_cast<size_t>(0);
+
+    /// @brief  Returns the registry, builds it on first use.
+    static const ImporterRegistry &Get();
+
+    /// @brief  Returns the number of built-in importers.
+    size_t GetCount() const {
+        return mFactories.size();
+    }
+
+    /// @brief  Creates a new instance of an importer.
+    BaseImporter *Create(size_t index) const {
+        return mFactories[index]();
+    }
+
+    /// @brief  Returns the shared prototype of an importer.
+    BaseImporter *GetPrototype(size_t index) const {
+        return mPrototypes[index].get();
+    }
+
+    /// @brief  Returns the lower-case file extensions of an importer.
+    const std::set<std::string> &GetExtensions(size_t index) const {
+        return mExtensions[index];
+    }
+
+    /// @brief  Finds all importers claiming the extension of a file.
+    /// @param  file    The file name, extensions with dots inside them
+    ///                 (e.g. mesh.xml) are recognized, too.
+    /// @param  out     Receives the importer indices in ascending order.
+    void FindByFile(const std::string &file, std::vector<size_t> &out) const;
+
+private:
+    ImporterRegistry();
+
+    std::vector<ImporterFactory> mFactories;
+    std::vector<std::unique_ptr<BaseImporter>> mPrototypes;
+    std::vector<std::set<std::string>> mExtensions;
+    std::unordered_map<std::string, std::vector<size_t>> mByExtension;
+};
+
+} // Namespace Assimp
+
+#endif // AI_IMPORTER_REGISTRY_H_INC
@@ -0,0 +1,271 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MeshDeformer.cpp
+ *  @brief Implementation of the MeshDeformer helper class.
+ */
+
+#include <assimp/MeshDeformer.h>
+#include <assimp/AnimationEvaluator.h>
+#include <assimp/ai_assert.h>
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+#include "Common/ParallelFor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+#include <unordered_map>
+
+using namespace Assimp;
+
+namespace {
+
+// number of vertices handed to a thread at once
+const size_t BlockSize = 2048;
+
+// ------------------------------------------------------------------------------------------------
+// A rigid transformation as a unit dual quaternion, rotation mReal and translation
+// 2 * mDual * conjugate(mReal).
+struct DualQuat {
+    aiQuaternion mReal;
+    aiQuaternion mDual;
+};
+
+// ------------------------------------------------------------------------------------------------
+void AddScaled(aiQuaternion &to, const aiQuaternion &q, ai_real f) {
+    to.w += q.w * f;
+    to.x += q.x * f;
+    to.y += q.y * f;
+    to.z += q.z * f;
+}
+
+// ------------------------------------------------------------------------------------------------
+DualQuat ToDualQuat(const aiMatrix4x4 &mat) {
+    aiVector3D scaling, position;
+    DualQuat dq;
+    mat.Decompose(scaling, dq.mReal, position);
+    dq.mReal.Normalize();
+    dq.mDual = aiQuaternion(0, 0, 0, 0);
+    AddScaled(dq.mDual, aiQuaternion(0, position.x, position.y, position.z) * dq.mReal, ai_real(0.5));
+    return dq;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Looks up the node of every bone with one name map, the first node of a name wins like in
+// AnimationEvaluator::FindNode()
+void ResolveBoneNodes(const aiMesh *mesh, const AnimationEvaluator &evaluator, std::vector<unsigned int> &nodes) {
+    std::unordered_map<std::string_view, unsigned int> nodesByName;
+    nodesByName.reserve(evaluator.GetNumNodes());
+    for (unsigned int i = 0; i < evaluator.GetNumNodes(); ++i) {
+        const aiString &name = evaluator.GetNode(i)->mName;
+        nodesByName.emplace(std::string_view(name.data, name.length), i);
+    }
+
+    nodes.resize(mesh->mNumBones);
+    for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+        const aiString &name = mesh->mBones[b]->mName;
+        const auto it = nodesByName.find(std::string_view(name.data, name.length));
+        nodes[b] = nodesByName.end() == it ? AnimationEvaluator::NoNode : it->second;
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+MeshDeformer::MeshDeformer(const aiMesh *pMesh, unsigned int maxInfluences) :
+        mMesh(pMesh), mNumInfluences(std::max(1u, maxInfluences)) {
+    ai_assert(nullptr != pMesh);
+
+    const unsigned int stride = mNumInfluences;
+    mBoneIndices.assign(size_t(pMesh->mNumVertices) * stride, 0);
+    mBoneWeights.assign(size_t(pMesh->mNumVertices) * stride, 0.0f);
+    for (unsigned int b = 0; b < pMesh->mNumBones; ++b) {
+        const aiBone *bone = pMesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            const aiVertexWeight &weight = bone->mWeights[w];
+            if (weight.mVertexId >= pMesh->mNumVertices || !(weight.mWeight > 0.0f)) {
+                continue;
+            }
+            // a stronger influence takes over the slot of the weakest one
+            float *weights = &mBoneWeights[size_t(weight.mVertexId) * stride];
+            const size_t weakest = std::min_element(weights, weights + stride) - weights;
+            if (weights[weakest] < weight.mWeight) {
+                weights[weakest] = weight.mWeight;
+                mBoneIndices[size_t(weight.mVertexId) * stride + weakest] = b;
+            }
+        }
+    }
+
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        float *weights = &mBoneWeights[size_t(v) * stride];
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < stride; ++i) {
+            sum += weights[i];
+        }
+        for (unsigned int i = 0; sum > 0.0f && i < stride; ++i) {
+            weights[i] /= sum;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshDeformer::BindNodes(const AnimationEvaluator &evaluator) {
+    ResolveBoneNodes(mMesh, evaluator, mBoneNodes);
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshDeformer::ComputeBoneMatrices(const AnimationEvaluator &evaluator, unsigned int meshNode, aiMatrix4x4 *out) const {
+    ai_assert(nullptr != out);
+    const aiMatrix4x4 *global = evaluator.GetGlobalTransforms();
+    aiMatrix4x4 meshInverse;
+    if (AnimationEvaluator::NoNode != meshNode) {
+        meshInverse = aiMatrix4x4(global[meshNode]).Inverse();
+    }
+
+    std::vector<unsigned int> resolved;
+    const std::vector<unsigned int> *nodes = &mBoneNodes;
+    if (mBoneNodes.size() != mMesh->mNumBones) {
+        ResolveBoneNodes(mMesh, evaluator, resolved);
+        nodes = &resolved;
+    }
+
+    for (unsigned int b = 0; b < mMesh->mNumBones; ++b) {
+        const unsigned int node = (*nodes)[b];
+        ai_assert(AnimationEvaluator::NoNode == node || node < evaluator.GetNumNodes());
+        out[b] = AnimationEvaluator::NoNode == node ? aiMatrix4x4() : meshInverse * global[node] * mMesh->mBones[b]->mOffsetMatrix;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshDeformer::Deform(const aiMatrix4x4 *boneMatrices, const float *morphWeights, Method method,
+        aiVector3D *outPositions, aiVector3D *outNormals) const {
+    ai_assert(nullptr != outPositions);
+    const aiMesh *mesh = mMesh;
+    const bool normals = nullptr != outNormals && mesh->HasNormals();
+
+    // the morph targets with an effect, a target must replace all vertices
+    std::vector<std::pair<const aiAnimMesh *, float>> targets;
+    for (unsigned int a = 0; a < mesh->mNumAnimMeshes; ++a) {
+        const aiAnimMesh *target = mesh->mAnimMeshes[a];
+        const float weight = nullptr != morphWeights ? morphWeights[a] : target->mWeight;
+        if (weight != 0.0f && target->mNumVertices == mesh->mNumVertices && (target->mVertices || (normals && target->mNormals))) {
+            targets.emplace_back(target, weight);
+        }
+    }
+
+    std::vector<DualQuat> dualQuats;
+    if (nullptr != boneMatrices && DualQuaternion == method) {
+        dualQuats.reserve(mesh->mNumBones);
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            dualQuats.push_back(ToDualQuat(boneMatrices[b]));
+        }
+    }
+
+    const unsigned int stride = mNumInfluences;
+    const size_t numBlocks = (size_t(mesh->mNumVertices) + BlockSize - 1) / BlockSize;
+    ParallelFor(numBlocks, [&](size_t block) {
+        const unsigned int end = static_cast<unsigned int>(std::min(size_t(mesh->mNumVertices), (block + 1) * BlockSize));
+        for (unsigned int v = static_cast<unsigned int>(block * BlockSize); v < end; ++v) {
+            const aiVector3D &basePos = mesh->mVertices[v];
+            aiVector3D pos = basePos, nor = normals ? mesh->mNormals[v] : aiVector3D();
+            for (const auto &target : targets) {
+                const ai_real weight = target.second;
+                if (target.first->mVertices) {
+                    pos += (target.first->mVertices[v] - basePos) * weight;
+                }
+                if (normals && target.first->mNormals) {
+                    nor += (target.first->mNormals[v] - mesh->mNormals[v]) * weight;
+                }
+            }
+
+            const unsigned int *indices = &mBoneIndices[size_t(v) * stride];
+            const float *weights = &mBoneWeights[size_t(v) * stride];
+            // the first slot is filled first, so it is empty only if all are
+            if (nullptr != boneMatrices && weights[0] > 0.0f) {
+                if (dualQuats.empty()) {
+                    // the upper three rows of the weighted sum of the bone matrices
+                    ai_real m[12] = {};
+                    for (unsigned int i = 0; i < stride; ++i) {
+                        const ai_real *bone = boneMatrices[indices[i]][0];
+                        for (unsigned int c = 0; c < 12; ++c) {
+                            m[c] += bone[c] * weights[i];
+                        }
+                    }
+                    pos = aiVector3D(m[0] * pos.x + m[1] * pos.y + m[2] * pos.z + m[3],
+                            m[4] * pos.x + m[5] * pos.y + m[6] * pos.z + m[7],
+                            m[8] * pos.x + m[9] * pos.y + m[10] * pos.z + m[11]);
+                    nor = aiVector3D(m[0] * nor.x + m[1] * nor.y + m[2] * nor.z,
+                            m[4] * nor.x + m[5] * nor.y + m[6] * nor.z,
+                            m[8] * nor.x + m[9] * nor.y + m[10] * nor.z);
+                } else {
+                    // blend in the hemisphere of the first influence
+                    DualQuat dq;
+                    dq.mReal = dq.mDual = aiQuaternion(0, 0, 0, 0);
+                    const aiQuaternion &pivot = dualQuats[indices[0]].mReal;
+                    for (unsigned int i = 0; i < stride; ++i) {
+                        const DualQuat &bone = dualQuats[indices[i]];
+                        const ai_real dot = pivot.w * bone.mReal.w + pivot.x * bone.mReal.x + pivot.y * bone.mReal.y + pivot.z * bone.mReal.z;
+                        const ai_real weight = dot < 0 ? -weights[i] : weights[i];
+                        AddScaled(dq.mReal, bone.mReal, weight);
+                        AddScaled(dq.mDual, bone.mDual, weight);
+                    }
+                    const ai_real length = std::sqrt(dq.mReal.w * dq.mReal.w + dq.mReal.x * dq.mReal.x +
+                                                     dq.mReal.y * dq.mReal.y + dq.mReal.z * dq.mReal.z);
+                    if (length > ai_real(0.0)) {
+                        // translation = 2 * dual * conjugate(real) / length^2
+                        aiQuaternion conjugate = dq.mReal;
+                        const aiQuaternion translation = dq.mDual * conjugate.Conjugate();
+                        dq.mReal.Normalize();
+                        const aiMatrix3x3 rotation = dq.mReal.GetMatrix();
+                        pos = rotation * pos + aiVector3D(translation.x, translation.y, translation.z) * (2 / (length * length));
+                        nor = rotation * nor;
+                    }
+                }
+            }
+
+            outPositions[v] = pos;
+            if (normals) {
+                outNormals[v] = nor.Normalize();
+            }
+        }
+    });
+}
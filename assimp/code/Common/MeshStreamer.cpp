@@ -0,0 +1,137 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file MeshStreamer.cpp
+ *  @brief Implementation of the MeshStreamer class.
+ */
+
+#include "Common/MeshStreamer.h"
+#include "Common/BaseProcess.h"
+#include "Common/Importer.h"
+#include "Common/ScenePreprocessor.h"
+
+#include <assimp/ProgressHandler.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+
+using namespace Assimp;
+
+// ------------------------------------------------------------------------------------------------
+MeshStreamer::MeshStreamer(Importer *pImp, unsigned int pFlags) :
+        mProgress(pImp->GetProgressHandler()), mSteps(), mPushed(), mActive(false) {
+    if (!pImp->GetPropertyBool(AI_CONFIG_IMPORT_MESH_STREAMING, false)) {
+        return;
+    }
+
+    // validation has to see the meshes before any step touched them
+    if (pFlags & aiProcess_ValidateDataStructure || pImp->Pimpl()->bExtraVerbose) {
+        ASSIMP_LOG_WARN("Mesh streaming is not available together with data structure validation");
+        return;
+    }
+
+    // these steps run after all meshes were handed out, they would change them or add new ones
+    if (pImp->GetPropertyInteger(AI_CONFIG_PP_LOD_LEVELS, 0) > 0 || pImp->GetPropertyBool(AI_CONFIG_PP_ML_ENABLE, false) ||
+            pImp->GetPropertyBool(AI_CONFIG_PP_QV_ENABLE, false) || pImp->GetPropertyBool(AI_CONFIG_PP_RK_ENABLE, false) ||
+            pImp->GetPropertyBool(AI_CONFIG_PP_PI_ENABLE, false)) {
+        ASSIMP_LOG_WARN("Mesh streaming is not available together with post-processing steps enabled by properties");
+        return;
+    }
+
+    for (BaseProcess *process : pImp->Pimpl()->mPostProcessingSteps) {
+        if (!process->IsActive(pFlags)) {
+            continue;
+        }
+        if (!process->IsMeshLocal()) {
+            ASSIMP_LOG_WARN("Mesh streaming is not available, a requested post-processing step needs the whole scene");
+            mSteps.clear();
+            return;
+        }
+        mSteps.push_back(process);
+    }
+
+    for (BaseProcess *process : mSteps) {
+        process->SetupProperties(pImp);
+        process->cancel = &pImp->Pimpl()->mCancel;
+    }
+    mActive = true;
+}
+
+// ------------------------------------------------------------------------------------------------
+MeshStreamer::~MeshStreamer() {
+    for (BaseProcess *process : mSteps) {
+        process->cancel = nullptr;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshStreamer::Push(aiMesh *mesh, unsigned int meshIndex) {
+    if (!mActive || nullptr == mesh) {
+        return;
+    }
+    if (meshIndex >= mPushed.size()) {
+        mPushed.resize(meshIndex + 1, false);
+    }
+    if (mPushed[meshIndex]) {
+        return;
+    }
+    mPushed[meshIndex] = true;
+
+    // same as the scene preprocessor does for the whole scene
+    ScenePreprocessor pre;
+    pre.ProcessMesh(mesh);
+
+    for (BaseProcess *process : mSteps) {
+        process->CheckCancel();
+        process->ExecuteOnMesh(mesh, meshIndex);
+    }
+    mProgress->MeshReady(meshIndex, mesh);
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshStreamer::Flush(aiScene *scene) {
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        Push(scene->mMeshes[i], i);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file MeshStreamer.h
+ *  @brief Runs mesh-local post-processing on single meshes during an import.
+ */
+#pragma once
+#ifndef AI_MESHSTREAMER_H_INC
+#define AI_MESHSTREAMER_H_INC
+
+#include <vector>
+
+struct aiMesh;
+struct aiScene;
+
+namespace Assimp {
+
+class Importer;
+class BaseProcess;
+class ProgressHandler;
+
+// ---------------------------------------------------------------------------
+/** @brief Hands out meshes as soon as they are final.
+ *
+ *  Importers pass each mesh they completed to Push(), which runs the
+ *  scene preprocessor and all active post-processing steps on it and then
+ *  calls ProgressHandler::MeshReady(). Flush() does the same for the meshes
+ *  the importer didn't push itself. Afterwards the importer only calls
+ *  BaseProcess::ExecuteAfterMeshes() for these steps.
+ *
+ *  Streaming is only possible if all active steps are mesh-local and none
+ *  of the steps enabled by a property is requested.
+ */
+class MeshStreamer {
+public:
+    /// @brief  Collects the active steps for an import.
+    /// @param  pImp    The importer, streaming must be enabled there.
+    /// @param  pFlags  The post-processing flags of the import.
+    MeshStreamer(Importer *pImp, unsigned int pFlags);
+    ~MeshStreamer();
+
+    /// @brief  Returns true if meshes can be streamed for this import.
+    bool IsActive() const {
+        return mActive;
+    }
+
+    /// @brief  Post-processes a finished mesh and hands it out.
+    /// @param  mesh        The mesh, the importer must not change it anymore.
+    /// @param  meshIndex   Index of the mesh in the final scene.
+    void Push(aiMesh *mesh, unsigned int meshIndex);
+
+    /// @brief  Pushes all meshes of the scene that weren't pushed yet.
+    void Flush(aiScene *scene);
+
+private:
+    ProgressHandler *mProgress;
+    std::vector<BaseProcess *> mSteps;
+    std::vector<bool> mPushed;
+    bool mActive;
+};
+
+} // Namespace Assimp
+
+#endif // AI_MESHSTREAMER_H_INC
@@ -0,0 +1,129 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ParallelFor.h
+ *  @brief Helper to spread independent work items over a few threads.
+ */
+#pragma once
+#ifndef AI_PARALLELFOR_H_INC
+#define AI_PARALLELFOR_H_INC
+
+#include <assimp/defs.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#   include <atomic>
+#   include <mutex>
+#   include <thread>
+#endif
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+/** Calls func(i) for every i in [0, count).
+ *
+ *  The indices are handed out to up to std::thread::hardware_concurrency()
+ *  threads, the calling thread included, so the calls must not depend on
+ *  each other. If calls throw, the exception of the lowest index is rethrown
+ *  on the calling thread after all workers are done, which keeps error
+ *  reports independent of the scheduling. Less than minCount items, or a
+ *  build with ASSIMP_BUILD_SINGLETHREADED, run serially in index order.
+ */
+template <typename Func>
+inline void ParallelFor(size_t count, Func func, size_t minCount = 2) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    const size_t numThreads = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+    if (count >= minCount && numThreads > 1) {
+        std::atomic<size_t> next(0);
+        std::mutex errorLock;
+        std::exception_ptr error;
+        size_t errorIndex = count;
+
+        auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++) {
+                try {
+                    func(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorLock);
+                    if (i < errorIndex) {
+                        errorIndex = i;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        for (size_t t = 1; t < numThreads; ++t) {
+            try {
+                threads.emplace_back(worker);
+            } catch (...) {
+                // out of threads, the remaining ones take over the work
+                break;
+            }
+        }
+        worker();
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return;
+    }
+#else
+    (void)minCount;
+#endif
+
+    for (size_t i = 0; i < count; ++i) {
+        func(i);
+    }
+}
+
+} // namespace Assimp
+
+#endif // AI_PARALLELFOR_H_INC
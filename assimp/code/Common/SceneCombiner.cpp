@@ -1101,6 +1101,32 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     // make a deep copy of all faces
     GetArrayCopy(dest->mFaces, dest->mNumFaces);
 
+    // and let them point into the copy of the index buffer
+    if (src->HasIndexBuffer()) {
+        GetArrayCopy(dest->mIndices, dest->mNumIndices);
+        GetArrayCopy(dest->mIndices16, dest->mNumIndices);
+        const unsigned int *end = src->mIndices + src->mNumIndices;
+        for (unsigned int i = 0; i < dest->mNumFaces; ++i) {
+            const aiFace &srcFace = src->mFaces[i];
+            if (srcFace.mIndices >= src->mIndices && srcFace.mIndices < end) {
+                delete[] dest->mFaces[i].mIndices;
+                dest->mFaces[i].mIndices = dest->mIndices + (srcFace.mIndices - src->mIndices);
+            }
+        }
+    } else {
+        dest->mIndices = nullptr;
+        dest->mIndices16 = nullptr;
+        dest->mNumIndices = 0;
+    }
+
+    // make a deep copy of the meshlets
+    if (src->mMeshletData != nullptr) {
+        dest->mMeshletData = new aiMeshletData(*src->mMeshletData);
+    }
+    if (src->mQuantizedVertices != nullptr) {
+        dest->mQuantizedVertices = new aiQuantizedVertices(*src->mQuantizedVertices);
+    }
+
     // make a deep copy of all blend shapes
     CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
 
@@ -0,0 +1,149 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SceneIndex.h
+ *  @brief Hash lookup of nodes, bones and animation channels by name.
+ */
+#pragma once
+#ifndef AI_SCENEINDEX_H_INC
+#define AI_SCENEINDEX_H_INC
+
+#include <assimp/ai_assert.h>
+#include <assimp/scene.h>
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** Maps names to the nodes, bones and node animation channels of a scene.
+ *
+ *  Lookups return the same element as the corresponding linear search,
+ *  i.e. aiNode::FindNode() for nodes: the first node in depth-first
+ *  pre-order, the first bone in mesh order and the first channel of an
+ *  animation. The index refers to the names stored in the scene, so it must
+ *  be dropped whenever elements are renamed, added or removed. Use
+ *  GetSceneIndex() to get the lazily built index owned by a scene.
+ */
+class SceneIndex {
+public:
+    /** Each of the three maps is built on its first lookup, so a scene which is
+     *  only partially valid (i.e. during a post-processing step) can still be
+     *  searched for the parts which are. */
+    explicit SceneIndex(const aiScene *scene) :
+            mScene(scene) {
+        ai_assert(nullptr != scene);
+    }
+
+    /** Returns the node of the given name or nullptr */
+    aiNode *FindNode(const aiString &name) {
+        if (!mHasNodes) {
+            if (mScene->mRootNode) {
+                AddNode(mScene->mRootNode);
+            }
+            mHasNodes = true;
+        }
+        return Find(mNodes, name);
+    }
+
+    /** Returns the bone of the given name or nullptr */
+    aiBone *FindBone(const aiString &name) {
+        if (!mHasBones) {
+            for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+                const aiMesh *mesh = mScene->mMeshes[i];
+                for (unsigned int a = 0; a < mesh->mNumBones; ++a) {
+                    mBones.emplace(Key(mesh->mBones[a]->mName), mesh->mBones[a]);
+                }
+            }
+            mHasBones = true;
+        }
+        return Find(mBones, name);
+    }
+
+    /** Returns the channel of an animation animating the given node or nullptr */
+    aiNodeAnim *FindNodeAnim(unsigned int animation, const aiString &nodeName) {
+        if (mChannels.empty() && mScene->mNumAnimations) {
+            mChannels.resize(mScene->mNumAnimations);
+            for (unsigned int i = 0; i < mScene->mNumAnimations; ++i) {
+                const aiAnimation *anim = mScene->mAnimations[i];
+                for (unsigned int a = 0; a < anim->mNumChannels; ++a) {
+                    mChannels[i].emplace(Key(anim->mChannels[a]->mNodeName), anim->mChannels[a]);
+                }
+            }
+        }
+        return animation < mChannels.size() ? Find(mChannels[animation], nodeName) : nullptr;
+    }
+
+private:
+    template <typename T>
+    using Map = std::unordered_map<std::string_view, T *>;
+
+    // names compare like strcmp() in aiNode::FindNode(), up to the first zero
+    static std::string_view Key(const aiString &name) {
+        return std::string_view(name.data);
+    }
+
+    template <typename T>
+    static T *Find(const Map<T> &map, const aiString &name) {
+        const auto it = map.find(Key(name));
+        return it == map.end() ? nullptr : it->second;
+    }
+
+    void AddNode(aiNode *node) {
+        mNodes.emplace(Key(node->mName), node);
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            AddNode(node->mChildren[i]);
+        }
+    }
+
+    const aiScene *mScene;
+    bool mHasNodes = false;
+    bool mHasBones = false;
+    Map<aiNode> mNodes;
+    Map<aiBone> mBones;
+    std::vector<Map<aiNodeAnim>> mChannels;
+};
+
+} // namespace Assimp
+
+#endif // AI_SCENEINDEX_H_INC
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "ScenePreprocessor.h"
+#include "ScenePrivate.h"
 #include <assimp/ai_assert.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -49,6 +50,7 @@ using namespace Assimp;
 // ---------------------------------------------------------------------------------------------
 void ScenePreprocessor::ProcessScene() {
     ai_assert(scene != nullptr);
+    InvalidateSceneIndex(scene);
 
     // Process all meshes
     for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
@@ -211,7 +213,7 @@ void ScenePreprocessor::ProcessAnimation(aiAnimation *anim) {
         // matrix of the corresponding node.
         if (!channel->mNumRotationKeys || !channel->mNumPositionKeys || !channel->mNumScalingKeys) {
             // Find the node that belongs to this animation
-            aiNode *node = scene->mRootNode->FindNode(channel->mNodeName);
+            aiNode *node = GetSceneIndex(scene).FindNode(channel->mNodeName);
             if (node) // ValidateDS will complain later if 'node' is nullptr
             {
                 // Decompose the transformation matrix of the node
@@ -97,6 +97,12 @@ public:
      */
     void ProcessScene();
 
+    // ----------------------------------------------------------------
+    /** Preprocess a single mesh, the scene need not be set.
+     *  @param mesh Mesh to be preprocessed.
+     */
+    void ProcessMesh(aiMesh *mesh);
+
 protected:
     // ----------------------------------------------------------------
     /** Preprocess an animation in the scene
@@ -104,12 +110,6 @@ protected:
      */
     void ProcessAnimation(aiAnimation *anim);
 
-    // ----------------------------------------------------------------
-    /** Preprocess a mesh in the scene
-     *  @param mesh Mesh to be preprocessed.
-     */
-    void ProcessMesh(aiMesh *mesh);
-
 protected:
     //! Scene we're currently working on
     aiScene *scene;
@@ -47,6 +47,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/ai_assert.h>
 #include <assimp/scene.h>
+#include "Common/SceneIndex.h"
+
+#include <memory>
 
 namespace Assimp {
 
@@ -70,6 +73,10 @@ struct ScenePrivateData {
     // and mOrigImporter are no longer safe to rely on and only
     // serve informative purposes.
     bool mIsCopy;
+
+    // Name lookup of nodes, bones and channels, built on first use by
+    // GetSceneIndex() and dropped by every post-processing step.
+    std::unique_ptr<SceneIndex> mIndex;
 };
 
 inline
@@ -99,6 +106,27 @@ const ScenePrivateData* ScenePriv(const aiScene* in) {
     return static_cast<const ScenePrivateData*>(in->mPrivate);
 }
 
+// Get the name index of a scene, it is built on first use
+inline
+SceneIndex& GetSceneIndex(aiScene* in) {
+    ScenePrivateData* priv = ScenePriv(in);
+    ai_assert( nullptr != priv );
+    if ( !priv->mIndex ) {
+        priv->mIndex.reset( new SceneIndex( in ) );
+    }
+    return *priv->mIndex;
+}
+
+// Drop the name index of a scene after its node graph, bones or animations
+// have been modified
+inline
+void InvalidateSceneIndex(aiScene* in) {
+    ScenePrivateData* priv = ScenePriv(in);
+    if ( nullptr != priv ) {
+        priv->mIndex.reset();
+    }
+}
+
 } // Namespace Assimp
 
 #endif // AI_SCENEPRIVATE_H_INCLUDED
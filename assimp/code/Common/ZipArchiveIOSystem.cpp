@@ -48,6 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/ai_assert.h>
 
+#include "Common/ParallelFor.h"
+
+#include <climits>
 #include <map>
 #include <memory>
 
@@ -65,6 +68,7 @@ namespace Assimp {
 class ZipFile final : public IOStream {
     friend class ZipFileInfo;
     explicit ZipFile(std::string &filename, size_t size);
+    explicit ZipFile(std::string &filename, size_t size, std::unique_ptr<uint8_t[]> buffer);
 
 public:
     std::string m_Filename;
@@ -226,20 +230,39 @@ zlib_filefunc_def IOSystem2Unzip::get(IOSystem *pIOHandler) {
 // Info about a read-only file inside a ZIP
 class ZipFileInfo final {
 public:
-    explicit ZipFileInfo(unzFile zip_handle, size_t size);
+    explicit ZipFileInfo(unzFile zip_handle, const unz_file_info &file_info);
+    ZipFileInfo(ZipFileInfo &&) = default;
     ~ZipFileInfo() = default;
 
     // Allocate and Extract data from the ZIP
-    ZipFile *Extract(std::string &filename, unzFile zip_handle) const;
+    ZipFile *Extract(std::string &filename, unzFile zip_handle);
+
+    // Read the data as stored in the ZIP, without inflating it
+    std::unique_ptr<uint8_t[]> ReadRaw(unzFile zip_handle) const;
+
+    // Inflate data returned by ReadRaw and keep it for the next Extract.
+    // Touches no shared state, so it may run on any thread.
+    void Prefetch(std::unique_ptr<uint8_t[]> raw);
+
+    bool IsPrefetched() const { return m_Prefetched != nullptr; }
 
 private:
     size_t m_Size = 0;
+    size_t m_CompressedSize = 0;
+    uLong m_Crc = 0;
+    uLong m_Method = 0;
+    bool m_Encrypted = false;
     unz_file_pos_s m_ZipFilePos;
+    std::unique_ptr<uint8_t[]> m_Prefetched;
 };
 
 // ----------------------------------------------------------------
-ZipFileInfo::ZipFileInfo(unzFile zip_handle, size_t size) :
-        m_Size(size) {
+ZipFileInfo::ZipFileInfo(unzFile zip_handle, const unz_file_info &file_info) :
+        m_Size(file_info.uncompressed_size),
+        m_CompressedSize(file_info.compressed_size),
+        m_Crc(file_info.crc),
+        m_Method(file_info.compression_method),
+        m_Encrypted((file_info.flag & 1) != 0) {
     ai_assert(m_Size != 0);
     // Workaround for MSVC 2013 - C2797
     m_ZipFilePos.num_of_file = 0;
@@ -248,7 +271,12 @@ ZipFileInfo::ZipFileInfo(unzFile zip_handle, size_t size) :
 }
 
 // ----------------------------------------------------------------
-ZipFile *ZipFileInfo::Extract(std::string &filename, unzFile zip_handle) const {
+ZipFile *ZipFileInfo::Extract(std::string &filename, unzFile zip_handle) {
+    // Hand over the prefetched data, if any
+    if (m_Prefetched != nullptr) {
+        return new ZipFile(filename, m_Size, std::move(m_Prefetched));
+    }
+
     // Find in the ZIP. This cannot fail
     unz_file_pos_s *filepos = const_cast<unz_file_pos_s *>(&(m_ZipFilePos));
     if (unzGoToFilePos(zip_handle, filepos) != UNZ_OK)
@@ -259,34 +287,91 @@ ZipFile *ZipFileInfo::Extract(std::string &filename, unzFile zip_handle) const {
 
     ZipFile *zip_file = new ZipFile(filename, m_Size);
 
-    // Unzip has a limit of UINT16_MAX bytes buffer
-    uint16_t unzipBufferSize = zip_file->m_Size <= UINT16_MAX ? static_cast<uint16_t>(zip_file->m_Size) : UINT16_MAX;
-    std::unique_ptr<uint8_t[]> unzipBuffer = std::unique_ptr<uint8_t[]>(new uint8_t[unzipBufferSize]);
+    // Inflate straight into the file buffer, as much as unzip accepts per call
     size_t readCount = 0;
-    while (readCount < zip_file->m_Size)
-    {
-        size_t bufferSize = zip_file->m_Size - readCount;
-        if (bufferSize > UINT16_MAX) {
-            bufferSize = UINT16_MAX;
-        }
-
-        int ret = unzReadCurrentFile(zip_handle, unzipBuffer.get(), static_cast<unsigned int>(bufferSize));
-        if (ret != static_cast<int>(bufferSize))
-        {
+    while (readCount < zip_file->m_Size) {
+        const size_t bufferSize = std::min<size_t>(zip_file->m_Size - readCount, INT_MAX);
+        int ret = unzReadCurrentFile(zip_handle, zip_file->m_Buffer.get() + readCount, static_cast<unsigned int>(bufferSize));
+        if (ret != static_cast<int>(bufferSize)) {
             // Failed, release the memory
             delete zip_file;
             zip_file = nullptr;
             break;
         }
 
-        std::memcpy(zip_file->m_Buffer.get() + readCount, unzipBuffer.get(), ret);
         readCount += ret;
     }
 
-    ai_assert(unzCloseCurrentFile(zip_handle) == UNZ_OK);
+    const int closeResult = unzCloseCurrentFile(zip_handle);
+    ai_assert(closeResult == UNZ_OK);
+    (void)closeResult;
     return zip_file;
 }
 
+// ----------------------------------------------------------------
+std::unique_ptr<uint8_t[]> ZipFileInfo::ReadRaw(unzFile zip_handle) const {
+    // Only plain stored and deflated entries can be inflated without unzip
+    if (m_Encrypted || (m_Method != 0 && m_Method != Z_DEFLATED) || m_CompressedSize == 0 ||
+            m_CompressedSize > UINT_MAX || m_Size > UINT_MAX) {
+        return nullptr;
+    }
+
+    unz_file_pos_s *filepos = const_cast<unz_file_pos_s *>(&(m_ZipFilePos));
+    if (unzGoToFilePos(zip_handle, filepos) != UNZ_OK)
+        return nullptr;
+
+    int method = 0;
+    if (unzOpenCurrentFile2(zip_handle, &method, nullptr, 1) != UNZ_OK)
+        return nullptr;
+
+    std::unique_ptr<uint8_t[]> raw(new uint8_t[m_CompressedSize]);
+    const int ret = unzReadCurrentFile(zip_handle, raw.get(), static_cast<unsigned int>(m_CompressedSize));
+    unzCloseCurrentFile(zip_handle);
+    if (ret != static_cast<int>(m_CompressedSize)) {
+        return nullptr;
+    }
+
+    return raw;
+}
+
+// ----------------------------------------------------------------
+void ZipFileInfo::Prefetch(std::unique_ptr<uint8_t[]> raw) {
+    ai_assert(raw != nullptr);
+
+    std::unique_ptr<uint8_t[]> data;
+    if (m_Method == 0) {
+        // Stored entries are used as they are, unless the header sizes disagree
+        if (m_CompressedSize != m_Size) {
+            return;
+        }
+        data = std::move(raw);
+    } else {
+        data.reset(new uint8_t[m_Size]);
+
+        // Raw deflate stream, inflated in one call into the final buffer
+        z_stream stream = {};
+        if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+            return;
+        }
+        stream.next_in = raw.get();
+        stream.avail_in = static_cast<uInt>(m_CompressedSize);
+        stream.next_out = data.get();
+        stream.avail_out = static_cast<uInt>(m_Size);
+        const int ret = inflate(&stream, Z_FINISH);
+        inflateEnd(&stream);
+        if (ret != Z_STREAM_END || stream.total_out != m_Size) {
+            return;
+        }
+    }
+
+    // Corrupted entries are left to Extract, which reports them as usual
+    if (crc32(0L, data.get(), static_cast<uInt>(m_Size)) != m_Crc) {
+        return;
+    }
+
+    m_Prefetched = std::move(data);
+}
+
 // ----------------------------------------------------------------
 ZipFile::ZipFile(std::string &filename, size_t size) :
         m_Filename(filename), m_Size(size) {
@@ -294,6 +379,13 @@ ZipFile::ZipFile(std::string &filename, size_t size) :
     m_Buffer = std::unique_ptr<uint8_t[]>(new uint8_t[m_Size]);
 }
 
+// ----------------------------------------------------------------
+ZipFile::ZipFile(std::string &filename, size_t size, std::unique_ptr<uint8_t[]> buffer) :
+        m_Filename(filename), m_Size(size), m_Buffer(std::move(buffer)) {
+    ai_assert(m_Size != 0);
+    ai_assert(m_Buffer != nullptr);
+}
+
 // ----------------------------------------------------------------
 size_t ZipFile::Read(void *pvBuffer, size_t pSize, size_t pCount) {
     // Should be impossible
@@ -369,6 +461,7 @@ public:
     void getFileListExtension(std::vector<std::string> &rFileList, const std::string &extension);
     bool Exists(std::string &filename);
     IOStream *OpenFile(std::string &filename);
+    void prefetchFiles(const std::vector<std::string> &rFileList);
 
     static void SimplifyFilename(std::string &filename);
 
@@ -422,7 +515,7 @@ void ZipArchiveIOSystem::Implement::MapArchive() {
             if (fileInfo.uncompressed_size != 0 && fileInfo.size_filename <= FileNameSize) {
                 std::string filename_string(filename, fileInfo.size_filename);
                 SimplifyFilename(filename_string);
-                m_ArchiveMap.emplace(filename_string, ZipFileInfo(m_ZipFileHandle, fileInfo.uncompressed_size));
+                m_ArchiveMap.emplace(filename_string, ZipFileInfo(m_ZipFileHandle, fileInfo));
             }
         }
     } while (unzGoToNextFile(m_ZipFileHandle) != UNZ_END_OF_LIST_OF_FILE);
@@ -469,14 +562,37 @@ IOStream *ZipArchiveIOSystem::Implement::OpenFile(std::string &filename) {
     SimplifyFilename(filename);
 
     // Find in the map
-    ZipFileInfoMap::const_iterator zip_it = m_ArchiveMap.find(filename);
-    if (zip_it == m_ArchiveMap.cend())
+    ZipFileInfoMap::iterator zip_it = m_ArchiveMap.find(filename);
+    if (zip_it == m_ArchiveMap.end())
         return nullptr;
 
-    const ZipFileInfo &zip_file = (*zip_it).second;
+    ZipFileInfo &zip_file = (*zip_it).second;
     return zip_file.Extract(filename, m_ZipFileHandle);
 }
 
+// ----------------------------------------------------------------
+void ZipArchiveIOSystem::Implement::prefetchFiles(const std::vector<std::string> &rFileList) {
+    MapArchive();
+
+    // Reading from the archive stays serial, only inflating is spread over threads
+    std::vector<std::pair<ZipFileInfo *, std::unique_ptr<uint8_t[]>>> jobs;
+    for (std::string filename : rFileList) {
+        SimplifyFilename(filename);
+        ZipFileInfoMap::iterator zip_it = m_ArchiveMap.find(filename);
+        if (zip_it == m_ArchiveMap.end() || zip_it->second.IsPrefetched())
+            continue;
+
+        std::unique_ptr<uint8_t[]> raw = zip_it->second.ReadRaw(m_ZipFileHandle);
+        if (raw != nullptr) {
+            jobs.emplace_back(&zip_it->second, std::move(raw));
+        }
+    }
+
+    ParallelFor(jobs.size(), [&jobs](size_t i) {
+        jobs[i].first->Prefetch(std::move(jobs[i].second));
+    });
+}
+
 // ----------------------------------------------------------------
 inline void ReplaceAll(std::string &data, const std::string &before, const std::string &after) {
     size_t pos = data.find(before);
@@ -584,6 +700,11 @@ void ZipArchiveIOSystem::getFileList(std::vector<std::string> &rFileList) const
     return pImpl->getFileList(rFileList);
 }
 
+// ----------------------------------------------------------------
+void ZipArchiveIOSystem::prefetchFiles(const std::vector<std::string> &rFileList) {
+    pImpl->prefetchFiles(rFileList);
+}
+
 // ----------------------------------------------------------------
 void ZipArchiveIOSystem::getFileListExtension(std::vector<std::string> &rFileList, const std::string &extension) const {
     return pImpl->getFileListExtension(rFileList, extension);
@@ -2,7 +2,7 @@
 #define INCLUDED_ASSBIN_CHUNKS_H
 
 #define ASSBIN_VERSION_MAJOR 1
-#define ASSBIN_VERSION_MINOR 0
+#define ASSBIN_VERSION_MINOR 1
 
 /**
 @page assfile .ASS File formats
@@ -72,7 +72,8 @@ byte[44]    Magic identification string for ASSBIN files.
 
 integer     Major version of the Assimp library which wrote the file
 integer     Minor version of the Assimp library which wrote the file
-                match these against ASSBIN_VERSION_MAJOR and ASSBIN_VERSION_MINOR
+                match these against ASSBIN_VERSION_MAJOR and ASSBIN_VERSION_MINOR,
+                minor version 1 added chunked compression
 
 integer     SVN revision of the Assimp library (intended for our internal
             debugging - if you write Ass files from your own APPs, set this value to 0.
@@ -82,10 +83,18 @@ short       0 for normal files, 1 for shortened dumps for regression tests
                 these should have the file extension assbin.regress
 
 short       1 if the data after the header is compressed with the DEFLATE algorithm,
-            0 for uncompressed files.
+            2 if it is compressed in independent DEFLATE chunks (minor version 1),
+            0 for uncompressed files. Other values are rejected.
                    For compressed files, the first integer after the header is
                    always the uncompressed data size
 
+                   Chunked files continue with
+                   integer      number of chunks n
+                   integer[2n]  compressed and uncompressed size of each chunk
+                   byte[]       the zlib streams of all chunks, back to back
+                   Every chunk but the last holds ASSBIN_COMPRESSED_CHUNK_SIZE
+                   bytes of uncompressed data.
+
 byte[256]   Zero-terminated source file name, UTF-8
 byte[128]   Zero-terminated command line parameters passed to assimp_cmd, UTF-8
 
@@ -164,12 +173,38 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 
    - mNumAllocated is omitted, for obvious reasons :-)
 
+-------------------------------------------------------------------------------
+4. Mappable files:
+-------------------------------------------------------------------------------
+
+Files written with AI_CONFIG_EXPORT_ASSBIN_MAPPABLE store major version
+AI_ASSBIN_MAPPED_VERSION_MAJOR in the header and are never compressed. The
+meshes are not part of the chunk stream, the header is followed by:
+
+AssbinMappedHeader      at offset 512, see <assimp/AssbinMappedView.h>
+AssbinMappedMesh[n]     mesh table, one record per aiScene::mMeshes entry
+byte[]                  mesh arrays, each starting at a multiple of 64 bytes
+                            in the in-memory layout of aiMesh, faces are
+                            stored as integer[mNumFaces+1] offsets into one
+                            integer[] index buffer
+ASSBIN_CHUNK_AISCENE    the scene chunk without the ASSBIN_CHUNK_AIMESH
+                            subchunks
+
+All offsets are 64 bit file offsets, 0 denotes an absent array. Floats use
+the precision of the writer (ai_real), a reader of a different precision
+rejects the file.
+
 
  @endverbatim*/
 
 
 #define ASSBIN_HEADER_LENGTH 512
 
+#define ASSBIN_COMPRESSION_NONE                 0
+#define ASSBIN_COMPRESSION_ZLIB                 1
+#define ASSBIN_COMPRESSION_ZLIB_CHUNKED         2
+#define ASSBIN_COMPRESSED_CHUNK_SIZE            (1u << 20)
+
 // these are the magic chunk identifiers for the binary ASS file format
 #define ASSBIN_CHUNK_AICAMERA                   0x1234
 #define ASSBIN_CHUNK_AILIGHT                    0x1235
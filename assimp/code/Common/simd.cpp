@@ -40,6 +40,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "simd.h"
 
+#include <assimp/types.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if !defined(ASSIMP_DOUBLE_PRECISION) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#   define AI_SIMD_SSE2
+#   include <emmintrin.h>
+#endif
+
 namespace Assimp {
 
 bool CPUSupportsSSE2() {
@@ -73,5 +83,207 @@ bool CPUSupportsSSE2() {
 #endif
 }
 
+#ifdef AI_SIMD_SSE2
+
+namespace {
+
+static_assert(sizeof(aiVector3D) == 3 * sizeof(float), "aiVector3D must be three packed floats");
+
+// The kernels handle blocks of four vectors, which are three registers in
+// aos layout: r0 = x0 y0 z0 x1, r1 = y1 z1 x2 y2, r2 = z2 x3 y3 z3.
+
+// ------------------------------------------------------------------------------------------------
+bool UseSSE2() {
+    static const bool supported = CPUSupportsSSE2();
+    return supported;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void LoadSoA(const aiVector3D *in, __m128 &x, __m128 &y, __m128 &z) {
+    const float *src = &in->x;
+    const __m128 r0 = _mm_loadu_ps(src);
+    const __m128 r1 = _mm_loadu_ps(src + 4);
+    const __m128 r2 = _mm_loadu_ps(src + 8);
+
+    const __m128 x23 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(1, 1, 2, 2));
+    x = _mm_shuffle_ps(r0, x23, _MM_SHUFFLE(2, 0, 3, 0));
+    const __m128 y01 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(0, 0, 1, 1));
+    const __m128 y23 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(2, 2, 3, 3));
+    y = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 z01 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(1, 1, 2, 2));
+    z = _mm_shuffle_ps(z01, r2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void StoreSoA(aiVector3D *out, __m128 x, __m128 y, __m128 z) {
+    float *dst = &out->x;
+    const __m128 a0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 b0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+    _mm_storeu_ps(dst, _mm_shuffle_ps(a0, b0, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128 a1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 b1 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+    _mm_storeu_ps(dst + 4, _mm_shuffle_ps(a1, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128 a2 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+    const __m128 b2 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+    _mm_storeu_ps(dst + 8, _mm_shuffle_ps(a2, b2, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Same evaluation order as the scalar operator: a1 * x + a2 * y + a3 * z
+inline __m128 Dot3(float a1, float a2, float a3, __m128 x, __m128 y, __m128 z) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a1), x), _mm_mul_ps(_mm_set1_ps(a2), y)),
+            _mm_mul_ps(_mm_set1_ps(a3), z));
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t TransformPointsSSE2(const aiMatrix4x4 &mat, const aiVector3D *in, aiVector3D *out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadSoA(in + i, x, y, z);
+        StoreSoA(out + i,
+                _mm_add_ps(Dot3(mat.a1, mat.a2, mat.a3, x, y, z), _mm_set1_ps(mat.a4)),
+                _mm_add_ps(Dot3(mat.b1, mat.b2, mat.b3, x, y, z), _mm_set1_ps(mat.b4)),
+                _mm_add_ps(Dot3(mat.c1, mat.c2, mat.c3, x, y, z), _mm_set1_ps(mat.c4)));
+    }
+    return i;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t TransformDirectionsSSE2(const aiMatrix3x3 &mat, const aiVector3D *in, aiVector3D *out, size_t count) {
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadSoA(in + i, x, y, z);
+        const __m128 tx = Dot3(mat.a1, mat.a2, mat.a3, x, y, z);
+        const __m128 ty = Dot3(mat.b1, mat.b2, mat.b3, x, y, z);
+        const __m128 tz = Dot3(mat.c1, mat.c2, mat.c3, x, y, z);
+
+        // zero length vectors are kept as they are, like aiVector3D::Normalize() does
+        const __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, tx), _mm_mul_ps(ty, ty)), _mm_mul_ps(tz, tz)));
+        const __m128 isZero = _mm_cmpeq_ps(len, zero);
+        const __m128 inv = _mm_or_ps(_mm_and_ps(isZero, one), _mm_andnot_ps(isZero, _mm_div_ps(one, len)));
+        StoreSoA(out + i, _mm_mul_ps(tx, inv), _mm_mul_ps(ty, inv), _mm_mul_ps(tz, inv));
+    }
+    return i;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t ScaleVectorsSSE2(aiVector3D *vecs, size_t count, const aiVector3D &factor) {
+    const __m128 f0 = _mm_setr_ps(factor.x, factor.y, factor.z, factor.x);
+    const __m128 f1 = _mm_setr_ps(factor.y, factor.z, factor.x, factor.y);
+    const __m128 f2 = _mm_setr_ps(factor.z, factor.x, factor.y, factor.z);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float *data = &vecs[i].x;
+        _mm_storeu_ps(data, _mm_mul_ps(_mm_loadu_ps(data), f0));
+        _mm_storeu_ps(data + 4, _mm_mul_ps(_mm_loadu_ps(data + 4), f1));
+        _mm_storeu_ps(data + 8, _mm_mul_ps(_mm_loadu_ps(data + 8), f2));
+    }
+    return i;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MinMaxVectorsSSE2(const aiVector3D *vecs, size_t count, aiVector3D &min, aiVector3D &max) {
+    if (count < 4) {
+        return 0;
+    }
+
+    // the lanes of the three accumulators hold fixed components, see above.
+    // _mm_min_ps returns its second operand if either one is NaN, which
+    // keeps the accumulated value.
+    __m128 min0 = _mm_setr_ps(min.x, min.y, min.z, min.x), max0 = _mm_setr_ps(max.x, max.y, max.z, max.x);
+    __m128 min1 = _mm_setr_ps(min.y, min.z, min.x, min.y), max1 = _mm_setr_ps(max.y, max.z, max.x, max.y);
+    __m128 min2 = _mm_setr_ps(min.z, min.x, min.y, min.z), max2 = _mm_setr_ps(max.z, max.x, max.y, max.z);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float *data = &vecs[i].x;
+        const __m128 r0 = _mm_loadu_ps(data), r1 = _mm_loadu_ps(data + 4), r2 = _mm_loadu_ps(data + 8);
+        min0 = _mm_min_ps(r0, min0);
+        min1 = _mm_min_ps(r1, min1);
+        min2 = _mm_min_ps(r2, min2);
+        max0 = _mm_max_ps(r0, max0);
+        max1 = _mm_max_ps(r1, max1);
+        max2 = _mm_max_ps(r2, max2);
+    }
+
+    float lo[12], hi[12];
+    _mm_storeu_ps(lo, min0);
+    _mm_storeu_ps(lo + 4, min1);
+    _mm_storeu_ps(lo + 8, min2);
+    _mm_storeu_ps(hi, max0);
+    _mm_storeu_ps(hi + 4, max1);
+    _mm_storeu_ps(hi + 8, max2);
+    for (unsigned int k = 0; k < 12; ++k) {
+        min[k % 3] = std::min(min[k % 3], lo[k]);
+        max[k % 3] = std::max(max[k % 3], hi[k]);
+    }
+    return i;
+}
+
+} // namespace
+
+#endif // AI_SIMD_SSE2
+
+// ------------------------------------------------------------------------------------------------
+void TransformPoints(const aiMatrix4x4 &mat, const aiVector3D *in, aiVector3D *out, size_t count) {
+    size_t i = 0;
+#ifdef AI_SIMD_SSE2
+    if (UseSSE2()) {
+        i = TransformPointsSSE2(mat, in, out, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = mat * in[i];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TransformDirections(const aiMatrix3x3 &mat, const aiVector3D *in, aiVector3D *out, size_t count) {
+    size_t i = 0;
+#ifdef AI_SIMD_SSE2
+    if (UseSSE2()) {
+        i = TransformDirectionsSSE2(mat, in, out, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        aiVector3D v = mat * in[i];
+        out[i] = v.Normalize();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ScaleVectors(aiVector3D *vecs, size_t count, const aiVector3D &factor) {
+    size_t i = 0;
+#ifdef AI_SIMD_SSE2
+    if (UseSSE2()) {
+        i = ScaleVectorsSSE2(vecs, count, factor);
+    }
+#endif
+    for (; i < count; ++i) {
+        vecs[i] = vecs[i].SymMul(factor);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void MinMaxVectors(const aiVector3D *vecs, size_t count, aiVector3D &min, aiVector3D &max) {
+    size_t i = 0;
+#ifdef AI_SIMD_SSE2
+    if (UseSSE2()) {
+        i = MinMaxVectorsSSE2(vecs, count, min, max);
+    }
+#endif
+    for (; i < count; ++i) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            if (vecs[i][k] < min[k]) {
+                min[k] = vecs[i][k];
+            }
+            if (vecs[i][k] > max[k]) {
+                max[k] = vecs[i][k];
+            }
+        }
+    }
+}
 
 } // Namespace Assimp
@@ -41,6 +41,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <assimp/defs.h>
+#include <assimp/matrix3x3.h>
+#include <assimp/matrix4x4.h>
+#include <assimp/vector3.h>
+
+#include <cstddef>
 
 namespace Assimp {
 
@@ -48,4 +53,39 @@ namespace Assimp {
 /// @return true, if SSE2 is supported. false if SSE2 is not supported.
 bool ASSIMP_API CPUSupportsSSE2();
 
+// The batch kernels below operate on plain arrays of aiVector3D. They use
+// SSE2 if the build has single precision and the cpu supports it, else a
+// scalar loop. Both paths produce the same results as the per-vector
+// operators. Input and output arrays may be identical.
+
+/// @brief  Transforms positions by a matrix, out[i] = mat * in[i].
+/// @param  mat     The transformation, the translation is applied.
+/// @param  in      The source positions.
+/// @param  out     The transformed positions.
+/// @param  count   The number of positions.
+void ASSIMP_API TransformPoints(const aiMatrix4x4 &mat, const aiVector3D *in, aiVector3D *out, size_t count);
+
+/// @brief  Transforms directions by a matrix and normalizes them,
+///         out[i] = (mat * in[i]).Normalize(). Zero vectors stay zero.
+/// @param  mat     The transformation, usually the normal matrix.
+/// @param  in      The source directions.
+/// @param  out     The transformed directions.
+/// @param  count   The number of directions.
+void ASSIMP_API TransformDirections(const aiMatrix3x3 &mat, const aiVector3D *in, aiVector3D *out, size_t count);
+
+/// @brief  Multiplies all vectors componentwise by a factor, used for
+///         handedness flips such as (1, 1, -1).
+/// @param  vecs    The vectors to scale in place.
+/// @param  count   The number of vectors.
+/// @param  factor  The componentwise factor.
+void ASSIMP_API ScaleVectors(aiVector3D *vecs, size_t count, const aiVector3D &factor);
+
+/// @brief  Extends a componentwise minimum and maximum by the vectors.
+///         NaN components are ignored.
+/// @param  vecs    The vectors.
+/// @param  count   The number of vectors.
+/// @param  min     The minimum to update.
+/// @param  max     The maximum to update.
+void ASSIMP_API MinMaxVectors(const aiVector3D *vecs, size_t count, aiVector3D &min, aiVector3D &max);
+
 } // Namespace Assimp
@@ -44,16 +44,74 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace Assimp {
 
-static bool IsBoneNode(const aiString &bone_name, std::vector<aiBone *> &bones) {
-    for (aiBone *bone : bones) {
-        if (bone->mName == bone_name) {
-            return true;
+// Nodes without meshes by name, in pre-order, with a cursor per name. Taking
+// a node advances the cursor of its name, a reset makes all nodes available
+// again. This is what BuildBoneStack() did with a node list, without the
+// linear search and erase.
+class NodeStack {
+public:
+    explicit NodeStack(const std::vector<aiNode *> &nodes) {
+        for (aiNode *node : nodes) {
+            mNodes[node->mName.C_Str()].nodes.push_back(node);
         }
     }
 
-    return false;
+    aiNode *Take(const aiString &name) {
+        auto it = mNodes.find(name.C_Str());
+        if (it == mNodes.end()) {
+            return nullptr;
+        }
+        Entry &entry = it->second;
+        if (entry.generation != mGeneration) {
+            entry.generation = mGeneration;
+            entry.next = 0;
+        }
+        return entry.next < entry.nodes.size() ? entry.nodes[entry.next++] : nullptr;
+    }
+
+    void Reset() {
+        ++mGeneration;
+    }
+
+private:
+    struct Entry {
+        std::vector<aiNode *> nodes;
+        size_t next = 0;
+        size_t generation = 0;
+    };
+    std::unordered_map<std::string_view, Entry> mNodes;
+    size_t mGeneration = 0;
+};
+
+// Collects the bones of all meshes below a node, each one once
+static void CollectBones(const aiNode *current_node, const aiScene *scene,
+        std::vector<aiBone *> &bones, std::unordered_set<aiBone *> &known) {
+    for (unsigned int nodeId = 0; nodeId < current_node->mNumChildren; ++nodeId) {
+        const aiNode *child = current_node->mChildren[nodeId];
+        ai_assert(child);
+
+        for (unsigned int meshId = 0; meshId < child->mNumMeshes; ++meshId) {
+            const aiMesh *mesh = scene->mMeshes[child->mMeshes[meshId]];
+            ai_assert(mesh);
+
+            // duplicate meshes exist with the same bones sometimes
+            for (unsigned int boneId = 0; boneId < mesh->mNumBones; ++boneId) {
+                aiBone *bone = mesh->mBones[boneId];
+                ai_assert(nullptr != bone);
+                if (known.insert(bone).second) {
+                    bones.emplace_back(bone);
+                }
+            }
+        }
+
+        CollectBones(child, scene, bones, known);
+    }
 }
 
 bool ArmaturePopulate::IsActive(unsigned int pFlags) const {
@@ -77,13 +135,18 @@ void ArmaturePopulate::Execute(aiScene *out) {
 
     ASSIMP_LOG_DEBUG("Bone stack size: ", bone_stack.size());
 
+    std::unordered_set<std::string_view> bone_names;
+    for (const aiBone *bone : bones) {
+        bone_names.insert(bone->mName.C_Str());
+    }
+
     for (std::pair<aiBone *, aiNode *> kvp : bone_stack) {
         aiBone *bone = kvp.first;
         aiNode *bone_node = kvp.second;
         ASSIMP_LOG_VERBOSE_DEBUG("active node lookup: ", bone->mName.C_Str());
 
         // lcl transform grab - done in generate_nodes :)
-        aiNode *armature = GetArmatureRoot(bone_node, bones);
+        aiNode *armature = GetArmatureRoot(bone_node, bone_names);
 
         ai_assert(armature);
 
@@ -106,39 +169,12 @@ void ArmaturePopulate::Execute(aiScene *out) {
 // with multiple origins
 // Source: sketch fab log cutter fbx
 void ArmaturePopulate::BuildBoneList(aiNode *current_node,
-                                     const aiNode *root_node,
+                                     const aiNode * /*root_node*/,
                                      const aiScene *scene,
                                      std::vector<aiBone *> &bones) {
     ai_assert(scene);
-    for (unsigned int nodeId = 0; nodeId < current_node->mNumChildren; ++nodeId) {
-        aiNode *child = current_node->mChildren[nodeId];
-        ai_assert(child);
-
-        // check for bones
-        for (unsigned int meshId = 0; meshId < child->mNumMeshes; ++meshId) {
-            ai_assert(child->mMeshes);
-            unsigned int mesh_index = child->mMeshes[meshId];
-            aiMesh *mesh = scene->mMeshes[mesh_index];
-            ai_assert(mesh);
-
-            for (unsigned int boneId = 0; boneId < mesh->mNumBones; ++boneId) {
-                aiBone *bone = mesh->mBones[boneId];
-                ai_assert(nullptr != bone);
-
-                // duplicate mehes exist with the same bones sometimes :)
-                // so this must be detected
-                if (std::find(bones.begin(), bones.end(), bone) == bones.end()) {
-                    // add the element once
-                    bones.emplace_back(bone);
-                }
-            }
-
-            // find mesh and get bones
-            // then do recursive lookup for bones in root node hierarchy
-        }
-
-        BuildBoneList(child, root_node, scene, bones);
-    }
+    std::unordered_set<aiBone *> known(bones.begin(), bones.end());
+    CollectBones(current_node, scene, bones, known);
 }
 
 // Prepare flat node list which can be used for non recursive lookups later
@@ -171,15 +207,17 @@ void ArmaturePopulate::BuildBoneStack(const aiNode *root_node,
     }
     ai_assert(nullptr != root_node);
 
+    // the nodes are taken from a name lookup instead of searching the list,
+    // and resetting it doesn't need to rebuild the list
+    NodeStack stack(node_stack);
     for (aiBone *bone : bones) {
         ai_assert(bone);
-        aiNode *node = GetNodeFromStack(bone->mName, node_stack);
+        aiNode *node = stack.Take(bone->mName);
         if (node == nullptr) {
-            node_stack.clear();
-            BuildNodeList(root_node, node_stack);
+            stack.Reset();
             ASSIMP_LOG_VERBOSE_DEBUG("Resetting bone stack: nullptr element ", bone->mName.C_Str());
 
-            node = GetNodeFromStack(bone->mName, node_stack);
+            node = stack.Take(bone->mName);
 
             if (nullptr == node) {
                 ASSIMP_LOG_ERROR("serious import issue node for bone was not detected");
@@ -197,9 +235,9 @@ void ArmaturePopulate::BuildBoneStack(const aiNode *root_node,
 // This is required to be detected for a bone initially, it will recurse up
 // until it cannot find another bone and return the node No known failure
 // points. (yet)
-aiNode *ArmaturePopulate::GetArmatureRoot(aiNode *bone_node, std::vector<aiBone *> &bone_list) {
+aiNode *ArmaturePopulate::GetArmatureRoot(aiNode *bone_node, const std::unordered_set<std::string_view> &bone_names) {
     while (nullptr != bone_node) {
-        if (!IsBoneNode(bone_node->mName, bone_list)) {
+        if (bone_names.find(bone_node->mName.C_Str()) == bone_names.end()) {
             ASSIMP_LOG_VERBOSE_DEBUG("GetArmatureRoot() Found valid armature: ", bone_node->mName.C_Str());
             return bone_node;
         }
@@ -212,37 +250,4 @@ aiNode *ArmaturePopulate::GetArmatureRoot(aiNode *bone_node, std::vector<aiBone
     return nullptr;
 }
 
-// Pop this node by name from the stack if found
-// Used in multiple armature situations with duplicate node / bone names
-// Known flaw: cannot have nodes with bone names, will be fixed in later release
-// (serious to be fixed) Known flaw: nodes which have more than one bone could
-// be prematurely dropped from stack
-aiNode *ArmaturePopulate::GetNodeFromStack(const aiString &node_name,
-                                           std::vector<aiNode *> &nodes) {
-    std::vector<aiNode *>::iterator iter;
-    aiNode *found = nullptr;
-    for (iter = nodes.begin(); iter < nodes.end(); ++iter) {
-        aiNode *element = *iter;
-        ai_assert(nullptr != element);
-        // node valid and node name matches
-        if (element->mName == node_name) {
-            found = element;
-            break;
-        }
-    }
-
-    if (found != nullptr) {
-        ASSIMP_LOG_INFO("Removed node from stack: ", found->mName.C_Str());
-        // now pop the element from the node list
-        nodes.erase(iter);
-
-        return found;
-    }
-
-    // unique names can cause this problem
-    ASSIMP_LOG_ERROR("[Serious] GetNodeFromStack() can't find node from stack!");
-
-    return nullptr;
-}
-
 } // Namespace Assimp
@@ -45,6 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/BaseImporter.h>
 #include <vector>
 #include <map>
+#include <string_view>
+#include <unordered_set>
 
 
 struct aiNode;
@@ -83,10 +85,7 @@ public:
     void Execute( aiScene* pScene ) override;
 
     static aiNode *GetArmatureRoot(aiNode *bone_node,
-                                      std::vector<aiBone *> &bone_list);
-
-    static aiNode *GetNodeFromStack(const aiString &node_name,
-                                       std::vector<aiNode *> &nodes);
+                                      const std::unordered_set<std::string_view> &bone_names);
 
     static void BuildNodeList(const aiNode *current_node,
                                  std::vector<aiNode *> &nodes);
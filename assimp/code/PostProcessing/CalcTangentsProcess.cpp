@@ -88,6 +88,7 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     bool bHas = false;
     for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+        CheckCancel();
         if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
     }
 
@@ -98,6 +99,16 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool CalcTangentsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int meshIndex) {
+    ProcessMesh(pMesh, meshIndex);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Calculates tangents and bi-tangents for the given mesh
 bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
@@ -129,7 +140,7 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
 
     const float angleEpsilon = 0.9999f;
 
-    std::vector<bool> vertexDone(pMesh->mNumVertices, false);
+    std::vector<char> vertexDone(pMesh->mNumVertices, 0);
     const float qnan = get_qnan();
 
     // create space for the tangents and bitangents
@@ -151,7 +162,7 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
             // their tangent vectors are set to qnan.
             for (unsigned int i = 0; i < face.mNumIndices; ++i) {
                 unsigned int idx = face.mIndices[i];
-                vertexDone[idx] = true;
+                vertexDone[idx] = 1;
                 meshTang[idx] = aiVector3D(qnan);
                 meshBitang[idx] = aiVector3D(qnan);
             }
@@ -220,52 +231,33 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
         }
     }
 
-    // create a helper to quickly find locally close vertices among the vertex array
-    // FIX: check whether we can reuse the SpatialSort of a previous step
-    SpatialSort *vertexFinder = nullptr;
-    SpatialSort _vertexFinder;
-    float posEpsilon = 10e-6f;
-    if (shared) {
-        std::vector<std::pair<SpatialSort, float>> *avf;
-        shared->GetProperty(AI_SPP_SPATIAL_SORT, avf);
-        if (avf) {
-            std::pair<SpatialSort, float> &blubb = avf->operator[](meshIndex);
-            vertexFinder = &blubb.first;
-            posEpsilon = blubb.second;
-            ;
-        }
-    }
-    if (!vertexFinder) {
-        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof(aiVector3D));
-        vertexFinder = &_vertexFinder;
-        posEpsilon = ComputePositionEpsilon(pMesh);
-    }
-    std::vector<unsigned int> verticesFound;
+    // find all vertices close to each other, the adjacency may be shared with
+    // other steps. Vertex groups are independent and smoothed in parallel.
+    VertexAdjacency localAdjacency;
+    const VertexAdjacency &adjacency = GetVertexAdjacency(shared, pMesh, meshIndex, localAdjacency);
+    const unsigned int *offsets = adjacency.mOffsets.data();
+    const unsigned int *neighbours = adjacency.mNeighbours.data();
 
     const float fLimit = std::cos(configMaxAngle);
-    std::vector<unsigned int> closeVertices;
 
     // in the second pass we now smooth out all tangents and bitangents at the same local position
     // if they are not too far off.
-    for (unsigned int a = 0; a < pMesh->mNumVertices; a++) {
+    ForEachVertexGroup(adjacency, [&](unsigned int a) {
         if (vertexDone[a])
-            continue;
+            return;
 
-        const aiVector3D &origPos = pMesh->mVertices[a];
         const aiVector3D &origNorm = pMesh->mNormals[a];
         const aiVector3D &origTang = pMesh->mTangents[a];
         const aiVector3D &origBitang = pMesh->mBitangents[a];
-        closeVertices.resize(0);
-
-        // find all vertices close to that position
-        vertexFinder->FindPositions(origPos, posEpsilon, verticesFound);
-
-        closeVertices.reserve(verticesFound.size() + 5);
+        // reused by all vertices smoothed on this thread
+        thread_local std::vector<unsigned int> closeVertices;
+        closeVertices.clear();
         closeVertices.push_back(a);
 
-        // look among them for other vertices sharing the same normal and a close-enough tangent/bitangent
-        for (unsigned int b = 0; b < verticesFound.size(); b++) {
-            unsigned int idx = verticesFound[b];
+        // look among the vertices close to that position for other vertices sharing the same normal
+        // and a close-enough tangent/bitangent
+        for (unsigned int b = offsets[a]; b < offsets[a + 1]; b++) {
+            unsigned int idx = neighbours[b];
             if (vertexDone[idx])
                 continue;
             if (meshNorm[idx] * origNorm < angleEpsilon)
@@ -277,7 +269,7 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
 
             // it's similar enough -> add it to the smoothing group
             closeVertices.push_back(idx);
-            vertexDone[idx] = true;
+            vertexDone[idx] = 1;
         }
 
         // smooth the tangents and bitangents of all vertices that were found to be close enough
@@ -294,6 +286,6 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
             meshTang[closeVertices[b]] = smoothTangent;
             meshBitang[closeVertices[b]] = smoothBitangent;
         }
-    }
+    });
     return true;
 }
@@ -98,6 +98,12 @@ protected:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
 private:
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
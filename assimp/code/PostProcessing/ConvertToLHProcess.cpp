@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
 #include "ConvertToLHProcess.h"
+#include "Common/simd.h"
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -86,18 +87,36 @@ bool MakeLeftHandedProcess::IsActive(unsigned int pFlags) const {
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void MakeLeftHandedProcess::Execute(aiScene *pScene) {
-    // Check for an existent root node to proceed
-    ai_assert(pScene->mRootNode != nullptr);
     ASSIMP_LOG_DEBUG("MakeLeftHandedProcess begin");
 
-    // recursively convert all the nodes
-    ProcessNode(pScene->mRootNode, aiMatrix4x4());
-
     // process the meshes accordingly
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
         ProcessMesh(pScene->mMeshes[a]);
     }
 
+    // and everything else
+    ExecuteAfterMeshes(pScene);
+    ASSIMP_LOG_DEBUG("MakeLeftHandedProcess finished");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool MakeLeftHandedProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MakeLeftHandedProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    ProcessMesh(pMesh);
+}
+
+// ------------------------------------------------------------------------------------------------
+void MakeLeftHandedProcess::ExecuteAfterMeshes(aiScene *pScene) {
+    // Check for an existent root node to proceed
+    ai_assert(pScene->mRootNode != nullptr);
+
+    // recursively convert all the nodes
+    ProcessNode(pScene->mRootNode, aiMatrix4x4());
+
     // process the materials accordingly
     for (unsigned int a = 0; a < pScene->mNumMaterials; ++a) {
         ProcessMaterial(pScene->mMaterials[a]);
@@ -117,7 +136,6 @@ void MakeLeftHandedProcess::Execute(aiScene *pScene) {
     {
         ProcessCamera(pScene->mCameras[a]);
     }
-    ASSIMP_LOG_DEBUG("MakeLeftHandedProcess finished");
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -150,28 +168,25 @@ void MakeLeftHandedProcess::ProcessMesh(aiMesh *pMesh) {
         return;
     }
     // mirror positions, normals and stuff along the Z axis
-    for (size_t a = 0; a < pMesh->mNumVertices; ++a) {
-        pMesh->mVertices[a].z *= -1.0f;
-        if (pMesh->HasNormals()) {
-            pMesh->mNormals[a].z *= -1.0f;
-        }
-        if (pMesh->HasTangentsAndBitangents()) {
-            pMesh->mTangents[a].z *= -1.0f;
-            pMesh->mBitangents[a].z *= -1.0f;
-        }
+    const aiVector3D mirror(1, 1, -1);
+    ScaleVectors(pMesh->mVertices, pMesh->mNumVertices, mirror);
+    if (pMesh->HasNormals()) {
+        ScaleVectors(pMesh->mNormals, pMesh->mNumVertices, mirror);
+    }
+    if (pMesh->HasTangentsAndBitangents()) {
+        ScaleVectors(pMesh->mTangents, pMesh->mNumVertices, mirror);
     }
 
     // mirror anim meshes positions, normals and stuff along the Z axis
     for (size_t m = 0; m < pMesh->mNumAnimMeshes; ++m) {
-        for (size_t a = 0; a < pMesh->mAnimMeshes[m]->mNumVertices; ++a) {
-            pMesh->mAnimMeshes[m]->mVertices[a].z *= -1.0f;
-            if (pMesh->mAnimMeshes[m]->HasNormals()) {
-                pMesh->mAnimMeshes[m]->mNormals[a].z *= -1.0f;
-            }
-            if (pMesh->mAnimMeshes[m]->HasTangentsAndBitangents()) {
-                pMesh->mAnimMeshes[m]->mTangents[a].z *= -1.0f;
-                pMesh->mAnimMeshes[m]->mBitangents[a].z *= -1.0f;
-            }
+        aiAnimMesh *animMesh = pMesh->mAnimMeshes[m];
+        ScaleVectors(animMesh->mVertices, animMesh->mNumVertices, mirror);
+        if (animMesh->HasNormals()) {
+            ScaleVectors(animMesh->mNormals, animMesh->mNumVertices, mirror);
+        }
+        if (animMesh->HasTangentsAndBitangents()) {
+            ScaleVectors(animMesh->mTangents, animMesh->mNumVertices, mirror);
+            ScaleVectors(animMesh->mBitangents, animMesh->mNumVertices, mirror);
         }
     }
 
@@ -186,10 +201,10 @@ void MakeLeftHandedProcess::ProcessMesh(aiMesh *pMesh) {
         bone->mOffsetMatrix.c4 = -bone->mOffsetMatrix.c4;
     }
 
-    // mirror bitangents as well as they're derived from the texture coords
+    // mirror bitangents along the Z axis, and as a whole as well as they're
+    // derived from the texture coords
     if (pMesh->HasTangentsAndBitangents()) {
-        for (unsigned int a = 0; a < pMesh->mNumVertices; a++)
-            pMesh->mBitangents[a] *= -1.0f;
+        ScaleVectors(pMesh->mBitangents, pMesh->mNumVertices, aiVector3D(-1, -1, 1));
     }
 }
 
@@ -260,9 +275,24 @@ void FlipUVsProcess::Execute(aiScene *pScene) {
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i)
         ProcessMesh(pScene->mMeshes[i]);
 
+    ExecuteAfterMeshes(pScene);
+    ASSIMP_LOG_DEBUG("FlipUVsProcess finished");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool FlipUVsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FlipUVsProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    ProcessMesh(pMesh);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FlipUVsProcess::ExecuteAfterMeshes(aiScene *pScene) {
     for (unsigned int i = 0; i < pScene->mNumMaterials; ++i)
         ProcessMaterial(pScene->mMaterials[i]);
-    ASSIMP_LOG_DEBUG("FlipUVsProcess finished");
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -316,6 +346,16 @@ void FlipWindingOrderProcess::Execute(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("FlipWindingOrderProcess finished");
 }
 
+// ------------------------------------------------------------------------------------------------
+bool FlipWindingOrderProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FlipWindingOrderProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    ProcessMesh(pMesh);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Converts a single mesh
 void FlipWindingOrderProcess::ProcessMesh(aiMesh *pMesh) {
@@ -83,6 +83,15 @@ public:
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
+    // -------------------------------------------------------------------
+    void ExecuteAfterMeshes(aiScene* pScene) override;
+
 protected:
     // -------------------------------------------------------------------
     /** Recursively converts a node and all of its children
@@ -140,6 +149,12 @@ public:
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
     /** Some other types of post-processing require winding order flips */
     static void ProcessMesh( aiMesh* pMesh);
 };
@@ -164,6 +179,15 @@ public:
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
+    // -------------------------------------------------------------------
+    void ExecuteAfterMeshes(aiScene* pScene) override;
+
 protected:
     void ProcessMesh( aiMesh* pMesh);
     void ProcessMaterial( aiMaterial* mat);
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers of the post-processing framework
 #include "ProcessHelper.h"
 #include "DeboneProcess.h"
+#include "Common/ScenePrivate.h"
 #include <stdio.h>
 
 using namespace Assimp;
@@ -115,7 +116,7 @@ void DeboneProcess::Execute( aiScene* pScene) {
                 for(unsigned int b=0;b<newMeshes.size();b++)    {
                     const aiString *find = newMeshes[b].second ? &newMeshes[b].second->mName : nullptr;
 
-                    aiNode *theNode = find ? pScene->mRootNode->FindNode(*find) : nullptr;
+                    aiNode *theNode = find ? GetSceneIndex(pScene).FindNode(*find) : nullptr;
                     std::pair<unsigned int,aiNode*> push_pair(static_cast<unsigned int>(meshes.size()),theNode);
 
                     mSubMeshIndices[a].emplace_back(push_pair);
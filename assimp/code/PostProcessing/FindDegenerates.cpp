@@ -92,6 +92,7 @@ void FindDegeneratesProcess::Execute(aiScene *pScene) {
     const unsigned int originalNumMeshes = pScene->mNumMeshes;
     unsigned int targetIndex = 0;
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        CheckCancel();
         // Do not process point cloud, ExecuteOnMesh works only with faces data
         if ((pScene->mMeshes[i]->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) && ExecuteOnMesh(pScene->mMeshes[i])) {
             delete pScene->mMeshes[i];
@@ -69,6 +69,7 @@ void FixInfacingNormalsProcess::Execute( aiScene* pScene) {
 
     bool bHas( false );
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        CheckCancel();
         if (ProcessMesh(pScene->mMeshes[a], a)) {
             bHas = true;
         }
@@ -72,6 +72,12 @@ public:
     // -------------------------------------------------------------------
     /// @brief The execution callback.
     void Execute(aiScene* pScene) override;
+
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
 };
 
 } // Namespace Assimp
@@ -76,6 +76,7 @@ void GenFaceNormalsProcess::Execute(aiScene *pScene) {
 
     bool bHas = false;
     for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+        CheckCancel();
         if (this->GenMeshFaceNormals(pScene->mMeshes[a])) {
             bHas = true;
         }
@@ -89,6 +90,16 @@ void GenFaceNormalsProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool GenFaceNormalsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenFaceNormalsProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    GenMeshFaceNormals(pMesh);
+}
+
 namespace {
 
 template<class XMesh>
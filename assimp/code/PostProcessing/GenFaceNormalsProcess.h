@@ -74,6 +74,12 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
 private:
     bool GenMeshFaceNormals(aiMesh* pcMesh);
     mutable bool force_ = false;
@@ -0,0 +1,358 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the GenMeshletsProcess post-processing step.
+ *
+ *  Meshlets are grown greedily from a seed triangle. The next triangle is
+ *  always one sharing a vertex with the meshlet, preferring those which
+ *  add the fewest new vertices and, among these, the one closest to the
+ *  meshlet. So the triangles of a meshlet are stored in a connected,
+ *  strip-like order and its vertices in the order of their first use.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#include "PostProcessing/GenMeshletsProcess.h"
+#include "Common/ParallelFor.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace Assimp {
+
+namespace {
+
+// Normal cones narrower than this can't be used for culling
+static constexpr ai_real MinConeCosine = ai_real(0.1);
+
+// ------------------------------------------------------------------------------------------------
+// Computes the bounding sphere and the normal cone of a finished meshlet
+void ComputeBounds(const aiMesh *mesh, const unsigned int *vertices, const unsigned char *triangles, aiMeshlet &meshlet) {
+    const aiVector3D *pos = mesh->mVertices;
+
+    aiVector3D min = pos[vertices[0]], max = pos[vertices[0]];
+    for (unsigned int a = 1; a < meshlet.mNumVertices; ++a) {
+        const aiVector3D &p = pos[vertices[a]];
+        min = aiVector3D(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+        max = aiVector3D(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+    }
+    meshlet.mCenter = (min + max) * ai_real(0.5);
+    ai_real radius = 0;
+    for (unsigned int a = 0; a < meshlet.mNumVertices; ++a) {
+        radius = std::max(radius, (pos[vertices[a]] - meshlet.mCenter).SquareLength());
+    }
+    meshlet.mRadius = std::sqrt(radius);
+
+    // the cone axis is the average of the face normals
+    std::vector<aiVector3D> normals;
+    normals.reserve(meshlet.mNumTriangles);
+    aiVector3D axis;
+    for (unsigned int a = 0; a < meshlet.mNumTriangles; ++a) {
+        const aiVector3D &p0 = pos[vertices[triangles[a * 3]]];
+        aiVector3D n = (pos[vertices[triangles[a * 3 + 1]]] - p0) ^ (pos[vertices[triangles[a * 3 + 2]]] - p0);
+        const ai_real length = n.Length();
+        if (length > ai_real(0.0)) {
+            n /= length;
+            axis += n;
+        }
+        normals.push_back(n);
+    }
+
+    meshlet.mConeApex = meshlet.mCenter;
+    meshlet.mConeAxis = aiVector3D();
+    meshlet.mConeCutoff = 1;
+    const ai_real axisLength = axis.Length();
+    if (axisLength <= ai_real(0.0)) {
+        return;
+    }
+    axis /= axisLength;
+
+    ai_real minDot = 1;
+    for (const aiVector3D &n : normals) {
+        if (n.SquareLength() > ai_real(0.0)) {
+            minDot = std::min(minDot, axis * n);
+        }
+    }
+    if (minDot <= MinConeCosine) {
+        return;
+    }
+
+    // move the apex back along the axis until it lies behind all faces
+    ai_real maxT = 0;
+    for (unsigned int a = 0; a < meshlet.mNumTriangles; ++a) {
+        const aiVector3D &n = normals[a];
+        if (n.SquareLength() > ai_real(0.0)) {
+            const ai_real t = ((meshlet.mCenter - pos[vertices[triangles[a * 3]]]) * n) / (axis * n);
+            maxT = std::max(maxT, t);
+        }
+    }
+    meshlet.mConeApex = meshlet.mCenter - axis * maxT;
+    meshlet.mConeAxis = axis;
+    meshlet.mConeCutoff = std::sqrt(1 - minDot * minDot);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+GenMeshletsProcess::GenMeshletsProcess() :
+        mMaxVertices(64), mMaxTriangles(124) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenMeshletsProcess::IsActive(unsigned int) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::SetupProperties(const Importer *pImp) {
+    const int maxVertices = pImp->GetPropertyInteger(AI_CONFIG_PP_ML_MAX_VERTICES, 64);
+    mMaxVertices = static_cast<unsigned int>(std::min(std::max(maxVertices, 3), 256));
+    const int maxTriangles = pImp->GetPropertyInteger(AI_CONFIG_PP_ML_MAX_TRIANGLES, 124);
+    mMaxTriangles = static_cast<unsigned int>(std::max(maxTriangles, 1));
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::BuildMeshlets(aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles) {
+    ai_assert(nullptr != mesh);
+    ai_assert(maxVertices >= 3 && maxVertices <= 256 && maxTriangles >= 1);
+
+    delete mesh->mMeshletData;
+    mesh->mMeshletData = nullptr;
+    if (nullptr == mesh->mVertices || 0 == mesh->mNumFaces) {
+        return;
+    }
+    for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+        if (3 != mesh->mFaces[a].mNumIndices) {
+            return;
+        }
+    }
+
+    const unsigned int numFaces = mesh->mNumFaces;
+    const unsigned int numVertices = mesh->mNumVertices;
+    const aiVector3D *pos = mesh->mVertices;
+
+    // faces around each vertex
+    std::vector<unsigned int> adjOffsets(numVertices + 1, 0);
+    for (unsigned int a = 0; a < numFaces; ++a) {
+        for (unsigned int b = 0; b < 3; ++b) {
+            ++adjOffsets[mesh->mFaces[a].mIndices[b] + 1];
+        }
+    }
+    for (unsigned int a = 0; a < numVertices; ++a) {
+        adjOffsets[a + 1] += adjOffsets[a];
+    }
+    std::vector<unsigned int> adjFaces(adjOffsets[numVertices]);
+    {
+        std::vector<unsigned int> fill(adjOffsets.begin(), adjOffsets.end() - 1);
+        for (unsigned int a = 0; a < numFaces; ++a) {
+            for (unsigned int b = 0; b < 3; ++b) {
+                adjFaces[fill[mesh->mFaces[a].mIndices[b]]++] = a;
+            }
+        }
+    }
+
+    std::vector<aiVector3D> faceCenters(numFaces);
+    for (unsigned int a = 0; a < numFaces; ++a) {
+        const unsigned int *idx = mesh->mFaces[a].mIndices;
+        faceCenters[a] = (pos[idx[0]] + pos[idx[1]] + pos[idx[2]]) / ai_real(3.0);
+    }
+
+    std::vector<aiMeshlet> meshlets;
+    std::vector<unsigned int> vertices;
+    std::vector<unsigned char> triangles;
+    vertices.reserve(numFaces);
+    triangles.reserve(size_t(numFaces) * 3);
+
+    std::vector<bool> used(numFaces, false);
+    std::vector<unsigned int> local(numVertices, UINT_MAX); // index of a vertex in the current meshlet
+    std::vector<unsigned int> stamp(numFaces, UINT_MAX);    // meshlet which listed a face as candidate
+    std::vector<unsigned int> candidates;
+    unsigned int scan = 0;
+
+    aiMeshlet current;
+    aiVector3D centerSum;
+    aiVector3D lastCenter;
+
+    auto finish = [&]() {
+        ComputeBounds(mesh, &vertices[current.mVertexOffset], &triangles[current.mTriangleOffset], current);
+        for (unsigned int a = 0; a < current.mNumVertices; ++a) {
+            local[vertices[current.mVertexOffset + a]] = UINT_MAX;
+        }
+        meshlets.push_back(current);
+        lastCenter = current.mCenter;
+
+        current = aiMeshlet();
+        current.mVertexOffset = static_cast<unsigned int>(vertices.size());
+        current.mTriangleOffset = static_cast<unsigned int>(triangles.size());
+        centerSum = aiVector3D();
+    };
+
+    auto add = [&](unsigned int face) {
+        used[face] = true;
+        for (unsigned int b = 0; b < 3; ++b) {
+            const unsigned int v = mesh->mFaces[face].mIndices[b];
+            if (UINT_MAX == local[v]) {
+                local[v] = current.mNumVertices++;
+                vertices.push_back(v);
+
+                // the faces around a new vertex are the next candidates
+                const unsigned int id = static_cast<unsigned int>(meshlets.size());
+                for (unsigned int c = adjOffsets[v]; c < adjOffsets[v + 1]; ++c) {
+                    const unsigned int f = adjFaces[c];
+                    if (!used[f] && stamp[f] != id) {
+                        stamp[f] = id;
+                        candidates.push_back(f);
+                    }
+                }
+            }
+            triangles.push_back(static_cast<unsigned char>(local[v]));
+        }
+        ++current.mNumTriangles;
+        centerSum += faceCenters[face];
+    };
+
+    for (unsigned int remaining = numFaces; remaining > 0;) {
+        unsigned int best = UINT_MAX;
+
+        if (0 == current.mNumTriangles) {
+            // seed with the face next to the last meshlet closest to it,
+            // or with the next free face if there is none
+            ai_real bestDist = 0;
+            for (unsigned int f : candidates) {
+                const ai_real dist = (faceCenters[f] - lastCenter).SquareLength();
+                if (!used[f] && (UINT_MAX == best || dist < bestDist)) {
+                    best = f;
+                    bestDist = dist;
+                }
+            }
+            if (UINT_MAX == best) {
+                while (used[scan]) {
+                    ++scan;
+                }
+                best = scan;
+            }
+            candidates.clear();
+        } else {
+            const aiVector3D center = centerSum / static_cast<ai_real>(current.mNumTriangles);
+            unsigned int bestNew = 4;
+            ai_real bestDist = 0;
+            size_t keep = 0;
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                const unsigned int f = candidates[c];
+                if (used[f]) {
+                    continue;
+                }
+                candidates[keep++] = f;
+
+                const unsigned int *idx = mesh->mFaces[f].mIndices;
+                const unsigned int numNew = (UINT_MAX == local[idx[0]]) + (UINT_MAX == local[idx[1]]) + (UINT_MAX == local[idx[2]]);
+                if (current.mNumVertices + numNew > maxVertices) {
+                    continue;
+                }
+                const ai_real dist = (faceCenters[f] - center).SquareLength();
+                if (numNew < bestNew || (numNew == bestNew && dist < bestDist)) {
+                    best = f;
+                    bestNew = numNew;
+                    bestDist = dist;
+                }
+            }
+            candidates.resize(keep);
+
+            // nothing fits anymore, start the next meshlet
+            if (UINT_MAX == best) {
+                finish();
+                continue;
+            }
+        }
+
+        add(best);
+        --remaining;
+        if (current.mNumTriangles == maxTriangles) {
+            finish();
+        }
+    }
+    if (current.mNumTriangles) {
+        finish();
+    }
+
+    aiMeshletData *data = new aiMeshletData();
+    data->mNumMeshlets = static_cast<unsigned int>(meshlets.size());
+    data->mMeshlets = new aiMeshlet[meshlets.size()];
+    std::copy(meshlets.begin(), meshlets.end(), data->mMeshlets);
+    data->mNumVertices = static_cast<unsigned int>(vertices.size());
+    data->mVertices = new unsigned int[vertices.size()];
+    std::copy(vertices.begin(), vertices.end(), data->mVertices);
+    data->mNumTriangles = static_cast<unsigned int>(triangles.size() / 3);
+    data->mTriangles = new unsigned char[triangles.size()];
+    std::copy(triangles.begin(), triangles.end(), data->mTriangles);
+    mesh->mMeshletData = data;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenMeshletsProcess begin");
+
+    std::atomic<unsigned int> numMeshlets(0);
+    ParallelFor(pScene->mNumMeshes, [&](size_t i) {
+        CheckCancel();
+        aiMesh *mesh = pScene->mMeshes[i];
+        if ((mesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) != aiPrimitiveType_TRIANGLE) {
+            ASSIMP_LOG_DEBUG("GenMeshletsProcess: skipping mesh ", mesh->mName.C_Str(), ", it isn't a triangle mesh");
+            return;
+        }
+        BuildMeshlets(mesh, mMaxVertices, mMaxTriangles);
+        if (mesh->mMeshletData) {
+            numMeshlets += mesh->mMeshletData->mNumMeshlets;
+        }
+    });
+
+    ASSIMP_LOG_INFO("GenMeshletsProcess finished. Built ", numMeshlets.load(), " meshlets");
+}
+
+} // Namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
@@ -0,0 +1,102 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to split meshes into meshlets.
+ */
+
+#pragma once
+
+#ifndef AI_GENMESHLETSPROCESS_H_INC
+#define AI_GENMESHLETSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing step to build aiMesh::mMeshletData for all
+ *        triangle meshes.
+ *
+ * There is no aiProcess flag for this step. The importer runs it after all
+ * other steps if #AI_CONFIG_PP_ML_ENABLE is set.
+ */
+class ASSIMP_API GenMeshletsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenMeshletsProcess();
+    ~GenMeshletsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Always returns false, the step is enabled by a property.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads AI_CONFIG_PP_ML_MAX_VERTICES and AI_CONFIG_PP_ML_MAX_TRIANGLES.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Builds the meshlets of a single mesh.
+    /// @param mesh          The mesh, existing meshlets are replaced. Nothing
+    ///                      is built unless all faces are triangles.
+    /// @param maxVertices   Vertex limit per meshlet, in [3, 256].
+    /// @param maxTriangles  Triangle limit per meshlet, at least 1.
+    static void BuildMeshlets(aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles);
+
+private:
+    unsigned int mMaxVertices;
+    unsigned int mMaxTriangles;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#endif // AI_GENMESHLETSPROCESS_H_INC
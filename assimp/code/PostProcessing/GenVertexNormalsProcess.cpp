@@ -86,6 +86,7 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
 
     bool bHas = false;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        CheckCancel();
         if (GenMeshVertexNormals(pScene->mMeshes[a], a))
             bHas = true;
     }
@@ -99,6 +100,16 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool GenVertexNormalsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int meshIndex) {
+    GenMeshVertexNormals(pMesh, meshIndex);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 bool GenVertexNormalsProcess::GenMeshVertexNormals(aiMesh *pMesh, unsigned int meshIndex) {
@@ -149,78 +160,60 @@ bool GenVertexNormalsProcess::GenMeshVertexNormals(aiMesh *pMesh, unsigned int m
         }
     }
 
-    // Set up a SpatialSort to quickly find all vertices close to a given position
-    // check whether we can reuse the SpatialSort of a previous step.
-    SpatialSort *vertexFinder = nullptr;
-    SpatialSort _vertexFinder;
-    ai_real posEpsilon = ai_real(1e-5);
-    if (shared) {
-        std::vector<std::pair<SpatialSort, ai_real>> *avf;
-        shared->GetProperty(AI_SPP_SPATIAL_SORT, avf);
-        if (avf) {
-            std::pair<SpatialSort, ai_real> &blubb = avf->operator[](meshIndex);
-            vertexFinder = &blubb.first;
-            posEpsilon = blubb.second;
-        }
-    }
-    if (!vertexFinder) {
-        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof(aiVector3D));
-        vertexFinder = &_vertexFinder;
-        posEpsilon = ComputePositionEpsilon(pMesh);
-    }
-    std::vector<unsigned int> verticesFound;
+    // Find all vertices close to each other, the adjacency may be shared with
+    // other steps. Vertex groups are independent and smoothed in parallel.
+    VertexAdjacency localAdjacency;
+    const VertexAdjacency &adjacency = GetVertexAdjacency(shared, pMesh, meshIndex, localAdjacency);
+    const unsigned int *offsets = adjacency.mOffsets.data();
+    const unsigned int *neighbours = adjacency.mNeighbours.data();
     aiVector3D *pcNew = new aiVector3D[pMesh->mNumVertices];
 
     if (configMaxAngle >= AI_DEG_TO_RAD(175.f)) {
         // There is no angle limit. Thus all vertices with positions close
         // to each other will receive the same vertex normal. This allows us
         // to optimize the whole algorithm a little bit ...
-        std::vector<bool> abHad(pMesh->mNumVertices, false);
-        for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        std::vector<char> abHad(pMesh->mNumVertices, 0);
+        ForEachVertexGroup(adjacency, [&](unsigned int i) {
             if (abHad[i]) {
-                continue;
+                return;
             }
 
             // Get all vertices that share this one ...
-            vertexFinder->FindPositions(pMesh->mVertices[i], posEpsilon, verticesFound);
-
             aiVector3D pcNor;
-            for (unsigned int a = 0; a < verticesFound.size(); ++a) {
-                const aiVector3D &v = pMesh->mNormals[verticesFound[a]];
+            for (unsigned int a = offsets[i]; a < offsets[i + 1]; ++a) {
+                const aiVector3D &v = pMesh->mNormals[neighbours[a]];
                 if (is_not_qnan(v.x)) pcNor += v;
             }
             pcNor.NormalizeSafe();
 
             // Write the smoothed normal back to all affected normals
-            for (unsigned int a = 0; a < verticesFound.size(); ++a) {
-                unsigned int vidx = verticesFound[a];
+            for (unsigned int a = offsets[i]; a < offsets[i + 1]; ++a) {
+                unsigned int vidx = neighbours[a];
                 pcNew[vidx] = pcNor;
-                abHad[vidx] = true;
+                abHad[vidx] = 1;
             }
-        }
+        });
     }
     // Slower code path if a smooth angle is set. There are many ways to achieve
     // the effect, this one is the most straightforward one.
     else {
         const ai_real fLimit = std::cos(configMaxAngle);
-        for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
-            // Get all vertices that share this one ...
-            vertexFinder->FindPositions(pMesh->mVertices[i], posEpsilon, verticesFound);
-
+        ForEachVertexGroup(adjacency, [&](unsigned int i) {
             aiVector3D vr = pMesh->mNormals[i];
 
+            // Sum up the normals of all vertices that share this one ...
             aiVector3D pcNor;
-            for (unsigned int a = 0; a < verticesFound.size(); ++a) {
-                aiVector3D v = pMesh->mNormals[verticesFound[a]];
+            for (unsigned int a = offsets[i]; a < offsets[i + 1]; ++a) {
+                aiVector3D v = pMesh->mNormals[neighbours[a]];
 
                 // Check whether the angle between the two normals is not too large.
                 // Skip the angle check on our own normal to avoid false negatives
                 // (v*v is not guaranteed to be 1.0 for all unit vectors v)
-                if (is_not_qnan(v.x) && (verticesFound[a] == i || (v * vr >= fLimit)))
+                if (is_not_qnan(v.x) && (neighbours[a] == i || (v * vr >= fLimit)))
                     pcNor += v;
             }
             pcNew[i] = pcNor.NormalizeSafe();
-        }
+        });
     }
 
     delete[] pMesh->mNormals;
@@ -87,6 +87,12 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
     // setter for configMaxAngle
     inline void SetMaxSmoothAngle(ai_real f) {
         configMaxAngle =f;
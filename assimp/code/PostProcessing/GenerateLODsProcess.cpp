@@ -0,0 +1,763 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the GenerateLODsProcess post-processing step.
+ *
+ *  The simplification follows Garland and Heckbert, "Surface Simplification
+ *  Using Quadric Error Metrics", restricted to half-edge collapses. Each
+ *  collapse moves a vertex onto one of its neighbours, so the simplified
+ *  meshes only use vertices of the source mesh and keep all of their
+ *  attributes, bone weights and animation meshes exactly.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "PostProcessing/GenerateLODsProcess.h"
+#include "Common/ParallelFor.h"
+#include "Common/simd.h"
+#include "PostProcessing/ProcessHelper.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/commonMetaData.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <unordered_map>
+
+namespace Assimp {
+
+namespace {
+
+// Weight of the planes which keep mesh borders in place
+static constexpr double BorderWeight = 10.0;
+
+// Minimum cosine between the normals of a face before and after a collapse
+static constexpr ai_real MinFaceCosine = ai_real(0.2);
+
+// ------------------------------------------------------------------------------------------------
+// Sum of squared distances to a set of planes, stored as symmetric 4x4 matrix
+struct Quadric {
+    double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0, c = 0.0;
+
+    // Adds the plane n * p + d = 0, n must be normalized
+    void AddPlane(const aiVector3D &n, ai_real d, double w) {
+        const double x = n.x, y = n.y, z = n.z;
+        a00 += w * x * x; a01 += w * x * y; a02 += w * x * z;
+        a11 += w * y * y; a12 += w * y * z; a22 += w * z * z;
+        b0 += w * x * d; b1 += w * y * d; b2 += w * z * d;
+        c += w * d * d;
+    }
+
+    void Add(const Quadric &o) {
+        a00 += o.a00; a01 += o.a01; a02 += o.a02;
+        a11 += o.a11; a12 += o.a12; a22 += o.a22;
+        b0 += o.b0; b1 += o.b1; b2 += o.b2;
+        c += o.c;
+    }
+
+    double Eval(const aiVector3D &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        const double e = a00 * x * x + a11 * y * y + a22 * z * z +
+                2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return std::max(e, 0.0);
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+T *CopySubset(const T *in, const std::vector<unsigned int> &vertices) {
+    if (nullptr == in) {
+        return nullptr;
+    }
+    T *out = new T[vertices.size()];
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        out[i] = in[vertices[i]];
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Builds a mesh from the given triangles, keeping only the vertices they use
+aiMesh *MakeLodMesh(const aiMesh *src, const std::vector<unsigned int> &indices) {
+    std::vector<unsigned int> vMap(src->mNumVertices, UINT_MAX);
+    std::vector<unsigned int> vertices;
+    for (unsigned int index : indices) {
+        if (UINT_MAX == vMap[index]) {
+            vMap[index] = static_cast<unsigned int>(vertices.size());
+            vertices.push_back(index);
+        }
+    }
+
+    aiMesh *out = new aiMesh();
+    out->mName = src->mName;
+    out->mMaterialIndex = src->mMaterialIndex;
+    out->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    out->mMethod = src->mMethod;
+
+    out->mNumVertices = static_cast<unsigned int>(vertices.size());
+    out->mVertices = CopySubset(src->mVertices, vertices);
+    out->mNormals = CopySubset(src->mNormals, vertices);
+    out->mTangents = CopySubset(src->mTangents, vertices);
+    out->mBitangents = CopySubset(src->mBitangents, vertices);
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+        out->mTextureCoords[a] = CopySubset(src->mTextureCoords[a], vertices);
+        out->mNumUVComponents[a] = src->mNumUVComponents[a];
+        if (src->HasTextureCoordsName(a)) {
+            out->SetTextureCoordsName(a, *src->mTextureCoordsNames[a]);
+        }
+    }
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+        out->mColors[a] = CopySubset(src->mColors[a], vertices);
+    }
+
+    out->mNumFaces = static_cast<unsigned int>(indices.size() / 3);
+    out->mFaces = new aiFace[out->mNumFaces];
+    for (unsigned int a = 0; a < out->mNumFaces; ++a) {
+        aiFace &face = out->mFaces[a];
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3];
+        for (unsigned int b = 0; b < 3; ++b) {
+            face.mIndices[b] = vMap[indices[a * 3 + b]];
+        }
+    }
+
+    // bones which lost all of their vertices are dropped
+    std::vector<aiBone *> bones;
+    for (unsigned int a = 0; a < src->mNumBones; ++a) {
+        const aiBone *bone = src->mBones[a];
+        std::vector<aiVertexWeight> weights;
+        for (unsigned int b = 0; b < bone->mNumWeights; ++b) {
+            const unsigned int v = vMap[bone->mWeights[b].mVertexId];
+            if (UINT_MAX != v) {
+                weights.emplace_back(v, bone->mWeights[b].mWeight);
+            }
+        }
+        if (weights.empty()) {
+            continue;
+        }
+        aiBone *newBone = new aiBone();
+        newBone->mName = bone->mName;
+        newBone->mArmature = bone->mArmature;
+        newBone->mNode = bone->mNode;
+        newBone->mOffsetMatrix = bone->mOffsetMatrix;
+        newBone->mNumWeights = static_cast<unsigned int>(weights.size());
+        newBone->mWeights = new aiVertexWeight[weights.size()];
+        std::copy(weights.begin(), weights.end(), newBone->mWeights);
+        bones.push_back(newBone);
+    }
+    if (!bones.empty()) {
+        out->mNumBones = static_cast<unsigned int>(bones.size());
+        out->mBones = new aiBone *[bones.size()];
+        std::copy(bones.begin(), bones.end(), out->mBones);
+    }
+
+    if (src->mNumAnimMeshes) {
+        out->mNumAnimMeshes = src->mNumAnimMeshes;
+        out->mAnimMeshes = new aiAnimMesh *[src->mNumAnimMeshes];
+        for (unsigned int a = 0; a < src->mNumAnimMeshes; ++a) {
+            const aiAnimMesh *anim = src->mAnimMeshes[a];
+            aiAnimMesh *newAnim = new aiAnimMesh();
+            newAnim->mName = anim->mName;
+            newAnim->mWeight = anim->mWeight;
+            newAnim->mNumVertices = out->mNumVertices;
+            newAnim->mVertices = CopySubset(anim->mVertices, vertices);
+            newAnim->mNormals = CopySubset(anim->mNormals, vertices);
+            newAnim->mTangents = CopySubset(anim->mTangents, vertices);
+            newAnim->mBitangents = CopySubset(anim->mBitangents, vertices);
+            for (unsigned int b = 0; b < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++b) {
+                newAnim->mTextureCoords[b] = CopySubset(anim->mTextureCoords[b], vertices);
+            }
+            for (unsigned int b = 0; b < AI_MAX_NUMBER_OF_COLOR_SETS; ++b) {
+                newAnim->mColors[b] = CopySubset(anim->mColors[b], vertices);
+            }
+            out->mAnimMeshes[a] = newAnim;
+        }
+    }
+
+    // keep the bounding box if aiProcess_GenBoundingBoxes computed one
+    if (src->mAABB.mMin != src->mAABB.mMax && out->mNumVertices) {
+        out->mAABB.mMin = out->mAABB.mMax = out->mVertices[0];
+        MinMaxVectors(out->mVertices + 1, out->mNumVertices - 1, out->mAABB.mMin, out->mAABB.mMax);
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Greedy half-edge collapse simplification of a single triangle mesh
+class Simplifier {
+public:
+    explicit Simplifier(const aiMesh *mesh);
+
+    // Collapses edges until no more than target triangles are left
+    void Run(size_t target);
+
+    size_t NumTriangles() const { return mNumTriangles; }
+    std::vector<unsigned int> GetIndices() const;
+
+private:
+    enum Kind : unsigned char {
+        Interior,
+        Border,
+        Locked
+    };
+
+    struct Candidate {
+        double cost;
+        unsigned int u, v;
+        bool operator>(const Candidate &o) const { return cost > o.cost; }
+    };
+
+    bool SameAttributes(unsigned int a, unsigned int b) const;
+    double AttributeError(unsigned int u, unsigned int v) const;
+    double Cost(unsigned int u, unsigned int v) const;
+    bool CanCollapse(unsigned int u, unsigned int v) const;
+    void Collapse(unsigned int u, unsigned int v);
+    void Push(unsigned int u, unsigned int v);
+    void PushEdges(unsigned int v);
+    void GatherNeighbours(unsigned int v, unsigned int skip, std::vector<unsigned int> &out) const;
+
+    const aiMesh *mMesh;
+    std::vector<unsigned int> mIndices;          // three per triangle
+    std::vector<bool> mDeadTriangle;
+    size_t mNumTriangles;
+    std::vector<unsigned int> mPosition;         // first vertex with the same position
+    std::vector<Kind> mKind;
+    std::vector<bool> mDeadVertex;
+    std::vector<Quadric> mQuadrics;
+    std::vector<std::vector<unsigned int>> mTriangles; // triangles around each vertex
+    double mAttributeScale;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> mQueue;
+};
+
+// ------------------------------------------------------------------------------------------------
+Simplifier::Simplifier(const aiMesh *mesh) :
+        mMesh(mesh),
+        mNumTriangles(0),
+        mPosition(mesh->mNumVertices),
+        mKind(mesh->mNumVertices, Interior),
+        mDeadVertex(mesh->mNumVertices, false),
+        mQuadrics(mesh->mNumVertices),
+        mTriangles(mesh->mNumVertices),
+        mAttributeScale(0.0) {
+    const unsigned int numVertices = mesh->mNumVertices;
+    const aiVector3D *pos = mesh->mVertices;
+
+    // Group the vertices by position. Copies with equal attributes are
+    // welded, groups with different attributes form seams, which are locked.
+    std::vector<unsigned int> weld(numVertices);
+    std::vector<unsigned int> order(numVertices);
+    for (unsigned int a = 0; a < numVertices; ++a) {
+        order[a] = a;
+    }
+    std::sort(order.begin(), order.end(), [pos](unsigned int a, unsigned int b) {
+        return pos[a] < pos[b] || (pos[a] == pos[b] && a < b);
+    });
+    std::vector<unsigned int> distinct;
+    for (size_t first = 0; first < order.size();) {
+        size_t last = first + 1;
+        while (last < order.size() && pos[order[last]] == pos[order[first]]) {
+            ++last;
+        }
+        distinct.clear();
+        for (size_t a = first; a < last; ++a) {
+            const unsigned int v = order[a];
+            mPosition[v] = order[first];
+            weld[v] = v;
+            for (unsigned int d : distinct) {
+                if (SameAttributes(d, v)) {
+                    weld[v] = d;
+                    break;
+                }
+            }
+            if (weld[v] == v) {
+                distinct.push_back(v);
+            }
+        }
+        if (distinct.size() > 1) {
+            for (unsigned int d : distinct) {
+                mKind[d] = Locked;
+            }
+        }
+        first = last;
+    }
+
+    mIndices.reserve(size_t(mesh->mNumFaces) * 3);
+    for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+        const aiFace &face = mesh->mFaces[a];
+        const unsigned int i0 = weld[face.mIndices[0]], i1 = weld[face.mIndices[1]], i2 = weld[face.mIndices[2]];
+        if (i0 == i1 || i1 == i2 || i2 == i0) {
+            continue;
+        }
+        mIndices.push_back(i0);
+        mIndices.push_back(i1);
+        mIndices.push_back(i2);
+    }
+    mNumTriangles = mIndices.size() / 3;
+    mDeadTriangle.resize(mNumTriangles, false);
+
+    // Count the faces at each edge. Edges with one face are borders, edges
+    // with more than two faces are non-manifold and locked.
+    auto edgeKey = [this](unsigned int a, unsigned int b) {
+        a = mPosition[a];
+        b = mPosition[b];
+        return a < b ? (uint64_t(a) << 32 | b) : (uint64_t(b) << 32 | a);
+    };
+    std::unordered_map<uint64_t, unsigned int> edges;
+    edges.reserve(mIndices.size());
+    for (size_t a = 0; a < mIndices.size(); a += 3) {
+        for (size_t b = 0; b < 3; ++b) {
+            ++edges[edgeKey(mIndices[a + b], mIndices[a + (b + 1) % 3])];
+        }
+    }
+
+    double edgeSum = 0.0;
+    for (size_t t = 0; t < mNumTriangles; ++t) {
+        const unsigned int *tri = &mIndices[t * 3];
+        for (unsigned int b = 0; b < 3; ++b) {
+            mTriangles[tri[b]].push_back(static_cast<unsigned int>(t));
+        }
+
+        aiVector3D normal = (pos[tri[1]] - pos[tri[0]]) ^ (pos[tri[2]] - pos[tri[0]]);
+        const ai_real length = normal.Length();
+        if (length > ai_real(0.0)) {
+            normal /= length;
+            const ai_real d = -(normal * pos[tri[0]]);
+            for (unsigned int b = 0; b < 3; ++b) {
+                mQuadrics[tri[b]].AddPlane(normal, d, 1.0);
+            }
+        }
+
+        for (unsigned int b = 0; b < 3; ++b) {
+            const unsigned int v0 = tri[b], v1 = tri[(b + 1) % 3];
+            const aiVector3D edge = pos[v1] - pos[v0];
+            edgeSum += edge.SquareLength();
+
+            const unsigned int count = edges[edgeKey(v0, v1)];
+            if (count > 2) {
+                mKind[v0] = mKind[v1] = Locked;
+            } else if (1 == count) {
+                for (unsigned int v : { v0, v1 }) {
+                    if (Locked != mKind[v]) {
+                        mKind[v] = Border;
+                    }
+                }
+                // a plane through the border, perpendicular to the face
+                if (length > ai_real(0.0)) {
+                    aiVector3D side = edge ^ normal;
+                    const ai_real sideLength = side.Length();
+                    if (sideLength > ai_real(0.0)) {
+                        side /= sideLength;
+                        const ai_real d = -(side * pos[v0]);
+                        mQuadrics[v0].AddPlane(side, d, BorderWeight);
+                        mQuadrics[v1].AddPlane(side, d, BorderWeight);
+                    }
+                }
+            }
+        }
+    }
+
+    // Attribute differences are weighed like a displacement by an average edge
+    if (mNumTriangles) {
+        mAttributeScale = edgeSum / double(mNumTriangles * 3);
+    }
+
+    for (size_t t = 0; t < mNumTriangles; ++t) {
+        for (unsigned int b = 0; b < 3; ++b) {
+            Push(mIndices[t * 3 + b], mIndices[t * 3 + (b + 1) % 3]);
+            Push(mIndices[t * 3 + (b + 1) % 3], mIndices[t * 3 + b]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Simplifier::SameAttributes(unsigned int a, unsigned int b) const {
+    const aiMesh *m = mMesh;
+    if (m->mNormals && m->mNormals[a] != m->mNormals[b]) {
+        return false;
+    }
+    if (m->mTangents && (m->mTangents[a] != m->mTangents[b] || m->mBitangents[a] != m->mBitangents[b])) {
+        return false;
+    }
+    for (unsigned int c = 0; m->HasTextureCoords(c); ++c) {
+        if (m->mTextureCoords[c][a] != m->mTextureCoords[c][b]) {
+            return false;
+        }
+    }
+    for (unsigned int c = 0; m->HasVertexColors(c); ++c) {
+        if (m->mColors[c][a] != m->mColors[c][b]) {
+            return false;
+        }
+    }
+    for (unsigned int c = 0; c < m->mNumAnimMeshes; ++c) {
+        const aiAnimMesh *anim = m->mAnimMeshes[c];
+        if ((anim->mVertices && anim->mVertices[a] != anim->mVertices[b]) ||
+                (anim->mNormals && anim->mNormals[a] != anim->mNormals[b])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+double Simplifier::AttributeError(unsigned int u, unsigned int v) const {
+    const aiMesh *m = mMesh;
+    double error = 0.0;
+    if (m->mNormals) {
+        error += (m->mNormals[u] - m->mNormals[v]).SquareLength();
+    }
+    for (unsigned int c = 0; m->HasTextureCoords(c); ++c) {
+        const aiVector3D d = m->mTextureCoords[c][u] - m->mTextureCoords[c][v];
+        error += d.x * d.x + d.y * d.y;
+    }
+    for (unsigned int c = 0; m->HasVertexColors(c); ++c) {
+        const aiColor4D d = m->mColors[c][u] - m->mColors[c][v];
+        error += d.r * d.r + d.g * d.g + d.b * d.b + d.a * d.a;
+    }
+    return error * mAttributeScale;
+}
+
+// ------------------------------------------------------------------------------------------------
+double Simplifier::Cost(unsigned int u, unsigned int v) const {
+    Quadric q = mQuadrics[u];
+    q.Add(mQuadrics[v]);
+    return q.Eval(mMesh->mVertices[v]) + AttributeError(u, v);
+}
+
+// ------------------------------------------------------------------------------------------------
+void Simplifier::Push(unsigned int u, unsigned int v) {
+    if (Locked != mKind[u] && !mDeadVertex[u] && !mDeadVertex[v]) {
+        mQueue.push({ Cost(u, v), u, v });
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Simplifier::PushEdges(unsigned int v) {
+    for (unsigned int t : mTriangles[v]) {
+        for (unsigned int b = 0; b < 3; ++b) {
+            const unsigned int w = mIndices[t * 3 + b];
+            if (w != v) {
+                Push(w, v);
+                Push(v, w);
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Simplifier::GatherNeighbours(unsigned int v, unsigned int skip, std::vector<unsigned int> &out) const {
+    out.clear();
+    for (unsigned int t : mTriangles[v]) {
+        if (mDeadTriangle[t]) {
+            continue;
+        }
+        for (unsigned int b = 0; b < 3; ++b) {
+            const unsigned int w = mPosition[mIndices[t * 3 + b]];
+            if (w != mPosition[v] && w != skip) {
+                out.push_back(w);
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Simplifier::CanCollapse(unsigned int u, unsigned int v) const {
+    const aiVector3D *pos = mMesh->mVertices;
+    unsigned int shared = 0;
+    for (unsigned int t : mTriangles[u]) {
+        if (mDeadTriangle[t]) {
+            continue;
+        }
+        const unsigned int *tri = &mIndices[t * 3];
+        if (tri[0] == v || tri[1] == v || tri[2] == v) {
+            ++shared;
+            continue;
+        }
+
+        // another copy of v would end up in the same face
+        for (unsigned int b = 0; b < 3; ++b) {
+            if (mPosition[tri[b]] == mPosition[v]) {
+                return false;
+            }
+        }
+
+        // the face must not flip or degenerate
+        aiVector3D p[3] = { pos[tri[0]], pos[tri[1]], pos[tri[2]] };
+        const aiVector3D before = (p[1] - p[0]) ^ (p[2] - p[0]);
+        for (unsigned int b = 0; b < 3; ++b) {
+            if (tri[b] == u) {
+                p[b] = pos[v];
+            }
+        }
+        const aiVector3D after = (p[1] - p[0]) ^ (p[2] - p[0]);
+        if (after * before <= MinFaceCosine * after.Length() * before.Length()) {
+            return false;
+        }
+    }
+
+    // interior edges have two faces, border edges one
+    if (shared != (Border == mKind[u] ? 1u : 2u)) {
+        return false;
+    }
+
+    // the only common neighbours of u and v are the opposite vertices of
+    // the shared faces, otherwise the collapse pinches the surface
+    std::vector<unsigned int> nu, nv;
+    GatherNeighbours(u, mPosition[v], nu);
+    GatherNeighbours(v, mPosition[u], nv);
+    std::vector<unsigned int> common;
+    std::set_intersection(nu.begin(), nu.end(), nv.begin(), nv.end(), std::back_inserter(common));
+    return common.size() == shared;
+}
+
+// ------------------------------------------------------------------------------------------------
+void Simplifier::Collapse(unsigned int u, unsigned int v) {
+    for (unsigned int t : mTriangles[u]) {
+        if (mDeadTriangle[t]) {
+            continue;
+        }
+        unsigned int *tri = &mIndices[t * 3];
+        if (tri[0] == v || tri[1] == v || tri[2] == v) {
+            mDeadTriangle[t] = true;
+            --mNumTriangles;
+            continue;
+        }
+        for (unsigned int b = 0; b < 3; ++b) {
+            if (tri[b] == u) {
+                tri[b] = v;
+            }
+        }
+        mTriangles[v].push_back(t);
+    }
+    mQuadrics[v].Add(mQuadrics[u]);
+    mDeadVertex[u] = true;
+    mTriangles[u].clear();
+
+    std::vector<unsigned int> &around = mTriangles[v];
+    around.erase(std::remove_if(around.begin(), around.end(), [this](unsigned int t) {
+        return mDeadTriangle[t];
+    }), around.end());
+
+    PushEdges(v);
+}
+
+// ------------------------------------------------------------------------------------------------
+void Simplifier::Run(size_t target) {
+    target = std::max<size_t>(target, 1);
+    while (mNumTriangles > target && !mQueue.empty()) {
+        const Candidate top = mQueue.top();
+        mQueue.pop();
+        if (mDeadVertex[top.u] || mDeadVertex[top.v]) {
+            continue;
+        }
+
+        // costs grow as quadrics are merged, requeue outdated entries
+        const double cost = Cost(top.u, top.v);
+        if (cost > top.cost * (1.0 + 1e-6) + 1e-12) {
+            mQueue.push({ cost, top.u, top.v });
+            continue;
+        }
+        if (CanCollapse(top.u, top.v)) {
+            Collapse(top.u, top.v);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+std::vector<unsigned int> Simplifier::GetIndices() const {
+    std::vector<unsigned int> out;
+    out.reserve(mNumTriangles * 3);
+    for (size_t t = 0; t < mDeadTriangle.size(); ++t) {
+        if (!mDeadTriangle[t]) {
+            out.insert(out.end(), &mIndices[t * 3], &mIndices[t * 3] + 3);
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+GenerateLODsProcess::GenerateLODsProcess() :
+        mLevels(0), mRatio(0.5f) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenerateLODsProcess::IsActive(unsigned int) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenerateLODsProcess::SetupProperties(const Importer *pImp) {
+    const int levels = pImp->GetPropertyInteger(AI_CONFIG_PP_LOD_LEVELS, 0);
+    mLevels = levels > 0 ? static_cast<unsigned int>(levels) : 0;
+
+    mRatio = pImp->GetPropertyFloat(AI_CONFIG_PP_LOD_RATIO, 0.5f);
+    if (!(mRatio > 0.0f && mRatio < 1.0f)) {
+        ASSIMP_LOG_WARN("GenerateLODsProcess: AI_CONFIG_PP_LOD_RATIO must be in (0, 1), using 0.5");
+        mRatio = 0.5f;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMesh *GenerateLODsProcess::SimplifyMesh(const aiMesh *mesh, unsigned int targetFaces) {
+    ai_assert(nullptr != mesh);
+    if (nullptr == mesh->mVertices || 0 == mesh->mNumFaces) {
+        return nullptr;
+    }
+    for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+        if (3 != mesh->mFaces[a].mNumIndices) {
+            return nullptr;
+        }
+    }
+
+    Simplifier simplifier(mesh);
+    simplifier.Run(targetFaces);
+    if (0 == simplifier.NumTriangles() || simplifier.NumTriangles() >= mesh->mNumFaces) {
+        return nullptr;
+    }
+    return MakeLodMesh(mesh, simplifier.GetIndices());
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenerateLODsProcess::GenerateChain(const aiMesh *mesh, std::vector<aiMesh *> &lods) const {
+    if ((mesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_DEBUG("GenerateLODsProcess: skipping mesh ", mesh->mName.C_Str(), ", it isn't a triangle mesh");
+        return;
+    }
+
+    // each level is simplified from the one before
+    const aiMesh *prev = mesh;
+    double target = mesh->mNumFaces;
+    for (unsigned int level = 1; level <= mLevels; ++level) {
+        CheckCancel();
+        target *= mRatio;
+        aiMesh *lod = SimplifyMesh(prev, static_cast<unsigned int>(std::ceil(target)));
+        if (nullptr == lod) {
+            break;
+        }
+        lod->mName.Append(("_LOD" + std::to_string(level)).c_str());
+        lods.push_back(lod);
+        prev = lod;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenerateLODsProcess::LinkNode(aiNode *node, const std::vector<std::vector<unsigned int>> &lodMeshes) const {
+    for (unsigned int a = 0; a < node->mNumMeshes; ++a) {
+        const unsigned int mesh = node->mMeshes[a];
+        const std::vector<unsigned int> &lods = lodMeshes[mesh];
+        for (size_t level = 0; level < lods.size(); ++level) {
+            if (nullptr == node->mMetaData) {
+                node->mMetaData = new aiMetadata();
+            }
+            const std::string key = AI_METADATA_LOD_PREFIX + std::to_string(level + 1) + "_" + std::to_string(mesh);
+            node->mMetaData->Add(key, static_cast<uint32_t>(lods[level]));
+        }
+    }
+    for (unsigned int a = 0; a < node->mNumChildren; ++a) {
+        LinkNode(node->mChildren[a], lodMeshes);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenerateLODsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenerateLODsProcess begin");
+    if (0 == mLevels || 0 == pScene->mNumMeshes) {
+        return;
+    }
+
+    const unsigned int numMeshes = pScene->mNumMeshes;
+    std::vector<std::vector<aiMesh *>> chains(numMeshes);
+    try {
+        ParallelFor(numMeshes, [&](size_t i) {
+            GenerateChain(pScene->mMeshes[i], chains[i]);
+        });
+    } catch (...) {
+        for (std::vector<aiMesh *> &chain : chains) {
+            for (aiMesh *lod : chain) {
+                delete lod;
+            }
+        }
+        throw;
+    }
+
+    size_t numLods = 0;
+    for (const std::vector<aiMesh *> &chain : chains) {
+        numLods += chain.size();
+    }
+    if (0 == numLods) {
+        ASSIMP_LOG_DEBUG("GenerateLODsProcess finished. No mesh could be simplified");
+        return;
+    }
+
+    // append the new meshes and remember their indices
+    aiMesh **meshes = new aiMesh *[numMeshes + numLods];
+    std::copy(pScene->mMeshes, pScene->mMeshes + numMeshes, meshes);
+    std::vector<std::vector<unsigned int>> lodMeshes(numMeshes);
+    unsigned int next = numMeshes;
+    for (unsigned int i = 0; i < numMeshes; ++i) {
+        for (aiMesh *lod : chains[i]) {
+            lodMeshes[i].push_back(next);
+            meshes[next++] = lod;
+        }
+    }
+    delete[] pScene->mMeshes;
+    pScene->mMeshes = meshes;
+    pScene->mNumMeshes = next;
+
+    if (nullptr != pScene->mRootNode) {
+        LinkNode(pScene->mRootNode, lodMeshes);
+    }
+
+    ASSIMP_LOG_INFO("GenerateLODsProcess finished. Generated ", numLods, " LOD meshes");
+}
+
+} // Namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_GENLODS_PROCESS
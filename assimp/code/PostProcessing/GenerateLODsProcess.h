@@ -0,0 +1,115 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to generate simplified levels of
+ *        detail for all triangle meshes.
+ */
+
+#pragma once
+
+#ifndef AI_GENERATELODSPROCESS_H_INC
+#define AI_GENERATELODSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <vector>
+
+struct aiMesh;
+struct aiNode;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing step to generate a chain of simplified meshes, one
+ *        per level of detail, for each triangle mesh of the scene.
+ *
+ * The meshes are simplified by quadric error edge collapses which keep the
+ * mesh borders and UV/normal seams in place. The new meshes are appended to
+ * aiScene::mMeshes and linked to the nodes of their source meshes by node
+ * metadata, see #AI_METADATA_LOD_PREFIX.
+ *
+ * There is no aiProcess flag for this step. The importer runs it after all
+ * other steps if #AI_CONFIG_PP_LOD_LEVELS is set.
+ */
+class ASSIMP_API GenerateLODsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenerateLODsProcess();
+    ~GenerateLODsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Always returns false, the step is enabled by a property.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads AI_CONFIG_PP_LOD_LEVELS and AI_CONFIG_PP_LOD_RATIO.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Simplifies a single triangle mesh.
+    /// @param mesh         The source mesh, all faces must be triangles.
+    /// @param targetFaces  The number of faces to aim for.
+    /// @return The simplified mesh, which may have more than targetFaces
+    ///   faces if no further edge can be collapsed. nullptr if no face
+    ///   could be removed at all.
+    static aiMesh *SimplifyMesh(const aiMesh *mesh, unsigned int targetFaces);
+
+private:
+    void GenerateChain(const aiMesh *mesh, std::vector<aiMesh *> &lods) const;
+    void LinkNode(aiNode *node, const std::vector<std::vector<unsigned int>> &lodMeshes) const;
+
+    unsigned int mLevels;
+    float mRatio;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#endif // AI_GENERATELODSPROCESS_H_INC
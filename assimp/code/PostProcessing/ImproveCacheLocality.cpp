@@ -41,9 +41,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 /** @file Implementation of the post processing step to improve the cache locality of a mesh.
  * <br>
- * The algorithm is roughly basing on this paper:
+ * The default algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw reduction isn't implemented yet ...
+ * Alternatively Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" can be
+ * used. Both can be followed by the overdraw reduction of the paper and by a
+ * reordering of the vertex arrays for better vertex fetch locality.
  */
 
 // internal headers
@@ -55,6 +57,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <stdio.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
 #include <stack>
 
 namespace Assimp {
@@ -62,7 +67,10 @@ namespace Assimp {
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() :
-        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE) {
+        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE),
+        mConfigAlgorithm(AI_ICL_ALGORITHM_TIPSIFY),
+        mConfigOverdrawThreshold(0.f),
+        mConfigReorderVertices(false) {
     // empty
 }
 
@@ -77,6 +85,14 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
     // AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
     mConfigCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, PP_ICL_PTCACHE_SIZE);
+    mConfigAlgorithm = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, AI_ICL_ALGORITHM_TIPSIFY);
+    mConfigOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 0.f);
+    mConfigReorderVertices = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_REORDER_VERTICES, false);
+
+    if (mConfigAlgorithm != AI_ICL_ALGORITHM_TIPSIFY && mConfigAlgorithm != AI_ICL_ALGORITHM_FORSYTH) {
+        ASSIMP_LOG_WARN("ImproveCacheLocalityProcess: unknown algorithm ", mConfigAlgorithm, ", using Tipsify");
+        mConfigAlgorithm = AI_ICL_ALGORITHM_TIPSIFY;
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -92,6 +108,7 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        CheckCancel();
         const float res = ProcessMesh(pScene->mMeshes[a], a);
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
@@ -108,54 +125,400 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 }
 
 // ------------------------------------------------------------------------------------------------
-static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
-        unsigned int configCacheDepth, unsigned int meshNum) {
-    ai_real fACMR = 0.0f;
-    unsigned int *piFIFOStack = new unsigned int[configCacheDepth];
-    memset(piFIFOStack, 0xff, configCacheDepth * sizeof(unsigned int));
-    unsigned int *piCur = piFIFOStack;
-    const unsigned int *const piCurEnd = piFIFOStack + configCacheDepth;
-
-    // count the number of cache misses
-    unsigned int iCacheMisses = 0;
-    for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        for (unsigned int qq = 0; qq < 3; ++qq) {
-            bool bInCache = false;
-            for (unsigned int *pp = piFIFOStack; pp < piCurEnd; ++pp) {
-                if (*pp == pcFace->mIndices[qq]) {
-                    // the vertex is in cache
-                    bInCache = true;
-                    break;
-                }
+bool ImproveCacheLocalityProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int meshIndex) {
+    ProcessMesh(pMesh, meshIndex);
+}
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Vertex cache and vertex fetch statistics of an index buffer
+struct CacheStatistics {
+    ai_real mACMR = 0.f; // cache misses per triangle
+    ai_real mATVR = 0.f; // cache misses per referenced vertex
+    ai_real mOverfetch = 0.f; // fetched vertex bytes per referenced vertex byte
+};
+
+// ------------------------------------------------------------------------------------------------
+// Size of a vertex in bytes if all present attributes were interleaved
+unsigned int getVertexSize(const aiMesh *pMesh) {
+    unsigned int size = sizeof(aiVector3D);
+    if (pMesh->HasNormals()) {
+        size += sizeof(aiVector3D);
+    }
+    if (pMesh->HasTangentsAndBitangents()) {
+        size += 2 * sizeof(aiVector3D);
+    }
+    for (unsigned int a = 0; pMesh->HasTextureCoords(a); ++a) {
+        size += pMesh->mNumUVComponents[a] * sizeof(ai_real);
+    }
+    for (unsigned int a = 0; pMesh->HasVertexColors(a); ++a) {
+        size += sizeof(aiColor4D);
+    }
+    return size;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Touches an element of a simulated FIFO cache and returns whether it was a miss. An element is
+// cached if less than depth misses happened since it was loaded; adding depth + 1 to the stamp
+// flushes the whole cache.
+inline bool touchFIFO(std::vector<unsigned int> &stamps, unsigned int &stamp, size_t element, unsigned int depth) {
+    if (stamp - stamps[element] > depth) {
+        stamps[element] = stamp++;
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+CacheStatistics analyzeIndices(const std::vector<unsigned int> &indices, unsigned int numVertices,
+        unsigned int vertexSize, unsigned int cacheDepth) {
+    // vertex fetches go through a cache of 64 lines with 64 bytes each
+    static const unsigned int CacheLineSize = 64;
+    static const unsigned int CacheLineCount = 64;
+
+    std::vector<unsigned int> vertexStamps(numVertices, 0);
+    unsigned int vertexStamp = cacheDepth + 1;
+    std::vector<unsigned int> lineStamps((static_cast<size_t>(numVertices) * vertexSize + CacheLineSize - 1) / CacheLineSize, 0);
+    unsigned int lineStamp = CacheLineCount + 1;
+    std::vector<bool> referenced(numVertices, false);
+
+    unsigned int numReferenced = 0, misses = 0, lineMisses = 0;
+    for (const unsigned int idx : indices) {
+        if (!referenced[idx]) {
+            referenced[idx] = true;
+            ++numReferenced;
+        }
+        if (touchFIFO(vertexStamps, vertexStamp, idx, cacheDepth)) {
+            ++misses;
+
+            const size_t first = static_cast<size_t>(idx) * vertexSize / CacheLineSize;
+            const size_t last = (static_cast<size_t>(idx) * vertexSize + vertexSize - 1) / CacheLineSize;
+            for (size_t line = first; line <= last; ++line) {
+                lineMisses += touchFIFO(lineStamps, lineStamp, line, CacheLineCount) ? 1 : 0;
+            }
+        }
+    }
+
+    CacheStatistics stats;
+    if (!indices.empty()) {
+        stats.mACMR = static_cast<ai_real>(misses) / (indices.size() / 3);
+        stats.mATVR = static_cast<ai_real>(misses) / numReferenced;
+        stats.mOverfetch = static_cast<ai_real>(lineMisses) * CacheLineSize / (static_cast<ai_real>(numReferenced) * vertexSize);
+    }
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+void logStatistics(unsigned int meshNum, const char *stage, const CacheStatistics &stats) {
+    ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, " | ", stage, " | ACMR: ", stats.mACMR, " ATVR: ", stats.mATVR,
+            " overfetch: ", stats.mOverfetch);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Score of a vertex as proposed by Tom Forsyth: vertices recently used and vertices with few
+// remaining triangles are preferred.
+float getForsythVertexScore(int cachePosition, unsigned int liveTriangles, unsigned int cacheSize) {
+    static const float CacheDecayPower = 1.5f;
+    static const float LastTriScore = 0.75f;
+    static const float ValenceBoostScale = 2.0f;
+    static const float ValenceBoostPower = 0.5f;
+
+    if (liveTriangles == 0) {
+        // no triangles left, the vertex is of no use anymore
+        return -1.f;
+    }
+
+    float score = 0.f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // the vertices of the last triangle get a fixed score to avoid
+            // strips of alternating direction
+            score = LastTriScore;
+        } else {
+            const float scaler = 1.f / (cacheSize - 3);
+            score = std::pow(1.f - (cachePosition - 3) * scaler, CacheDecayPower);
+        }
+    }
+    return score + ValenceBoostScale * std::pow(static_cast<float>(liveTriangles), -ValenceBoostPower);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Tom Forsyth's "Linear-Speed Vertex Cache Optimisation". The next triangle is the best scoring
+// triangle around the vertices in the simulated LRU cache. At dead ends the next not yet emitted
+// triangle in input order is taken, which keeps the runtime linear.
+void optimizeForsyth(aiMesh *pMesh, unsigned int cacheSize, std::vector<unsigned int> &indices) {
+    const unsigned int numFaces = pMesh->mNumFaces;
+    const unsigned int numVertices = pMesh->mNumVertices;
+
+    VertexTriangleAdjacency adj(pMesh->mFaces, numFaces, numVertices, true);
+    std::vector<unsigned int> liveTriangles(adj.mLiveTriangles, adj.mLiveTriangles + numVertices);
+    const std::vector<unsigned int> numAdjacent(liveTriangles);
+
+    std::vector<int> cachePosition(numVertices, -1);
+    std::vector<float> vertexScore(numVertices);
+    for (unsigned int v = 0; v < numVertices; ++v) {
+        vertexScore[v] = getForsythVertexScore(-1, liveTriangles[v], cacheSize);
+    }
+
+    std::vector<float> triangleScore(numFaces);
+    std::vector<bool> emitted(numFaces, false);
+    unsigned int bestTriangle = 0;
+    for (unsigned int t = 0; t < numFaces; ++t) {
+        const aiFace &face = pMesh->mFaces[t];
+        triangleScore[t] = vertexScore[face.mIndices[0]] + vertexScore[face.mIndices[1]] + vertexScore[face.mIndices[2]];
+        if (triangleScore[t] > triangleScore[bestTriangle]) {
+            bestTriangle = t;
+        }
+    }
+
+    std::vector<unsigned int> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+    unsigned int cursor = 0;
+
+    indices.clear();
+    indices.reserve(numFaces * 3);
+    for (unsigned int numEmitted = 0; numEmitted < numFaces; ++numEmitted) {
+        if (bestTriangle == UINT_MAX) {
+            // dead end, continue with the next triangle in input order
+            while (emitted[cursor]) {
+                ++cursor;
+            }
+            bestTriangle = cursor;
+        }
+
+        // emit the triangle and move its vertices to the front of the cache
+        const aiFace &face = pMesh->mFaces[bestTriangle];
+        emitted[bestTriangle] = true;
+        newCache.clear();
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int v = face.mIndices[i];
+            indices.push_back(v);
+            --liveTriangles[v];
+            if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+                newCache.push_back(v);
+            }
+        }
+        for (const unsigned int v : cache) {
+            if (v != face.mIndices[0] && v != face.mIndices[1] && v != face.mIndices[2]) {
+                newCache.push_back(v);
             }
-            if (!bInCache) {
-                ++iCacheMisses;
-                if (piCurEnd == piCur) {
-                    piCur = piFIFOStack;
+        }
+
+        // rescore the cached and the evicted vertices
+        for (size_t i = 0; i < newCache.size(); ++i) {
+            const unsigned int v = newCache[i];
+            cachePosition[v] = i < cacheSize ? static_cast<int>(i) : -1;
+            vertexScore[v] = getForsythVertexScore(cachePosition[v], liveTriangles[v], cacheSize);
+        }
+
+        // rescore their remaining triangles and pick the best one
+        bestTriangle = UINT_MAX;
+        float bestScore = -1.f;
+        for (const unsigned int v : newCache) {
+            const unsigned int *adjacent = adj.GetAdjacentTriangles(v);
+            for (unsigned int i = 0; i < numAdjacent[v]; ++i) {
+                const unsigned int t = adjacent[i];
+                if (emitted[t]) {
+                    continue;
+                }
+                const aiFace &other = pMesh->mFaces[t];
+                triangleScore[t] = vertexScore[other.mIndices[0]] + vertexScore[other.mIndices[1]] + vertexScore[other.mIndices[2]];
+                if (triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    bestTriangle = t;
                 }
-                *piCur++ = pcFace->mIndices[qq];
             }
         }
+
+        if (newCache.size() > cacheSize) {
+            newCache.resize(cacheSize);
+        }
+        cache.swap(newCache);
     }
-    delete[] piFIFOStack;
-    fACMR = (ai_real)iCacheMisses / pMesh->mNumFaces;
-    if (3.0 == fACMR) {
-        char szBuff[128]; // should be sufficiently large in every case
+}
 
-        // the JoinIdenticalVertices process has not been executed on this
-        // mesh, otherwise this value would normally be at least minimally
-        // smaller than 3.0 ...
-        ai_snprintf(szBuff, 128, "Mesh %u: Not suitable for vcache optimization", meshNum);
-        ASSIMP_LOG_WARN(szBuff);
-        return static_cast<ai_real>(0.f);
+// ------------------------------------------------------------------------------------------------
+// Overdraw reduction from the Tipsify paper. The index buffer is cut into clusters where the cache
+// is flushed anyway, and further where a cluster already reaches the cache efficiency of the whole
+// run times the threshold. Clusters facing outwards are then drawn first.
+void reorderForOverdraw(const aiMesh *pMesh, std::vector<unsigned int> &indices, unsigned int cacheDepth, float threshold) {
+    const unsigned int numTriangles = static_cast<unsigned int>(indices.size() / 3);
+    std::vector<unsigned int> stamps(pMesh->mNumVertices, 0);
+    unsigned int stamp = cacheDepth + 1;
+    auto countMisses = [&](unsigned int t) {
+        unsigned int misses = 0;
+        for (unsigned int i = 0; i < 3; ++i) {
+            misses += touchFIFO(stamps, stamp, indices[t * 3 + i], cacheDepth) ? 1 : 0;
+        }
+        return misses;
+    };
+
+    // hard boundaries, where all three vertices of a triangle miss the cache
+    std::vector<unsigned int> hardBoundaries;
+    for (unsigned int t = 0; t < numTriangles; ++t) {
+        if (countMisses(t) == 3 || t == 0) {
+            hardBoundaries.push_back(t);
+        }
+    }
+
+    // soft boundaries
+    std::vector<unsigned int> clusters;
+    for (size_t h = 0; h < hardBoundaries.size(); ++h) {
+        const unsigned int start = hardBoundaries[h];
+        const unsigned int end = h + 1 < hardBoundaries.size() ? hardBoundaries[h + 1] : numTriangles;
+
+        stamp += cacheDepth + 1;
+        unsigned int misses = 0;
+        for (unsigned int t = start; t < end; ++t) {
+            misses += countMisses(t);
+        }
+        const float target = static_cast<float>(misses) / (end - start) * threshold;
+
+        stamp += cacheDepth + 1;
+        clusters.push_back(start);
+        unsigned int clusterStart = start;
+        misses = 0;
+        for (unsigned int t = start; t < end; ++t) {
+            misses += countMisses(t);
+            if (t + 1 < end && misses <= target * (t + 1 - clusterStart)) {
+                clusters.push_back(t + 1);
+                clusterStart = t + 1;
+                misses = 0;
+                stamp += cacheDepth + 1;
+            }
+        }
+    }
+    clusters.push_back(numTriangles);
+
+    // area weighted centroid and normal of each cluster
+    const size_t numClusters = clusters.size() - 1;
+    std::vector<aiVector3D> centroids(numClusters), normals(numClusters);
+    std::vector<ai_real> areas(numClusters, 0.f);
+    aiVector3D meshCentroid;
+    ai_real meshArea = 0.f;
+    for (size_t c = 0; c < numClusters; ++c) {
+        for (unsigned int t = clusters[c]; t < clusters[c + 1]; ++t) {
+            const aiVector3D &v0 = pMesh->mVertices[indices[t * 3]];
+            const aiVector3D &v1 = pMesh->mVertices[indices[t * 3 + 1]];
+            const aiVector3D &v2 = pMesh->mVertices[indices[t * 3 + 2]];
+            const aiVector3D normal = (v1 - v0) ^ (v2 - v0);
+            const ai_real area = normal.Length();
+            centroids[c] += (v0 + v1 + v2) * (area / 3.f);
+            normals[c] += normal;
+            areas[c] += area;
+        }
+        meshCentroid += centroids[c];
+        meshArea += areas[c];
+        if (areas[c] > 0.f) {
+            centroids[c] /= areas[c];
+        }
+    }
+    if (meshArea > 0.f) {
+        meshCentroid /= meshArea;
+    }
+
+    std::vector<ai_real> sortKeys(numClusters, 0.f);
+    for (size_t c = 0; c < numClusters; ++c) {
+        const ai_real length = normals[c].Length();
+        if (length > 0.f) {
+            sortKeys[c] = ((centroids[c] - meshCentroid) * normals[c]) / length;
+        }
+    }
+
+    std::vector<unsigned int> order(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        order[c] = static_cast<unsigned int>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](unsigned int a, unsigned int b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    std::vector<unsigned int> output;
+    output.reserve(indices.size());
+    for (const unsigned int c : order) {
+        output.insert(output.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+    }
+    indices.swap(output);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class T>
+void permuteArray(T *&data, const std::vector<unsigned int> &remap) {
+    if (nullptr == data) {
+        return;
+    }
+    T *permuted = new T[remap.size()];
+    for (size_t i = 0; i < remap.size(); ++i) {
+        permuted[remap[i]] = data[i];
+    }
+    delete[] data;
+    data = permuted;
+}
+
+template <class XMesh>
+void permuteVertexArrays(XMesh *pMesh, const std::vector<unsigned int> &remap) {
+    permuteArray(pMesh->mVertices, remap);
+    permuteArray(pMesh->mNormals, remap);
+    permuteArray(pMesh->mTangents, remap);
+    permuteArray(pMesh->mBitangents, remap);
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; ++a) {
+        permuteArray(pMesh->mColors[a], remap);
+    }
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++a) {
+        permuteArray(pMesh->mTextureCoords[a], remap);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Renumbers the vertices in the order they are first referenced by the faces, so the vertex
+// arrays are read front to back. Unreferenced vertices are kept at the end.
+void reorderVertexFetch(aiMesh *pMesh) {
+    std::vector<unsigned int> remap(pMesh->mNumVertices, UINT_MAX);
+    unsigned int next = 0;
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        const aiFace &face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            if (remap[face.mIndices[i]] == UINT_MAX) {
+                remap[face.mIndices[i]] = next++;
+            }
+        }
+    }
+    for (unsigned int &r : remap) {
+        if (r == UINT_MAX) {
+            r = next++;
+        }
+    }
+
+    permuteVertexArrays(pMesh, remap);
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+        permuteVertexArrays(pMesh->mAnimMeshes[a], remap);
+    }
+    for (unsigned int a = 0; a < pMesh->mNumBones; ++a) {
+        aiBone *bone = pMesh->mBones[a];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+        }
+    }
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        aiFace &face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            face.mIndices[i] = remap[face.mIndices[i]];
+        }
     }
-    return fACMR;
 }
 
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Improves the cache coherency of a specific mesh
 ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum) {
-    // TODO: rewrite this to use std::vector or boost::shared_array
     ai_assert(nullptr != pMesh);
 
     // Check whether the input data is valid
@@ -173,14 +536,81 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
         return static_cast<ai_real>(0.f);
     }
 
-    ai_real fACMR = 3.f;
-    const aiFace *const pcEnd = pMesh->mFaces + pMesh->mNumFaces;
+    // Statistics are for logging purposes only
+    const bool logResult = !DefaultLogger::isNullLogger();
+    const bool logStages = logResult && DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE;
+    const unsigned int vertexSize = getVertexSize(pMesh);
+
+    // work on one flat index buffer, the faces are only written back at the end
+    std::vector<unsigned int> indices;
+    indices.reserve(pMesh->mNumFaces * 3);
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+    }
 
-    // Input ACMR is for logging purposes only
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR = calculateInputACMR(pMesh, pcEnd, mConfigCacheDepth, meshNum);
+    if (logResult) {
+        const CacheStatistics input = analyzeIndices(indices, pMesh->mNumVertices, vertexSize, mConfigCacheDepth);
+        if (input.mACMR == 3.f) {
+            // the JoinIdenticalVertices process has not been executed on this
+            // mesh, otherwise this value would normally be at least minimally
+            // smaller than 3.0 ...
+            ASSIMP_LOG_WARN("Mesh ", meshNum, ": Not suitable for vcache optimization");
+        }
+        if (logStages) {
+            logStatistics(meshNum, "input", input);
+        }
+    }
+
+    if (mConfigAlgorithm == AI_ICL_ALGORITHM_FORSYTH) {
+        optimizeForsyth(pMesh, std::max(mConfigCacheDepth, 4u), indices);
+    } else {
+        OptimizeTipsify(pMesh, indices);
+    }
+    if (logStages) {
+        logStatistics(meshNum, mConfigAlgorithm == AI_ICL_ALGORITHM_FORSYTH ? "forsyth" : "tipsify",
+                analyzeIndices(indices, pMesh->mNumVertices, vertexSize, mConfigCacheDepth));
+    }
+
+    if (mConfigOverdrawThreshold > 0.f) {
+        reorderForOverdraw(pMesh, indices, mConfigCacheDepth, mConfigOverdrawThreshold);
+        if (logStages) {
+            logStatistics(meshNum, "overdraw", analyzeIndices(indices, pMesh->mNumVertices, vertexSize, mConfigCacheDepth));
+        }
+    }
+
+    // sort the output index buffer back to the input array
+    std::vector<unsigned int>::const_iterator piCSIter = indices.begin();
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        aiFace &face = pMesh->mFaces[a];
+        for (unsigned int b = 0; b < face.mNumIndices; ++b) {
+            face.mIndices[b] = *piCSIter++;
+        }
     }
 
+    if (mConfigReorderVertices) {
+        reorderVertexFetch(pMesh);
+        if (logResult) {
+            indices.clear();
+            for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+                const aiFace &face = pMesh->mFaces[a];
+                indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+            }
+        }
+        if (logStages) {
+            logStatistics(meshNum, "vertex fetch", analyzeIndices(indices, pMesh->mNumVertices, vertexSize, mConfigCacheDepth));
+        }
+    }
+
+    if (!logResult) {
+        return static_cast<ai_real>(0.f);
+    }
+    return analyzeIndices(indices, pMesh->mNumVertices, vertexSize, mConfigCacheDepth).mACMR * pMesh->mNumFaces;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the faces with the Tipsify algorithm
+void ImproveCacheLocalityProcess::OptimizeTipsify(aiMesh *pMesh, std::vector<unsigned int> &piIBOutput) const {
     // first we need to build a vertex-triangle adjacency list
     VertexTriangleAdjacency adj(pMesh->mFaces, pMesh->mNumFaces, pMesh->mNumVertices, true);
 
@@ -193,7 +623,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     // Since the number of triangles won't change the input faces can be reused. This is how
     // we save thousands of redundant mini allocations for aiFace::mIndices
     const unsigned int iIdxCnt = pMesh->mNumFaces * 3;
-    std::vector<unsigned int> piIBOutput;
     piIBOutput.resize(iIdxCnt);
     std::vector<unsigned int>::iterator piCSIter = piIBOutput.begin();
 
@@ -220,7 +649,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     ai_assert(iMaxRefTris > 0);
     std::vector<unsigned int> piCandidates;
     piCandidates.resize(iMaxRefTris * 3);
-    unsigned int iCacheMisses = 0;
 
     // ...................................................................................
     /** PSEUDOCODE for the algorithm
@@ -292,7 +720,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
                     // if the vertex is not yet in cache, set its cache count
                     if (iStampCnt - piCachingStamps[dp] > mConfigCacheDepth) {
                         piCachingStamps[dp] = iStampCnt++;
-                        ++iCacheMisses;
                     }
                 }
                 // flag triangle as emitted
@@ -352,31 +779,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             }
         }
     }
-    ai_real fACMR2 = 0.0f;
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR2 = static_cast<ai_real>(iCacheMisses / pMesh->mNumFaces);
-        const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
-        // very intense verbose logging ... prepare for much text if there are many meshes
-        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
-            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", fACMR, " out: ", fACMR2, " | average ACMR ", averageACMR);
-        }
-        fACMR2 *= pMesh->mNumFaces;
-    }
-
-    // sort the output index buffer back to the input array
-    piCSIter = piIBOutput.begin();
-    for (aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        unsigned nind = pcFace->mNumIndices;
-        unsigned *ind = pcFace->mIndices;
-        if (nind > 0)
-            ind[0] = *piCSIter++;
-        if (nind > 1)
-            ind[1] = *piCSIter++;
-        if (nind > 2)
-            ind[2] = *piCSIter++;
-    }
-
-    return fACMR2;
 }
 
 } // namespace Assimp
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp {
@@ -57,9 +59,12 @@ namespace Assimp {
  *  cache locality. It tries to arrange all faces to fans and to render
  *  faces which share vertices directly one after the other.
  *
+ *  Optionally the faces are reordered afterwards to reduce overdraw, and the
+ *  vertices are reordered for vertex fetch locality.
+ *
  *  @note This step expects triagulated input data.
  */
-class ImproveCacheLocalityProcess : public BaseProcess {
+class ASSIMP_API ImproveCacheLocalityProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -74,6 +79,12 @@ public:
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
     // -------------------------------------------------------------------
     // Configures the pp step
     void SetupProperties(const Importer* pImp) override;
@@ -86,10 +97,27 @@ protected:
      */
     ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
 
+    // -------------------------------------------------------------------
+    /** Orders the faces of a mesh with the Tipsify algorithm
+     * @param pMesh The mesh to process.
+     * @param piIBOutput Receives the reordered indices
+     */
+    void OptimizeTipsify( aiMesh* pMesh, std::vector<unsigned int>& piIBOutput) const;
+
 private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Configuration parameter: the face ordering algorithm
+    int mConfigAlgorithm;
+
+    //! Configuration parameter: allowed ACMR increase for overdraw
+    //! reduction, disabled if <= 0
+    float mConfigOverdrawThreshold;
+
+    //! Configuration parameter: reorder vertices for fetch locality
+    bool mConfigReorderVertices;
 };
 
 } // end of namespace Assimp
@@ -47,10 +47,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
+#include "Common/ParallelFor.h"
 #include <assimp/Vertex.h>
 #include <assimp/TinyFormatter.h>
 
 #include <stdio.h>
+#include <algorithm>
+#include <cstring>
 #include <unordered_set>
 #include <unordered_map>
 #include <memory>
@@ -63,6 +66,12 @@ using namespace Assimp;
 bool JoinVerticesProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Setup properties for the step
+void JoinVerticesProcess::SetupProperties(const Importer* pImp) {
+    mExactMatch = pImp->GetPropertyBool(AI_CONFIG_PP_JIV_EXACT_MATCH, false);
+}
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene) {
@@ -78,8 +87,21 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
 
     // execute the step
     int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+    if (mExactMatch) {
+        // the exact mode shares no state between meshes, so they can be processed concurrently
+        std::vector<int> numVertices(pScene->mNumMeshes, 0);
+        ParallelFor(pScene->mNumMeshes, [&](size_t a) {
+            CheckCancel();
+            numVertices[a] = ProcessMesh(pScene->mMeshes[a], static_cast<unsigned int>(a));
+        });
+        for (int n : numVertices) {
+            iNumVertices += n;
+        }
+    } else {
+        for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+            CheckCancel();
+            iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+        }
     }
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
@@ -98,6 +120,21 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool JoinVerticesProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int meshIndex) {
+    ProcessMesh(pMesh, meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::ExecuteAfterMeshes(aiScene *pScene) {
+    pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
+}
+
 namespace {
 
 struct CompareVerticesAlmostEqual {
@@ -215,6 +252,139 @@ void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// One vertex attribute array that takes part in the exact comparison
+struct KeyChannel {
+    const ai_real *data;
+    unsigned int stride;
+    unsigned int width;
+};
+
+unsigned int getUVWidth(const aiMesh *pMesh, unsigned int channel) {
+    // only the used components, unless the count is bogus
+    const unsigned int width = pMesh->mNumUVComponents[channel];
+    return (width == 0 || width > 3) ? 3 : width;
+}
+
+unsigned int getUVWidth(const aiAnimMesh *, unsigned int) {
+    return 3;
+}
+
+template<class XMesh>
+void collectKeyChannels(const XMesh *pMesh, std::vector<KeyChannel> &channels) {
+    static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D must be tightly packed");
+    static_assert(sizeof(aiColor4D) == 4 * sizeof(ai_real), "aiColor4D must be tightly packed");
+
+    if (pMesh->mVertices) {
+        channels.push_back({ &pMesh->mVertices[0].x, 3, 3 });
+    }
+    if (pMesh->mNormals) {
+        channels.push_back({ &pMesh->mNormals[0].x, 3, 3 });
+    }
+    if (pMesh->mTangents && pMesh->mBitangents) {
+        channels.push_back({ &pMesh->mTangents[0].x, 3, 3 });
+        channels.push_back({ &pMesh->mBitangents[0].x, 3, 3 });
+    }
+    for (unsigned int a = 0; pMesh->HasTextureCoords(a); a++) {
+        channels.push_back({ &pMesh->mTextureCoords[a][0].x, 3, getUVWidth(pMesh, a) });
+    }
+    for (unsigned int a = 0; pMesh->HasVertexColors(a); a++) {
+        channels.push_back({ &pMesh->mColors[a][0].r, 4, 4 });
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Finds the bitwise identical vertices of a mesh. The present attributes of each used vertex are
+// packed into a key row, the rows are hashed and sorted, and equal rows end up next to each other.
+// Vertices are numbered in order of first appearance, like the epsilon based path does.
+void findExactDuplicates(const aiMesh *pMesh, const std::vector<bool> &usedVertexIndicesMask,
+        std::vector<unsigned int> &replaceIndex, std::vector<int> &uniqueVertices, unsigned int joinedMark) {
+    std::vector<KeyChannel> channels;
+    collectKeyChannels(pMesh, channels);
+    // animated vertices must not be merged if they move apart
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; a++) {
+        collectKeyChannels(pMesh->mAnimMeshes[a], channels);
+    }
+
+    size_t keyWidth = 0;
+    for (const KeyChannel &channel : channels) {
+        keyWidth += channel.width;
+    }
+
+    std::vector<unsigned int> vertices;
+    vertices.reserve(pMesh->mNumVertices);
+    for (unsigned int a = 0; a < pMesh->mNumVertices; a++) {
+        if (usedVertexIndicesMask[a]) {
+            vertices.push_back(a);
+        }
+    }
+    const size_t numVertices = vertices.size();
+
+    // pack the keys; -0 is folded into +0 so both compare equal
+    std::vector<ai_real> keys(numVertices * keyWidth);
+    std::vector<uint64_t> hashes(numVertices);
+    for (size_t i = 0; i < numVertices; i++) {
+        ai_real *row = &keys[i * keyWidth];
+        for (const KeyChannel &channel : channels) {
+            const ai_real *src = channel.data + static_cast<size_t>(vertices[i]) * channel.stride;
+            for (unsigned int c = 0; c < channel.width; c++) {
+                *row++ = src[c] == ai_real(0.0) ? ai_real(0.0) : src[c];
+            }
+        }
+
+        // FNV-1a over the 32 bit words of the key
+        uint64_t hash = 14695981039346656037ull;
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&keys[i * keyWidth]);
+        for (size_t b = 0; b < keyWidth * sizeof(ai_real); b += sizeof(uint32_t)) {
+            uint32_t word;
+            ::memcpy(&word, bytes + b, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ull;
+        }
+        hashes[i] = hash;
+    }
+
+    const size_t keyBytes = keyWidth * sizeof(ai_real);
+    auto compareKeys = [&](unsigned int l, unsigned int r) {
+        return ::memcmp(&keys[l * keyWidth], &keys[r * keyWidth], keyBytes);
+    };
+
+    std::vector<unsigned int> sorted(numVertices);
+    for (size_t i = 0; i < numVertices; i++) {
+        sorted[i] = static_cast<unsigned int>(i);
+    }
+    std::sort(sorted.begin(), sorted.end(), [&](unsigned int l, unsigned int r) {
+        if (hashes[l] != hashes[r]) {
+            return hashes[l] < hashes[r];
+        }
+        const int cmp = compareKeys(l, r);
+        return cmp != 0 ? cmp < 0 : l < r;
+    });
+
+    // the first vertex of each group of equal keys represents the group
+    std::vector<unsigned int> representative(numVertices);
+    for (size_t i = 0; i < numVertices;) {
+        const unsigned int first = sorted[i];
+        size_t end = i + 1;
+        while (end < numVertices && hashes[sorted[end]] == hashes[first] && compareKeys(sorted[end], first) == 0) {
+            end++;
+        }
+        for (; i < end; i++) {
+            representative[sorted[i]] = first;
+        }
+    }
+
+    unsigned int newIndex = 0;
+    for (size_t i = 0; i < numVertices; i++) {
+        const unsigned int a = vertices[i];
+        if (representative[i] == i) {
+            replaceIndex[a] = newIndex++;
+            uniqueVertices.push_back(a);
+        } else {
+            replaceIndex[a] = replaceIndex[vertices[representative[i]]] | joinedMark;
+        }
+    }
+}
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -266,37 +436,44 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
             uniqueAnimatedVertices[animMeshIndex].reserve(pMesh->mNumVertices);
         }
     }
-    // a map that maps a vertex to its new index
-    std::unordered_map<Vertex, int, HashVertex, CompareVerticesAlmostEqual> vertex2Index = {};
-    // we can not end up with more vertices than we started with
-    // Now check each vertex if it brings something new to the table
-    int newIndex = 0;
-    for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
-        // if the vertex is unused Do nothing
-        if (!usedVertexIndicesMask[a]) {
-            continue;
+    if (mExactMatch) {
+        findExactDuplicates(pMesh, usedVertexIndicesMask, replaceIndex, uniqueVertices, JOINED_VERTICES_MARK);
+        for (unsigned int animMeshIndex = 0; animMeshIndex < uniqueAnimatedVertices.size(); animMeshIndex++) {
+            uniqueAnimatedVertices[animMeshIndex] = uniqueVertices;
         }
-        // collect the vertex data
-        Vertex v(pMesh,a);
-        // is the vertex already in the map?
-        auto it = vertex2Index.find(v);
-        // if the vertex is not in the map then it is a new vertex add it.
-        if (it == vertex2Index.end()) {
-            // this is a new vertex give it a new index
-            vertex2Index.emplace(v, newIndex);
-            // keep track of its index and increment 1
-            replaceIndex[a] = newIndex++;
-            // add the vertex to the unique vertices
-            uniqueVertices.push_back(a);
-            if (hasAnimMeshes) {
-                for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-                    uniqueAnimatedVertices[animMeshIndex].emplace_back(a);
+    } else {
+        // a map that maps a vertex to its new index
+        std::unordered_map<Vertex, int, HashVertex, CompareVerticesAlmostEqual> vertex2Index = {};
+        // we can not end up with more vertices than we started with
+        // Now check each vertex if it brings something new to the table
+        int newIndex = 0;
+        for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
+            // if the vertex is unused Do nothing
+            if (!usedVertexIndicesMask[a]) {
+                continue;
+            }
+            // collect the vertex data
+            Vertex v(pMesh,a);
+            // is the vertex already in the map?
+            auto it = vertex2Index.find(v);
+            // if the vertex is not in the map then it is a new vertex add it.
+            if (it == vertex2Index.end()) {
+                // this is a new vertex give it a new index
+                vertex2Index.emplace(v, newIndex);
+                // keep track of its index and increment 1
+                replaceIndex[a] = newIndex++;
+                // add the vertex to the unique vertices
+                uniqueVertices.push_back(a);
+                if (hasAnimMeshes) {
+                    for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+                        uniqueAnimatedVertices[animMeshIndex].emplace_back(a);
+                    }
                 }
+            } else{
+                // if the vertex is already there just find the replace index that is appropriate to it
+                // mark it with JOINED_VERTICES_MARK
+                replaceIndex[a] = it->second | JOINED_VERTICES_MARK;
             }
-        } else{
-            // if the vertex is already there just find the replace index that is appropriate to it
-			// mark it with JOINED_VERTICES_MARK
-            replaceIndex[a] = it->second | JOINED_VERTICES_MARK;
         }
     }
 
@@ -75,6 +75,13 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Called prior to ExecuteOnScene().
+    * The function is a request to the process to update its configuration
+    * basing on the Importer's configuration property list.
+    */
+    void SetupProperties(const Importer* pImp) override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
@@ -82,12 +89,25 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    void ExecuteOnMesh(aiMesh* pMesh, unsigned int meshIndex) override;
+
+    // -------------------------------------------------------------------
+    void ExecuteAfterMeshes(aiScene* pScene) override;
+
     // -------------------------------------------------------------------
     /** Unites identical vertices in the given mesh.
      * @param pMesh The mesh to process.
      * @param meshIndex Index of the mesh to process
      */
     int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
+
+private:
+    /// Join bitwise identical vertices only, see #AI_CONFIG_PP_JIV_EXACT_MATCH
+    bool mExactMatch = false;
 };
 
 } // end of namespace Assimp
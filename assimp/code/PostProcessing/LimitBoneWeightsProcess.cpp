@@ -72,12 +72,23 @@ void LimitBoneWeightsProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess begin");
 
     for (unsigned int m = 0; m < pScene->mNumMeshes; ++m) {
+        CheckCancel();
         ProcessMesh(pScene->mMeshes[m]);
     }
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess end");
 }
 
+// ------------------------------------------------------------------------------------------------
+bool LimitBoneWeightsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void LimitBoneWeightsProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    ProcessMesh(pMesh);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void LimitBoneWeightsProcess::SetupProperties(const Importer* pImp) {
@@ -0,0 +1,131 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the PackIndicesProcess post-processing step.
+ */
+
+#ifndef ASSIMP_BUILD_NO_PACKINDICES_PROCESS
+
+#include "PostProcessing/PackIndicesProcess.h"
+#include "Common/ParallelFor.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/scene.h>
+
+#include <limits>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+PackIndicesProcess::PackIndicesProcess() : mWant16(false) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PackIndicesProcess::IsActive(unsigned int) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PackIndicesProcess::SetupProperties(const Importer *pImp) {
+    mWant16 = pImp->GetPropertyBool(AI_CONFIG_PP_PI_16BIT, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PackIndicesProcess::PackMesh(aiMesh *mesh, bool want16) {
+    ai_assert(nullptr != mesh);
+
+    // faces pointing into an old buffer get their own copies first
+    mesh->ReleaseIndexBuffer();
+    if (nullptr == mesh->mFaces || 0 == mesh->mNumFaces) {
+        return;
+    }
+
+    size_t numIndices = 0;
+    for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+        numIndices += mesh->mFaces[a].mNumIndices;
+    }
+    if (0 == numIndices) {
+        return;
+    }
+    if (numIndices > std::numeric_limits<unsigned int>::max()) {
+        ASSIMP_LOG_WARN("PackIndicesProcess: too many indices in mesh ", mesh->mName.C_Str(), ", skipping it");
+        return;
+    }
+
+    unsigned int *indices = new unsigned int[numIndices];
+    unsigned int *out = indices;
+    for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+        aiFace &face = mesh->mFaces[a];
+        if (0 != face.mNumIndices) {
+            ::memcpy(out, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+        }
+        delete[] face.mIndices;
+        // Empty faces must not point at the end of the shared buffer
+        face.mIndices = (0 != face.mNumIndices) ? out : nullptr;
+        out += face.mNumIndices;
+    }
+
+    mesh->mIndices = indices;
+    mesh->mNumIndices = static_cast<unsigned int>(numIndices);
+
+    if (want16 && mesh->mNumVertices <= 0x10000u) {
+        mesh->mIndices16 = new unsigned short[numIndices];
+        for (size_t i = 0; i < numIndices; ++i) {
+            mesh->mIndices16[i] = static_cast<unsigned short>(indices[i]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PackIndicesProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("PackIndicesProcess begin");
+
+    ParallelFor(pScene->mNumMeshes, [&](size_t i) {
+        PackMesh(pScene->mMeshes[i], mWant16);
+    });
+
+    ASSIMP_LOG_DEBUG("PackIndicesProcess finished");
+}
+
+} // Namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_PACKINDICES_PROCESS
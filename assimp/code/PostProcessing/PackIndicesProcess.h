@@ -0,0 +1,100 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to store the faces of each mesh
+ *        in a single contiguous index buffer.
+ */
+
+#pragma once
+
+#ifndef AI_PACKINDICESPROCESS_H_INC
+#define AI_PACKINDICESPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_PACKINDICES_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing step to move the indices of all faces of a mesh
+ *        into aiMesh::mIndices.
+ *
+ * There is no aiProcess flag for this step. The importer runs it after all
+ * other steps if #AI_CONFIG_PP_PI_ENABLE is set.
+ */
+class ASSIMP_API PackIndicesProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    PackIndicesProcess();
+    ~PackIndicesProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Always returns false, the step is enabled by a property.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads AI_CONFIG_PP_PI_16BIT.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Packs the faces of a single mesh.
+    /// @param mesh     The mesh, an existing index buffer is rebuilt.
+    /// @param want16   Also provide aiMesh::mIndices16 if possible.
+    static void PackMesh(aiMesh *mesh, bool want16);
+
+private:
+    bool mWant16;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_PACKINDICES_PROCESS
+
+#endif // AI_PACKINDICESPROCESS_H_INC
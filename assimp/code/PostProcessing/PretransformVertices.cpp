@@ -45,6 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PretransformVertices.h"
 #include "ConvertToLHProcess.h"
 #include "ProcessHelper.h"
+#include "Common/ScenePrivate.h"
+#include "Common/simd.h"
 #include <assimp/Exceptional.h>
 #include <assimp/SceneCombiner.h>
 
@@ -146,6 +148,17 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 		unsigned int aiCurrent[2], unsigned int *num_refs) const {
 	// No need to multiply if there's no transformation
 	const bool identity = pcNode->mTransformation.IsIdentity();
+
+	// the normal matrix is shared by all meshes of the node
+	aiMatrix3x3 m;
+	if (!identity) {
+		aiMatrix4x4 mWorldIT = pcNode->mTransformation;
+		mWorldIT.Inverse().Transpose();
+
+		// TODO: implement Inverse() for aiMatrix3x3
+		m = aiMatrix3x3(mWorldIT);
+	}
+
 	for (unsigned int i = 0; i < pcNode->mNumMeshes; ++i) {
 		aiMesh *pcMesh = pcScene->mMeshes[pcNode->mMeshes[i]];
 		if (iMat == pcMesh->mMaterialIndex && iVFormat == GetMeshVFormat(pcMesh)) {
@@ -182,28 +195,20 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 				}
 			} else {
 				// copy positions, transform them to worldspace
-				for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-					pcMeshOut->mVertices[aiCurrent[AI_PTVS_VERTEX] + n] = pcNode->mTransformation * pcMesh->mVertices[n];
-				}
-				aiMatrix4x4 mWorldIT = pcNode->mTransformation;
-				mWorldIT.Inverse().Transpose();
-
-				// TODO: implement Inverse() for aiMatrix3x3
-				aiMatrix3x3 m = aiMatrix3x3(mWorldIT);
+				TransformPoints(pcNode->mTransformation, pcMesh->mVertices,
+						pcMeshOut->mVertices + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices);
 
 				if (iVFormat & 0x2) {
 					// copy normals, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-						pcMeshOut->mNormals[aiCurrent[AI_PTVS_VERTEX] + n] =
-								(m * pcMesh->mNormals[n]).Normalize();
-					}
+					TransformDirections(m, pcMesh->mNormals,
+							pcMeshOut->mNormals + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices);
 				}
 				if (iVFormat & 0x4) {
 					// copy tangents and bitangents, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-						pcMeshOut->mTangents[aiCurrent[AI_PTVS_VERTEX] + n] = (m * pcMesh->mTangents[n]).Normalize();
-						pcMeshOut->mBitangents[aiCurrent[AI_PTVS_VERTEX] + n] = (m * pcMesh->mBitangents[n]).Normalize();
-					}
+					TransformDirections(m, pcMesh->mTangents,
+							pcMeshOut->mTangents + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices);
+					TransformDirections(m, pcMesh->mBitangents,
+							pcMeshOut->mBitangents + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices);
 				}
 			}
 			unsigned int p = 0;
@@ -306,9 +311,7 @@ void PretransformVertices::ApplyTransform(aiMesh *mesh, const aiMatrix4x4 &mat)
 
 	// Update positions
 	if (mesh->HasPositions()) {
-		for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-			mesh->mVertices[i] = mat * mesh->mVertices[i];
-		}
+		TransformPoints(mat, mesh->mVertices, mesh->mVertices, mesh->mNumVertices);
 	}
 
 	// Update normals and tangents
@@ -316,16 +319,12 @@ void PretransformVertices::ApplyTransform(aiMesh *mesh, const aiMatrix4x4 &mat)
 		const aiMatrix3x3 m = aiMatrix3x3(mat).Inverse().Transpose();
 
 		if (mesh->HasNormals()) {
-			for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-                mesh->mNormals[i] = (m * mesh->mNormals[i]).Normalize();
-            }
+			TransformDirections(m, mesh->mNormals, mesh->mNormals, mesh->mNumVertices);
 		}
 
 		if (mesh->HasTangentsAndBitangents()) {
-			for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-				mesh->mTangents[i] = (m * mesh->mTangents[i]).Normalize();
-				mesh->mBitangents[i] = (m * mesh->mBitangents[i]).Normalize();
-			}
+			TransformDirections(m, mesh->mTangents, mesh->mTangents, mesh->mNumVertices);
+			TransformDirections(m, mesh->mBitangents, mesh->mBitangents, mesh->mNumVertices);
 		}
 	}
 }
@@ -579,7 +578,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 	// --- we need to keep all cameras and lights
 	for (unsigned int i = 0; i < pScene->mNumCameras; ++i) {
 		aiCamera *cam = pScene->mCameras[i];
-		const aiNode *nd = pScene->mRootNode->FindNode(cam->mName);
+		const aiNode *nd = GetSceneIndex(pScene).FindNode(cam->mName);
         ai_assert(nullptr != nd);
 
 		// multiply all properties of the camera with the absolute
@@ -591,7 +590,7 @@ void PretransformVertices::Execute(aiScene *pScene) {
 
 	for (unsigned int i = 0; i < pScene->mNumLights; ++i) {
 		aiLight *l = pScene->mLights[i];
-		const aiNode *nd = pScene->mRootNode->FindNode(l->mName);
+		const aiNode *nd = GetSceneIndex(pScene).FindNode(l->mName);
         ai_assert(nullptr != nd);
 
 		// multiply all properties of the camera with the absolute
@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ProcessHelper.h"
 
+#include <algorithm>
 #include <limits>
 
 namespace Assimp {
@@ -213,6 +214,100 @@ VertexWeightTable *ComputeVertexBoneWeightTable(const aiMesh *pMesh) {
     return avPerVertexWeights;
 }
 
+// -------------------------------------------------------------------------------
+void ComputeVertexAdjacency(const aiMesh *pMesh, const SpatialSort &sort, ai_real epsilon, VertexAdjacency &out) {
+    const unsigned int numVertices = pMesh->mNumVertices;
+    const size_t blockSize = 4096;
+    const size_t numBlocks = (size_t(numVertices) + blockSize - 1) / blockSize;
+
+    // query the neighbours of each block of vertices in parallel ...
+    std::vector<std::vector<unsigned int>> found(numBlocks);
+    out.mOffsets.assign(size_t(numVertices) + 1, 0);
+    ParallelFor(numBlocks, [&](size_t block) {
+        std::vector<unsigned int> neighbours;
+        const unsigned int end = static_cast<unsigned int>(std::min(size_t(numVertices), (block + 1) * blockSize));
+        for (unsigned int i = static_cast<unsigned int>(block * blockSize); i < end; ++i) {
+            sort.FindPositions(pMesh->mVertices[i], epsilon, neighbours);
+            out.mOffsets[i + 1] = static_cast<unsigned int>(neighbours.size());
+            found[block].insert(found[block].end(), neighbours.begin(), neighbours.end());
+        }
+    });
+
+    // ... and pack them
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        out.mOffsets[i + 1] += out.mOffsets[i];
+    }
+    out.mNeighbours.resize(out.mOffsets.back());
+    ParallelFor(numBlocks, [&](size_t block) {
+        std::copy(found[block].begin(), found[block].end(), out.mNeighbours.begin() + out.mOffsets[block * blockSize]);
+        std::vector<unsigned int>().swap(found[block]);
+    });
+
+    // union the neighbourhoods, the root of a group is its smallest vertex
+    std::vector<unsigned int> parent(numVertices);
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        parent[i] = i;
+    }
+    auto findRoot = [&parent](unsigned int i) {
+        while (parent[i] != i) {
+            i = parent[i] = parent[parent[i]];
+        }
+        return i;
+    };
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        for (unsigned int n = out.mOffsets[i]; n < out.mOffsets[i + 1]; ++n) {
+            const unsigned int a = findRoot(i), b = findRoot(out.mNeighbours[n]);
+            parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    // number the groups by their smallest vertex and sort the vertices into them
+    std::vector<unsigned int> group(numVertices);
+    unsigned int numGroups = 0;
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        const unsigned int root = findRoot(i);
+        group[i] = root == i ? numGroups++ : group[root];
+    }
+    out.mGroupOffsets.assign(size_t(numGroups) + 1, 0);
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        ++out.mGroupOffsets[group[i] + 1];
+    }
+    for (unsigned int g = 0; g < numGroups; ++g) {
+        out.mGroupOffsets[g + 1] += out.mGroupOffsets[g];
+    }
+    std::vector<unsigned int> next(out.mGroupOffsets.begin(), out.mGroupOffsets.end() - 1);
+    out.mGroupVertices.resize(numVertices);
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        out.mGroupVertices[next[group[i]]++] = i;
+    }
+}
+
+// -------------------------------------------------------------------------------
+const VertexAdjacency &GetVertexAdjacency(const SharedPostProcessInfo *shared, const aiMesh *pMesh,
+        unsigned int meshIndex, VertexAdjacency &local) {
+    std::vector<std::pair<SpatialSort, ai_real>> *sorts = nullptr;
+    std::vector<VertexAdjacency> *cache = nullptr;
+    if (shared) {
+        shared->GetProperty(AI_SPP_SPATIAL_SORT, sorts);
+        shared->GetProperty(AI_SPP_VERTEX_ADJACENCY, cache);
+    }
+
+    VertexAdjacency &out = cache ? (*cache)[meshIndex] : local;
+    if (out.mOffsets.size() == size_t(pMesh->mNumVertices) + 1) {
+        return out;
+    }
+
+    if (sorts) {
+        const std::pair<SpatialSort, ai_real> &sort = (*sorts)[meshIndex];
+        ComputeVertexAdjacency(pMesh, sort.first, sort.second, out);
+    } else {
+        SpatialSort sort;
+        sort.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof(aiVector3D));
+        ComputeVertexAdjacency(pMesh, sort, ComputePositionEpsilon(pMesh), out);
+    }
+    return out;
+}
+
 // -------------------------------------------------------------------------------
 const char *MappingTypeToString(aiTextureMapping in) {
     switch (in) {
@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 
 #include "Common/BaseProcess.h"
+#include "Common/ParallelFor.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/SpatialSort.h>
 
@@ -319,6 +320,47 @@ using VertexWeightTable = std::vector<PerVertexWeight>;
 // Compute a per-vertex bone weight table
 VertexWeightTable *ComputeVertexBoneWeightTable(const aiMesh *pMesh);
 
+// -------------------------------------------------------------------------------
+// The vertices of a mesh which share their position within an epsilon. The
+// neighbours of vertex i, itself included, are mNeighbours[mOffsets[i]] to
+// mNeighbours[mOffsets[i + 1] - 1], in the order SpatialSort::FindPositions()
+// returns them. Vertices linked by neighbourhood form a group, the vertices of
+// group g are mGroupVertices[mGroupOffsets[g]] to
+// mGroupVertices[mGroupOffsets[g + 1] - 1] in ascending order. Smoothing
+// across neighbours never reaches into another group.
+struct VertexAdjacency {
+    std::vector<unsigned int> mOffsets;
+    std::vector<unsigned int> mNeighbours;
+    std::vector<unsigned int> mGroupOffsets;
+    std::vector<unsigned int> mGroupVertices;
+};
+
+// -------------------------------------------------------------------------------
+// Compute the vertex adjacency of a mesh from a spatial sort of its vertices
+void ComputeVertexAdjacency(const aiMesh *pMesh, const SpatialSort &sort, ai_real epsilon, VertexAdjacency &out);
+
+// -------------------------------------------------------------------------------
+// Get the vertex adjacency of a mesh. It is taken from or added to the
+// AI_SPP_VERTEX_ADJACENCY cache if there is one, else computed into local.
+const VertexAdjacency &GetVertexAdjacency(const SharedPostProcessInfo *shared, const aiMesh *pMesh,
+        unsigned int meshIndex, VertexAdjacency &local);
+
+// -------------------------------------------------------------------------------
+// Call func(vertex) for all vertices, group by group and in ascending order
+// within a group. Different groups are processed in parallel.
+template <typename Func>
+void ForEachVertexGroup(const VertexAdjacency &adjacency, Func func) {
+    const size_t blockSize = 1024;
+    const size_t numGroups = adjacency.mGroupOffsets.size() - 1;
+    ParallelFor((numGroups + blockSize - 1) / blockSize, [&](size_t block) {
+        const unsigned int begin = adjacency.mGroupOffsets[block * blockSize];
+        const unsigned int end = adjacency.mGroupOffsets[std::min(numGroups, (block + 1) * blockSize)];
+        for (unsigned int i = begin; i < end; ++i) {
+            func(adjacency.mGroupVertices[i]);
+        }
+    });
+}
+
 // -------------------------------------------------------------------------------
 // Get a string for a given aiTextureMapping
 const char *MappingTypeToString(aiTextureMapping in);
@@ -334,9 +376,14 @@ aiMesh *MakeSubmesh(const aiMesh *superMesh, const std::vector<unsigned int> &su
 // Utility post-process step to share the spatial sort tree between
 // all steps which use it to speedup its computations.
 class ComputeSpatialSortProcess : public BaseProcess {
+    // streamed meshes build their own sort in each step
+    bool IsMeshLocal() const {
+        return true;
+    }
+
     bool IsActive(unsigned int pFlags) const {
-        return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace |
-                                                           aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
+        return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace | aiProcess_GenNormals |
+                                                           aiProcess_GenSmoothNormals | aiProcess_JoinIdenticalVertices));
     }
 
     void Execute(aiScene *pScene) {
@@ -354,19 +401,27 @@ class ComputeSpatialSortProcess : public BaseProcess {
         }
 
         shared->AddProperty(AI_SPP_SPATIAL_SORT, p);
+
+        // the adjacency is built by the first step needing it
+        shared->AddProperty(AI_SPP_VERTEX_ADJACENCY, new std::vector<VertexAdjacency>(pScene->mNumMeshes));
     }
 };
 
 // -------------------------------------------------------------------------------
 // ... and the same again to cleanup the whole stuff
 class DestroySpatialSortProcess : public BaseProcess {
+    bool IsMeshLocal() const {
+        return true;
+    }
+
     bool IsActive(unsigned int pFlags) const {
-        return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace |
-                                                        aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
+        return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace | aiProcess_GenNormals |
+                                                        aiProcess_GenSmoothNormals | aiProcess_JoinIdenticalVertices));
     }
 
     void Execute(aiScene * /*pScene*/) {
         shared->RemoveProperty(AI_SPP_SPATIAL_SORT);
+        shared->RemoveProperty(AI_SPP_VERTEX_ADJACENCY);
     }
 };
 
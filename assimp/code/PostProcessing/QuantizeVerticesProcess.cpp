@@ -0,0 +1,346 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the QuantizeVerticesProcess post-processing step.
+ */
+
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#include "PostProcessing/QuantizeVerticesProcess.h"
+#include "Common/ParallelFor.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Maps v from [0, 1] to [0, max], rounded and clamped
+template <typename T>
+T Unorm(double v, double max) {
+    return static_cast<T>(std::min(std::max(std::floor(v * max + 0.5), 0.0), max));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Angle between a decoded direction and the original one, 0 for zero vectors
+double DirectionError(const aiVector3D &original, const aiVector3D &decoded) {
+    const ai_real length = original.Length();
+    if (length <= ai_real(0.0)) {
+        return 0.0;
+    }
+    const double cosine = (original * decoded) / length;
+    return std::acos(std::min(std::max(cosine, -1.0), 1.0));
+}
+
+// ------------------------------------------------------------------------------------------------
+short *QuantizeDirections(const aiVector3D *in, unsigned int num, double &error) {
+    if (nullptr == in) {
+        return nullptr;
+    }
+    short *out = new short[size_t(num) * 2];
+    for (unsigned int a = 0; a < num; ++a) {
+        QuantizeVerticesProcess::EncodeOctahedral(in[a], out + a * 2);
+        error = std::max(error, DirectionError(in[a], QuantizeVerticesProcess::DecodeOctahedral(out + a * 2)));
+    }
+    return out;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+QuantizeVerticesProcess::QuantizeVerticesProcess() :
+        mUnormUVs(false) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool QuantizeVerticesProcess::IsActive(unsigned int) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void QuantizeVerticesProcess::SetupProperties(const Importer *pImp) {
+    mUnormUVs = pImp->GetPropertyBool(AI_CONFIG_PP_QV_UNORM_UVS, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned short QuantizeVerticesProcess::FloatToHalf(float value) {
+    uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t abs = bits & 0x7fffffff;
+
+    // infinity and NaN
+    if (abs >= 0x7f800000) {
+        return static_cast<unsigned short>(sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0));
+    }
+    // too large, 65520 and above round to infinity
+    if (abs >= 0x477ff000) {
+        return static_cast<unsigned short>(sign | 0x7c00);
+    }
+    // subnormal halfs, scaling by 2^24 gives their mantissa
+    if (abs < 0x38800000) {
+        float v;
+        ::memcpy(&v, &abs, sizeof(v));
+        return static_cast<unsigned short>(sign | static_cast<uint32_t>(std::nearbyint(v * 16777216.0f)));
+    }
+    // rebias the exponent and round the mantissa to nearest even
+    uint32_t half = (abs - 0x38000000) >> 13;
+    const uint32_t rest = abs & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        ++half;
+    }
+    return static_cast<unsigned short>(sign | half);
+}
+
+// ------------------------------------------------------------------------------------------------
+float QuantizeVerticesProcess::HalfToFloat(unsigned short value) {
+    const uint32_t sign = uint32_t(value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1f;
+    const uint32_t mantissa = value & 0x3ff;
+
+    uint32_t bits;
+    if (0 == exponent) {
+        const float v = std::ldexp(static_cast<float>(mantissa), -24);
+        ::memcpy(&bits, &v, sizeof(bits));
+    } else if (0x1f == exponent) {
+        bits = 0x7f800000 | (mantissa << 13);
+    } else {
+        bits = ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    bits |= sign;
+
+    float out;
+    ::memcpy(&out, &bits, sizeof(out));
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+void QuantizeVerticesProcess::EncodeOctahedral(const aiVector3D &dir, short *out) {
+    const double l1 = std::fabs(dir.x) + std::fabs(dir.y) + std::fabs(dir.z);
+    if (l1 <= 0.0) {
+        out[0] = out[1] = 0;
+        return;
+    }
+    double x = dir.x / l1, y = dir.y / l1;
+    if (dir.z < 0) {
+        const double ox = x;
+        x = (1.0 - std::fabs(y)) * (ox >= 0.0 ? 1.0 : -1.0);
+        y = (1.0 - std::fabs(ox)) * (y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    // of the four neighbouring grid points keep the one closest to dir
+    const double fx = std::floor(x * 32767.0), fy = std::floor(y * 32767.0);
+    double best = -2.0;
+    for (int dx = 0; dx < 2; ++dx) {
+        for (int dy = 0; dy < 2; ++dy) {
+            const short q[2] = {
+                static_cast<short>(std::min(std::max(fx + dx, -32767.0), 32767.0)),
+                static_cast<short>(std::min(std::max(fy + dy, -32767.0), 32767.0))
+            };
+            const double cosine = DecodeOctahedral(q) * dir;
+            if (cosine > best) {
+                best = cosine;
+                out[0] = q[0];
+                out[1] = q[1];
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D QuantizeVerticesProcess::DecodeOctahedral(const short *in) {
+    ai_real x = in[0] / ai_real(32767.0), y = in[1] / ai_real(32767.0);
+    const ai_real z = 1 - std::fabs(x) - std::fabs(y);
+    const ai_real t = std::max(-z, ai_real(0.0));
+    x += x >= 0 ? -t : t;
+    y += y >= 0 ? -t : t;
+    return aiVector3D(x, y, z).Normalize();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiQuantizedVertices *QuantizeVerticesProcess::Quantize(const aiMesh *mesh, bool unormUVs) {
+    ai_assert(nullptr != mesh);
+    const unsigned int num = mesh->mNumVertices;
+
+    aiQuantizedVertices *out = new aiQuantizedVertices();
+    out->mNumVertices = num;
+    if (0 == num) {
+        return out;
+    }
+
+    // positions relative to the bounding box
+    if (mesh->HasPositions()) {
+        aiVector3D min = mesh->mVertices[0], max = mesh->mVertices[0];
+        for (unsigned int a = 1; a < num; ++a) {
+            const aiVector3D &p = mesh->mVertices[a];
+            min = aiVector3D(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+            max = aiVector3D(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+        }
+        out->mPositionOffset = min;
+        out->mPositionScale = max - min;
+
+        double error = 0.0;
+        out->mPositions = new unsigned short[size_t(num) * 3];
+        for (unsigned int a = 0; a < num; ++a) {
+            for (unsigned int c = 0; c < 3; ++c) {
+                const double offset = out->mPositionOffset[c], scale = out->mPositionScale[c];
+                const double v = mesh->mVertices[a][c];
+                const unsigned short q = scale > 0.0 ? Unorm<unsigned short>((v - offset) / scale, 65535.0) : 0;
+                out->mPositions[a * 3 + c] = q;
+                error = std::max(error, std::fabs(offset + scale * (q / 65535.0) - v));
+            }
+        }
+        out->mPositionError = static_cast<ai_real>(error);
+    }
+
+    double error = 0.0;
+    out->mNormals = QuantizeDirections(mesh->mNormals, num, error);
+    if (mesh->HasTangentsAndBitangents()) {
+        out->mTangents = QuantizeDirections(mesh->mTangents, num, error);
+        out->mBitangents = QuantizeDirections(mesh->mBitangents, num, error);
+    }
+    out->mNormalError = static_cast<ai_real>(error);
+
+    // texture coordinates, either as half floats or relative to the bounds of the channel
+    out->mTextureCoordsFormat = unormUVs ? aiQuantizedUVFormat_UNORM16 : aiQuantizedUVFormat_HALF;
+    error = 0.0;
+    for (unsigned int c = 0; mesh->HasTextureCoords(c); ++c) {
+        const aiVector3D *uv = mesh->mTextureCoords[c];
+        const unsigned int comps = mesh->mNumUVComponents[c];
+        out->mNumUVComponents[c] = comps;
+        unsigned short *q = out->mTextureCoords[c] = new unsigned short[size_t(num) * comps];
+
+        if (unormUVs) {
+            aiVector3D min = uv[0], max = uv[0];
+            for (unsigned int a = 1; a < num; ++a) {
+                min = aiVector3D(std::min(min.x, uv[a].x), std::min(min.y, uv[a].y), std::min(min.z, uv[a].z));
+                max = aiVector3D(std::max(max.x, uv[a].x), std::max(max.y, uv[a].y), std::max(max.z, uv[a].z));
+            }
+            out->mTextureCoordsOffset[c] = min;
+            out->mTextureCoordsScale[c] = max - min;
+        }
+
+        for (unsigned int a = 0; a < num; ++a) {
+            for (unsigned int b = 0; b < comps; ++b) {
+                const double v = uv[a][b];
+                double decoded;
+                if (unormUVs) {
+                    const double offset = out->mTextureCoordsOffset[c][b], scale = out->mTextureCoordsScale[c][b];
+                    q[a * comps + b] = scale > 0.0 ? Unorm<unsigned short>((v - offset) / scale, 65535.0) : 0;
+                    decoded = offset + scale * (q[a * comps + b] / 65535.0);
+                } else {
+                    q[a * comps + b] = FloatToHalf(static_cast<float>(v));
+                    decoded = HalfToFloat(q[a * comps + b]);
+                }
+                error = std::max(error, std::fabs(decoded - v));
+            }
+        }
+    }
+    out->mTextureCoordsError = static_cast<ai_real>(error);
+
+    error = 0.0;
+    for (unsigned int c = 0; mesh->HasVertexColors(c); ++c) {
+        const aiColor4D *col = mesh->mColors[c];
+        unsigned char *q = out->mColors[c] = new unsigned char[size_t(num) * 4];
+        for (unsigned int a = 0; a < num; ++a) {
+            for (unsigned int b = 0; b < 4; ++b) {
+                const double v = col[a][b];
+                q[a * 4 + b] = Unorm<unsigned char>(v, 255.0);
+                error = std::max(error, std::fabs(q[a * 4 + b] / 255.0 - v));
+            }
+        }
+    }
+    out->mColorError = static_cast<ai_real>(error);
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+void QuantizeVerticesProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("QuantizeVerticesProcess begin");
+
+    std::atomic<size_t> sizeIn(0), sizeOut(0);
+    ParallelFor(pScene->mNumMeshes, [&](size_t i) {
+        CheckCancel();
+        aiMesh *mesh = pScene->mMeshes[i];
+        delete mesh->mQuantizedVertices;
+        mesh->mQuantizedVertices = Quantize(mesh, mUnormUVs);
+
+        // bytes per vertex of the full and the quantized streams
+        size_t in = 0, out = 0;
+        if (mesh->HasPositions()) {
+            in += 12;
+            out += 6;
+        }
+        if (mesh->HasNormals()) {
+            in += 12;
+            out += 4;
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            in += 24;
+            out += 8;
+        }
+        for (unsigned int c = 0; mesh->HasTextureCoords(c); ++c) {
+            in += 4 * mesh->mNumUVComponents[c];
+            out += 2 * mesh->mNumUVComponents[c];
+        }
+        for (unsigned int c = 0; mesh->HasVertexColors(c); ++c) {
+            in += 16;
+            out += 4;
+        }
+        sizeIn += in * mesh->mNumVertices;
+        sizeOut += out * mesh->mNumVertices;
+    });
+
+    ASSIMP_LOG_INFO("QuantizeVerticesProcess finished. Vertex data: ", sizeIn.load(), " bytes, quantized: ", sizeOut.load(), " bytes");
+}
+
+} // Namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
@@ -0,0 +1,117 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to build quantized copies of the
+ *        vertex streams of all meshes.
+ */
+
+#pragma once
+
+#ifndef AI_QUANTIZEVERTICESPROCESS_H_INC
+#define AI_QUANTIZEVERTICESPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <assimp/vector3.h>
+
+struct aiMesh;
+struct aiQuantizedVertices;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing step to fill aiMesh::mQuantizedVertices.
+ *
+ * There is no aiProcess flag for this step. The importer runs it after all
+ * other steps if #AI_CONFIG_PP_QV_ENABLE is set.
+ */
+class ASSIMP_API QuantizeVerticesProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    QuantizeVerticesProcess();
+    ~QuantizeVerticesProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Always returns false, the step is enabled by a property.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads AI_CONFIG_PP_QV_UNORM_UVS.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Quantizes the vertex streams of a single mesh.
+    /// @param mesh      The mesh, it isn't changed.
+    /// @param unormUVs  Store texture coordinates as unorm16 instead of
+    ///                  half floats.
+    /// @return The quantized streams, owned by the caller.
+    static aiQuantizedVertices *Quantize(const aiMesh *mesh, bool unormUVs);
+
+    // -------------------------------------------------------------------
+    /// @brief Conversions between floats and IEEE 754 half floats. Values
+    ///        are rounded to the nearest half float.
+    static unsigned short FloatToHalf(float value);
+    static float HalfToFloat(unsigned short value);
+
+    // -------------------------------------------------------------------
+    /// @brief Octahedral encoding of a direction into two snorm16 values,
+    ///        as described at aiQuantizedVertices. Zero vectors encode
+    ///        to (0, 0, 1).
+    static void EncodeOctahedral(const aiVector3D &dir, short *out);
+    static aiVector3D DecodeOctahedral(const short *in);
+
+private:
+    bool mUnormUVs;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#endif // AI_QUANTIZEVERTICESPROCESS_H_INC
@@ -0,0 +1,213 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the ReduceKeyframesProcess post-processing step.
+ */
+
+#ifndef ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
+
+#include "PostProcessing/ReduceKeyframesProcess.h"
+#include "Common/ParallelFor.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/anim.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace Assimp {
+
+namespace {
+
+// Longest span a single pair of keys may replace. Every extension re-checks all keys of the
+// span, so this bounds the greedy search to linear time in the number of keys.
+constexpr unsigned int MaxSpanKeys = 64;
+
+// ------------------------------------------------------------------------------------------------
+// Errors between an interpolated and an original key value
+ai_real KeyError(const aiVector3D &a, const aiVector3D &b, bool perComponent) {
+    const aiVector3D d = a - b;
+    if (perComponent) {
+        return std::max(std::fabs(d.x), std::max(std::fabs(d.y), std::fabs(d.z)));
+    }
+    return d.Length();
+}
+
+ai_real KeyError(const aiQuaternion &a, const aiQuaternion &b, bool) {
+    // q and -q are the same rotation, the angle between them is 2 acos(|<a,b>|)
+    const ai_real dot = std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) /
+            std::sqrt((a.x * a.x + a.y * a.y + a.z * a.z + a.w * a.w) * (b.x * b.x + b.y * b.y + b.z * b.z + b.w * b.w));
+    return ai_real(2.0) * std::acos(std::min(dot, ai_real(1.0)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether the keys between first and last are reproduced by the two of them
+template <typename TKey>
+bool IsRedundantSpan(const TKey *keys, unsigned int first, unsigned int last, ai_real tolerance, bool perComponent) {
+    const aiAnimInterpolation mode = keys[first].mInterpolation;
+    const double span = keys[last].mTime - keys[first].mTime;
+    if (span <= 0.0) {
+        return false;
+    }
+    Interpolator<TKey> interpolate;
+    for (unsigned int k = first + 1; k < last; ++k) {
+        // the keys in between decide how their segments are interpolated
+        if (keys[k].mInterpolation != mode) {
+            return false;
+        }
+        decltype(TKey::mValue) value = keys[first].mValue;
+        if (aiAnimInterpolation_Step != mode) {
+            interpolate(value, keys[first], keys[last], static_cast<ai_real>((keys[k].mTime - keys[first].mTime) / span));
+        }
+        if (KeyError(value, keys[k].mValue, perComponent) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Greedily extends spans from the last kept key as far as the tolerance and MaxSpanKeys allow
+template <typename TKey>
+unsigned int ReduceKeys(TKey *&keys, unsigned int &numKeys, ai_real tolerance, bool perComponent) {
+    if (numKeys < 2) {
+        return 0;
+    }
+
+    // a constant track needs a single key
+    std::vector<unsigned int> kept(1, 0);
+    bool constant = aiAnimInterpolation_Cubic_Spline != keys[0].mInterpolation;
+    for (unsigned int k = 1; constant && k < numKeys; ++k) {
+        constant = keys[k].mInterpolation == keys[0].mInterpolation &&
+                   KeyError(keys[0].mValue, keys[k].mValue, perComponent) <= tolerance;
+    }
+
+    for (unsigned int first = 0; !constant && first + 1 < numKeys;) {
+        unsigned int last = first + 1;
+        const aiAnimInterpolation mode = keys[first].mInterpolation;
+        if (aiAnimInterpolation_Linear == mode || aiAnimInterpolation_Spherical_Linear == mode || aiAnimInterpolation_Step == mode) {
+            while (last + 1 < numKeys && last + 1 - first <= MaxSpanKeys &&
+                    IsRedundantSpan(keys, first, last + 1, tolerance, perComponent)) {
+                ++last;
+            }
+        }
+        kept.push_back(last);
+        first = last;
+    }
+
+    const unsigned int removed = numKeys - static_cast<unsigned int>(kept.size());
+    if (removed) {
+        TKey *reduced = new TKey[kept.size()];
+        for (size_t i = 0; i < kept.size(); ++i) {
+            reduced[i] = keys[kept[i]];
+        }
+        delete[] keys;
+        keys = reduced;
+        numKeys = static_cast<unsigned int>(kept.size());
+    }
+    return removed;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+ReduceKeyframesProcess::ReduceKeyframesProcess() :
+        mPositionError(ai_real(1e-4)), mRotationError(ai_real(1e-4)), mScalingError(ai_real(1e-4)) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ReduceKeyframesProcess::IsActive(unsigned int) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ReduceKeyframesProcess::SetupProperties(const Importer *pImp) {
+    mPositionError = pImp->GetPropertyFloat(AI_CONFIG_PP_RK_POSITION_ERROR, 1e-4f);
+    mRotationError = pImp->GetPropertyFloat(AI_CONFIG_PP_RK_ROTATION_ERROR, 1e-4f);
+    mScalingError = pImp->GetPropertyFloat(AI_CONFIG_PP_RK_SCALING_ERROR, 1e-4f);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ReduceKeyframesProcess::ReduceChannel(aiNodeAnim *channel, ai_real positionError,
+        ai_real rotationError, ai_real scalingError) {
+    ai_assert(nullptr != channel);
+    return ReduceKeys(channel->mPositionKeys, channel->mNumPositionKeys, positionError, false) +
+           ReduceKeys(channel->mRotationKeys, channel->mNumRotationKeys, rotationError, false) +
+           ReduceKeys(channel->mScalingKeys, channel->mNumScalingKeys, scalingError, true);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ReduceKeyframesProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("ReduceKeyframesProcess begin");
+
+    std::vector<aiNodeAnim *> channels;
+    size_t keysIn = 0;
+    for (unsigned int a = 0; a < pScene->mNumAnimations; ++a) {
+        const aiAnimation *anim = pScene->mAnimations[a];
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            aiNodeAnim *channel = anim->mChannels[c];
+            keysIn += size_t(channel->mNumPositionKeys) + channel->mNumRotationKeys + channel->mNumScalingKeys;
+            channels.push_back(channel);
+        }
+    }
+
+    // the channels are independent of each other
+    std::atomic<size_t> removed(0);
+    ParallelFor(channels.size(), [&](size_t i) {
+        CheckCancel();
+        removed += ReduceChannel(channels[i], mPositionError, mRotationError, mScalingError);
+    });
+
+    if (keysIn) {
+        ASSIMP_LOG_INFO("ReduceKeyframesProcess finished. Removed ", removed.load(), " of ", keysIn,
+                " keys, compression ratio ", static_cast<double>(keysIn) / (keysIn - removed.load()));
+    } else {
+        ASSIMP_LOG_DEBUG("ReduceKeyframesProcess finished. There are no animation keys");
+    }
+}
+
+} // Namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
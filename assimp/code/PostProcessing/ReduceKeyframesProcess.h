@@ -0,0 +1,106 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to remove redundant animation keys.
+ */
+
+#pragma once
+
+#ifndef AI_REDUCEKEYFRAMESPROCESS_H_INC
+#define AI_REDUCEKEYFRAMESPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiNodeAnim;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing step to remove animation keys which are reproduced
+ *        by interpolating their neighbours.
+ *
+ * There is no aiProcess flag for this step. The importer runs it after all
+ * flag-driven steps if #AI_CONFIG_PP_RK_ENABLE is set.
+ */
+class ASSIMP_API ReduceKeyframesProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    ReduceKeyframesProcess();
+    ~ReduceKeyframesProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Always returns false, the step is enabled by a property.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the tolerances, AI_CONFIG_PP_RK_xxx_ERROR.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Removes the redundant keys of a single channel.
+    /// @param channel        The channel, its key arrays are replaced.
+    /// @param positionError  Largest distance of a removed position key.
+    /// @param rotationError  Largest angle of a removed rotation key.
+    /// @param scalingError   Largest difference of a removed scaling key,
+    ///                       per component.
+    /// @return The number of removed keys.
+    static unsigned int ReduceChannel(aiNodeAnim *channel, ai_real positionError,
+            ai_real rotationError, ai_real scalingError);
+
+private:
+    ai_real mPositionError;
+    ai_real mRotationError;
+    ai_real mScalingError;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_REDUCEKEYFRAMES_PROCESS
+
+#endif // AI_REDUCEKEYFRAMESPROCESS_H_INC
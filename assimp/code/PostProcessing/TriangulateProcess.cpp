@@ -61,6 +61,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "PostProcessing/TriangulateProcess.h"
 #include "PostProcessing/ProcessHelper.h"
+#include "Common/ParallelFor.h"
 #include "Common/PolyTools.h"
 #include "contrib/earcut-hpp/earcut.hpp"
 
@@ -172,6 +173,44 @@ namespace {
         unsigned int mLastNGONFirstIndex;
     };
 
+    // ------------------------------------------------------------------------------------------------
+    /** Projects the polygon onto the plane spanned by the axes ac and bc.
+     *  The axes are template arguments so the inner loop reads fixed members.
+     */
+    template <unsigned int ac, unsigned int bc>
+    void ProjectPolygon(const aiVector3D *verts, const unsigned int *idx, unsigned int num, aiVector2D *out) {
+        for (unsigned int tmp = 0; tmp < num; ++tmp) {
+            const aiVector3D &v = verts[idx[tmp]];
+            out[tmp].x = v[ac];
+            out[tmp].y = v[bc];
+        }
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    /** Returns true if the projected, ccw polygon is strictly convex.
+     *  Every corner must turn left, and the edges must turn around only once,
+     *  which rules out star shapes winding several times.
+     */
+    bool IsConvexPolygon(const aiVector2D *poly, unsigned int num) {
+        aiVector2D edge = poly[0] - poly[num - 1];
+        float lastSign = 0.f;
+        unsigned int flips = 0;
+        for (unsigned int i = 0; i < num; ++i) {
+            const aiVector2D next = poly[i + 1 == num ? 0 : i + 1] - poly[i];
+            if (edge.x * next.y - edge.y * next.x <= 0.f) {
+                return false;
+            }
+            if (next.x != 0.f) {
+                if (lastSign * next.x < 0.f && ++flips > 2) {
+                    return false;
+                }
+                lastSign = next.x;
+            }
+            edge = next;
+        }
+        return true;
+    }
+
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -185,22 +224,31 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const {
 void TriangulateProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
-        if (pScene->mMeshes[ a ]) {
-            if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
-                bHas = true;
-            }
+    // the meshes are triangulated independently of each other
+    std::vector<char> triangulated(pScene->mNumMeshes, 0);
+    ParallelFor(pScene->mNumMeshes, [&](size_t a) {
+        CheckCancel();
+        if (pScene->mMeshes[a]) {
+            triangulated[a] = TriangulateMesh(pScene->mMeshes[a]);
         }
-    }
-    if ( bHas ) {
+    });
+    if (std::find(triangulated.begin(), triangulated.end(), 1) != triangulated.end()) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
         ASSIMP_LOG_DEBUG( "TriangulateProcess finished. There was nothing to be done." );
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool TriangulateProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::ExecuteOnMesh(aiMesh *pMesh, unsigned int /*meshIndex*/) {
+    TriangulateMesh(pMesh);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Triangulates the given mesh.
 bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
@@ -265,6 +313,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
     std::vector<std::vector<aiVector2D>> temp_poly(1); /* temporary storage for earcut.hpp */
     std::vector<aiVector2D>& temp_verts = temp_poly[0];
     temp_verts.reserve(max_out + 2);
+    mapbox::detail::Earcut<unsigned int> earcut; /* reused, keeps its index buffer across faces */
 
     NGONEncoder ngonEncoder;
 
@@ -372,10 +421,10 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
         else
         {
             // A polygon with more than 3 vertices can be either concave or convex.
-            // Usually everything we're getting is convex and we could easily
+            // Usually everything we're getting is convex and we can easily
             // triangulate by tri-fanning. However, LightWave is probably the only
             // modeling suite to make extensive use of highly concave, monster polygons ...
-            // so we need to apply the full 'ear cutting' algorithm to get it right.
+            // so for those we need to apply the full 'ear cutting' algorithm to get it right.
 
             // REQUIREMENT: polygon is expected to be simple and *nearly* planar.
             // We project it onto a plane to get a 2d triangle.
@@ -417,19 +466,45 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
             }
 
             temp_verts.resize(num);
-            for (unsigned int tmp = 0; tmp < num; ++tmp) {
-                temp_verts[tmp].x = verts[idx[tmp]][ac];
-                temp_verts[tmp].y = verts[idx[tmp]][bc];
+            if (0 == ac) {
+                if (1 == bc) {
+                    ProjectPolygon<0, 1>(verts, idx, num, temp_verts.data());
+                } else {
+                    ProjectPolygon<0, 2>(verts, idx, num, temp_verts.data());
+                }
+            } else if (1 == ac) {
+                if (2 == bc) {
+                    ProjectPolygon<1, 2>(verts, idx, num, temp_verts.data());
+                } else {
+                    ProjectPolygon<1, 0>(verts, idx, num, temp_verts.data());
+                }
+            } else if (0 == bc) {
+                ProjectPolygon<2, 0>(verts, idx, num, temp_verts.data());
+            } else {
+                ProjectPolygon<2, 1>(verts, idx, num, temp_verts.data());
             }
 
-            auto indices = mapbox::earcut(temp_poly);
-            for (size_t i = 0; i < indices.size(); i += 3) {
-                aiFace& nface = *curOut++;
-                nface.mIndices = new unsigned int[3];
-                nface.mNumIndices = 3;
-                nface.mIndices[0] = indices[i];
-                nface.mIndices[1] = indices[i + 1];
-                nface.mIndices[2] = indices[i + 2];
+            if (IsConvexPolygon(temp_verts.data(), num)) {
+                // convex polygons - by far the most common case - are simply tri-fanned
+                for (unsigned int i = 1; i + 1 < num; ++i) {
+                    aiFace& nface = *curOut++;
+                    nface.mIndices = new unsigned int[3];
+                    nface.mNumIndices = 3;
+                    nface.mIndices[0] = 0;
+                    nface.mIndices[1] = i;
+                    nface.mIndices[2] = i + 1;
+                }
+            } else {
+                earcut(temp_poly);
+                const std::vector<unsigned int>& indices = earcut.indices;
+                for (size_t i = 0; i < indices.size(); i += 3) {
+                    aiFace& nface = *curOut++;
+                    nface.mIndices = new unsigned int[3];
+                    nface.mNumIndices = 3;
+                    nface.mIndices[0] = indices[i];
+                    nface.mIndices[1] = indices[i + 1];
+                    nface.mIndices[2] = indices[i + 2];
+                }
             }
 
 #ifdef AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -47,8 +47,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "ValidateDataStructure.h"
 #include "ProcessHelper.h"
+#include "Common/ParallelFor.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/fast_atof.h>
+#include <exception>
 #include <memory>
 
 // CRT headers
@@ -56,15 +58,30 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace Assimp;
 
+namespace {
+
+// Collects the warnings of a mesh validated on a worker thread, so they
+// can be logged in mesh order afterwards.
+thread_local std::vector<std::string> *gWarningSink = nullptr;
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
-ValidateDSProcess::ValidateDSProcess() : mScene(nullptr) {}
+ValidateDSProcess::ValidateDSProcess() : mScene(nullptr), mLevel(aiValidationLevel_FULL) {}
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
 bool ValidateDSProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_ValidateDataStructure) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration properties for the step
+void ValidateDSProcess::SetupProperties(const Importer *pImp) {
+    mLevel = std::min(static_cast<unsigned int>(pImp->GetPropertyInteger(AI_CONFIG_PP_VDS_LEVEL, aiValidationLevel_FULL)),
+            static_cast<unsigned int>(aiValidationLevel_FULL));
+}
 // ------------------------------------------------------------------------------------------------
 AI_WONT_RETURN void ValidateDSProcess::ReportError(const char *msg, ...) {
     ai_assert(nullptr != msg);
@@ -92,6 +109,10 @@ void ValidateDSProcess::ReportWarning(const char *msg, ...) {
     ai_assert(iLen > 0);
 
     va_end(args);
+    if (gWarningSink) {
+        gWarningSink->emplace_back(szBuffer, iLen);
+        return;
+    }
     ASSIMP_LOG_WARN("Validation warning: ", std::string(szBuffer, iLen));
 }
 
@@ -147,7 +168,7 @@ inline void ValidateDSProcess::DoValidationEx(T **parray, unsigned int size,
         Validate(parray[i]);
 
         // check whether there are duplicate names
-        for (unsigned int a = i + 1; a < size; ++a) {
+        for (unsigned int a = i + 1; mLevel >= aiValidationLevel_FULL && a < size; ++a) {
             if (parray[i]->mName == parray[a]->mName) {
                 ReportError("aiScene::%s[%u] has the same name as "
                             "aiScene::%s[%u]",
@@ -164,7 +185,7 @@ inline void ValidateDSProcess::DoValidationWithNameCheck(T **array, unsigned int
     // validate all entries
     DoValidationEx(array, size, firstName, secondName);
 
-    for (unsigned int i = 0; i < size; ++i) {
+    for (unsigned int i = 0; mLevel >= aiValidationLevel_FULL && i < size; ++i) {
         int res = HasNameMatch(array[i]->mName, mScene->mRootNode);
         if (0 == res) {
             const std::string name = static_cast<char *>(array[i]->mName.data);
@@ -189,7 +210,7 @@ void ValidateDSProcess::Execute(aiScene *pScene) {
 
     // validate all meshes
     if (pScene->mNumMeshes) {
-        DoValidation(pScene->mMeshes, pScene->mNumMeshes, "mMeshes", "mNumMeshes");
+        ValidateMeshes();
     } else if (!(mScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE)) {
         ReportError("aiScene::mNumMeshes is 0. At least one mesh must be there");
     } else if (pScene->mMeshes) {
@@ -240,6 +261,42 @@ void ValidateDSProcess::Execute(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("ValidateDataStructureProcess end");
 }
 
+// ------------------------------------------------------------------------------------------------
+void ValidateDSProcess::ValidateMeshes() {
+    const unsigned int numMeshes = mScene->mNumMeshes;
+    if (!mScene->mMeshes) {
+        ReportError("aiScene::mMeshes is nullptr (aiScene::mNumMeshes is %i)", numMeshes);
+    }
+
+    // meshes are validated independently, their warnings and errors are
+    // held back and reported in order, so the result does not depend on
+    // the scheduling
+    std::vector<std::vector<std::string>> warnings(numMeshes);
+    std::vector<std::exception_ptr> errors(numMeshes);
+    ParallelFor(numMeshes, [&](size_t i) {
+        gWarningSink = &warnings[i];
+        try {
+            if (!mScene->mMeshes[i]) {
+                ReportError("aiScene::mMeshes[%i] is nullptr (aiScene::mNumMeshes is %i)",
+                        static_cast<unsigned int>(i), numMeshes);
+            }
+            Validate(mScene->mMeshes[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+        gWarningSink = nullptr;
+    });
+
+    for (unsigned int i = 0; i < numMeshes; ++i) {
+        for (const std::string &warning : warnings[i]) {
+            ASSIMP_LOG_WARN("Validation warning: ", warning);
+        }
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void ValidateDSProcess::Validate(const aiLight *pLight) {
     if (pLight->mType == aiLightSource_UNDEFINED)
@@ -279,6 +336,10 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
 
     Validate(&pMesh->mName);
 
+    // the layout of the faces is always checked, their indices only from BOUNDS on
+    const bool checkBounds = mLevel >= aiValidationLevel_BOUNDS;
+    const bool checkAll = mLevel >= aiValidationLevel_FULL;
+
     for (unsigned int i = 0; i < pMesh->mNumFaces; ++i) {
         aiFace &face = pMesh->mFaces[i];
 
@@ -319,6 +380,10 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
 
         if (!face.mIndices)
             ReportError("aiMesh::mFaces[%i].mIndices is nullptr", i);
+
+        if (face.mNumIndices > AI_MAX_FACE_INDICES) {
+            ReportError("Face %u has too many faces: %u, but the limit is %u", i, face.mNumIndices, AI_MAX_FACE_INDICES);
+        }
     }
 
     // positions must always be there ...
@@ -346,24 +411,24 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
     // now check whether the face indexing layout is correct:
     // unique vertices, pseudo-indexed.
     std::vector<bool> abRefList;
-    abRefList.resize(pMesh->mNumVertices, false);
-    for (unsigned int i = 0; i < pMesh->mNumFaces; ++i) {
+    if (checkAll) {
+        abRefList.resize(pMesh->mNumVertices, false);
+    }
+    for (unsigned int i = 0; checkBounds && i < pMesh->mNumFaces; ++i) {
         aiFace &face = pMesh->mFaces[i];
-        if (face.mNumIndices > AI_MAX_FACE_INDICES) {
-            ReportError("Face %u has too many faces: %u, but the limit is %u", i, face.mNumIndices, AI_MAX_FACE_INDICES);
-        }
-
         for (unsigned int a = 0; a < face.mNumIndices; ++a) {
             if (face.mIndices[a] >= pMesh->mNumVertices) {
                 ReportError("aiMesh::mFaces[%i]::mIndices[%i] is out of range", i, a);
             }
-            abRefList[face.mIndices[a]] = true;
+            if (checkAll) {
+                abRefList[face.mIndices[a]] = true;
+            }
         }
     }
 
     // check whether there are vertices that aren't referenced by a face
     bool b = false;
-    for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+    for (unsigned int i = 0; checkAll && i < pMesh->mNumVertices; ++i) {
         if (!abRefList[i]) b = true;
     }
     abRefList.clear();
@@ -371,6 +436,86 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
         ReportWarning("There are unreferenced vertices");
     }
 
+    // the contiguous index buffer must hold all faces back to back
+    if (pMesh->mIndices) {
+        unsigned int offset = 0;
+        for (unsigned int i = 0; i < pMesh->mNumFaces; ++i) {
+            const aiFace &face = pMesh->mFaces[i];
+            if (face.mIndices != pMesh->mIndices + offset) {
+                ReportError("aiMesh::mFaces[%i]::mIndices does not point into aiMesh::mIndices", i);
+            }
+            offset += face.mNumIndices;
+        }
+        if (offset != pMesh->mNumIndices) {
+            ReportError("aiMesh::mNumIndices is %u, but the faces have %u indices", pMesh->mNumIndices, offset);
+        }
+        if (pMesh->mIndices16 && checkAll) {
+            for (unsigned int i = 0; i < pMesh->mNumIndices; ++i) {
+                if (pMesh->mIndices16[i] != pMesh->mIndices[i]) {
+                    ReportError("aiMesh::mIndices16[%u] does not match aiMesh::mIndices", i);
+                }
+            }
+        }
+    } else if (pMesh->mIndices16 || pMesh->mNumIndices) {
+        ReportError("aiMesh::mIndices is nullptr (aiMesh::mNumIndices is %u)", pMesh->mNumIndices);
+    }
+
+    // the meshlets must cover all faces and stay within their tables
+    if (pMesh->mMeshletData) {
+        const aiMeshletData *data = pMesh->mMeshletData;
+        if (data->mNumMeshlets && (!data->mMeshlets || !data->mVertices || !data->mTriangles)) {
+            ReportError("aiMesh::mMeshletData has empty tables (aiMeshletData::mNumMeshlets is %u)", data->mNumMeshlets);
+        }
+        unsigned int numTriangles = 0;
+        for (unsigned int i = 0; checkBounds && i < data->mNumMeshlets; ++i) {
+            const aiMeshlet &meshlet = data->mMeshlets[i];
+            if (meshlet.mVertexOffset > data->mNumVertices || meshlet.mNumVertices > data->mNumVertices - meshlet.mVertexOffset) {
+                ReportError("aiMeshletData::mMeshlets[%u] exceeds aiMeshletData::mVertices", i);
+            }
+            if (meshlet.mTriangleOffset % 3 || meshlet.mTriangleOffset / 3 > data->mNumTriangles ||
+                    meshlet.mNumTriangles > data->mNumTriangles - meshlet.mTriangleOffset / 3) {
+                ReportError("aiMeshletData::mMeshlets[%u] exceeds aiMeshletData::mTriangles", i);
+            }
+            for (unsigned int a = 0; a < meshlet.mNumVertices; ++a) {
+                if (data->mVertices[meshlet.mVertexOffset + a] >= pMesh->mNumVertices) {
+                    ReportError("aiMeshletData::mMeshlets[%u] uses an invalid vertex", i);
+                }
+            }
+            for (unsigned int a = 0; a < meshlet.mNumTriangles * 3; ++a) {
+                if (data->mTriangles[meshlet.mTriangleOffset + a] >= meshlet.mNumVertices) {
+                    ReportError("aiMeshletData::mMeshlets[%u] has an invalid triangle index", i);
+                }
+            }
+            numTriangles += meshlet.mNumTriangles;
+        }
+        if (checkBounds && numTriangles != pMesh->mNumFaces) {
+            ReportError("The meshlets have %u triangles, but the mesh has %u faces", numTriangles, pMesh->mNumFaces);
+        }
+    }
+
+    // the quantized streams must match the full precision ones
+    if (pMesh->mQuantizedVertices) {
+        const aiQuantizedVertices *q = pMesh->mQuantizedVertices;
+        if (q->mNumVertices != pMesh->mNumVertices) {
+            ReportError("aiQuantizedVertices::mNumVertices is %u, but the mesh has %u vertices", q->mNumVertices, pMesh->mNumVertices);
+        }
+        if ((nullptr != q->mPositions) != pMesh->HasPositions() || (nullptr != q->mNormals) != pMesh->HasNormals() ||
+                (nullptr != q->mTangents) != pMesh->HasTangentsAndBitangents()) {
+            ReportError("The quantized vertex streams don't match the streams of the mesh");
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            if ((nullptr != q->mTextureCoords[i]) != pMesh->HasTextureCoords(i) ||
+                    (q->mTextureCoords[i] && q->mNumUVComponents[i] != pMesh->mNumUVComponents[i])) {
+                ReportError("The quantized texture coordinates %u don't match the mesh", i);
+            }
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            if ((nullptr != q->mColors[i]) != pMesh->HasVertexColors(i)) {
+                ReportError("The quantized vertex colors %u don't match the mesh", i);
+            }
+        }
+    }
+
     // vertex color channel 2 may not be set if channel 1 is zero ...
     {
         unsigned int i = 0;
@@ -392,7 +537,7 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
                     pMesh->mNumBones);
         }
         std::unique_ptr<float[]> afSum(nullptr);
-        if (pMesh->mNumVertices) {
+        if (pMesh->mNumVertices && checkAll) {
             afSum.reset(new float[pMesh->mNumVertices]);
             for (unsigned int i = 0; i < pMesh->mNumVertices; ++i)
                 afSum[i] = 0.0f;
@@ -401,17 +546,16 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
         // check whether there are duplicate bone names
         for (unsigned int i = 0; i < pMesh->mNumBones; ++i) {
             const aiBone *bone = pMesh->mBones[i];
-            if (bone->mNumWeights > AI_MAX_BONE_WEIGHTS) {
-                ReportError("Bone %u has too many weights: %u, but the limit is %u", i, bone->mNumWeights, AI_MAX_BONE_WEIGHTS);
-            }
-
-            if (!pMesh->mBones[i]) {
+            if (!bone) {
                 ReportError("aiMesh::mBones[%i] is nullptr (aiMesh::mNumBones is %i)",
                         i, pMesh->mNumBones);
             }
-            Validate(pMesh, pMesh->mBones[i], afSum.get());
+            if (bone->mNumWeights > AI_MAX_BONE_WEIGHTS) {
+                ReportError("Bone %u has too many weights: %u, but the limit is %u", i, bone->mNumWeights, AI_MAX_BONE_WEIGHTS);
+            }
+            Validate(pMesh, bone, afSum.get());
 
-            for (unsigned int a = i + 1; a < pMesh->mNumBones; ++a) {
+            for (unsigned int a = i + 1; checkAll && a < pMesh->mNumBones; ++a) {
                 if (pMesh->mBones[i]->mName == pMesh->mBones[a]->mName) {
                     const char *name = "unknown";
                     if (nullptr != pMesh->mBones[i]->mName.C_Str()) {
@@ -424,7 +568,7 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
             }
         }
         // check whether all bone weights for a vertex sum to 1.0 ...
-        for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        for (unsigned int i = 0; afSum && i < pMesh->mNumVertices; ++i) {
             if (afSum[i] && (afSum[i] <= 0.94 || afSum[i] >= 1.05)) {
                 ReportWarning("aiMesh::mVertices[%i]: bone weight sum != 1.0 (sum is %f)", i, afSum[i]);
             }
@@ -438,18 +582,21 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
 void ValidateDSProcess::Validate(const aiMesh *pMesh, const aiBone *pBone, float *afSum) {
     this->Validate(&pBone->mName);
 
-    if (!pBone->mNumWeights) {
+    // afSum is only given for full validation
+    if (!pBone->mNumWeights && afSum) {
         ReportWarning("aiBone::mNumWeights is zero");
     }
 
     // check whether all vertices affected by this bone are valid
-    for (unsigned int i = 0; i < pBone->mNumWeights; ++i) {
+    for (unsigned int i = 0; mLevel >= aiValidationLevel_BOUNDS && i < pBone->mNumWeights; ++i) {
         if (pBone->mWeights[i].mVertexId >= pMesh->mNumVertices) {
             ReportError("aiBone::mWeights[%i].mVertexId is out of range", i);
-        } else if (!pBone->mWeights[i].mWeight || pBone->mWeights[i].mWeight > 1.0f) {
+        } else if (afSum && (!pBone->mWeights[i].mWeight || pBone->mWeights[i].mWeight > 1.0f)) {
                 ReportWarning("aiBone::mWeights[%i].mWeight has an invalid value %i. Value must be greater than zero and less than 1.", i, pBone->mWeights[i].mWeight);
         }
-        afSum[pBone->mWeights[i].mVertexId] += pBone->mWeights[i].mWeight;
+        if (afSum) {
+            afSum[pBone->mWeights[i].mVertexId] += pBone->mWeights[i].mWeight;
+        }
     }
 }
 
@@ -591,6 +738,10 @@ void ValidateDSProcess::SearchForInvalidTextures(const aiMaterial *pMaterial,
 }
 // ------------------------------------------------------------------------------------------------
 void ValidateDSProcess::Validate(const aiMaterial *pMaterial) {
+    if (mLevel < aiValidationLevel_BOUNDS) {
+        return;
+    }
+
     // check whether there are material keys that are obviously not legal
     for (unsigned int i = 0; i < pMaterial->mNumProperties; ++i) {
         const aiMaterialProperty *prop = pMaterial->mProperties[i];
@@ -631,6 +782,9 @@ void ValidateDSProcess::Validate(const aiMaterial *pMaterial) {
         }
         // TODO: check whether there is a key with an unknown name ...
     }
+    if (mLevel < aiValidationLevel_FULL) {
+        return;
+    }
 
     // make some more specific tests
     ai_real fTemp;
@@ -729,7 +883,7 @@ void ValidateDSProcess::Validate(const aiAnimation *pAnimation,
                     pNodeAnim->mNumPositionKeys);
         }
         double dLast = -10e10;
-        for (unsigned int i = 0; i < pNodeAnim->mNumPositionKeys; ++i) {
+        for (unsigned int i = 0; mLevel >= aiValidationLevel_FULL && i < pNodeAnim->mNumPositionKeys; ++i) {
             // ScenePreprocessor will compute the duration if still the default value
             // (Aramis) Add small epsilon, comparison tended to fail if max_time == duration,
             //  seems to be due the compilers register usage/width.
@@ -757,7 +911,7 @@ void ValidateDSProcess::Validate(const aiAnimation *pAnimation,
                     pNodeAnim->mNumRotationKeys);
         }
         double dLast = -10e10;
-        for (unsigned int i = 0; i < pNodeAnim->mNumRotationKeys; ++i) {
+        for (unsigned int i = 0; mLevel >= aiValidationLevel_FULL && i < pNodeAnim->mNumRotationKeys; ++i) {
             if (pAnimation->mDuration > 0. && pNodeAnim->mRotationKeys[i].mTime > pAnimation->mDuration + 0.001) {
                 ReportError("aiNodeAnim::mRotationKeys[%i].mTime (%.5f) is larger "
                             "than aiAnimation::mDuration (which is %.5f)",
@@ -782,7 +936,7 @@ void ValidateDSProcess::Validate(const aiAnimation *pAnimation,
                     pNodeAnim->mNumScalingKeys);
         }
         double dLast = -10e10;
-        for (unsigned int i = 0; i < pNodeAnim->mNumScalingKeys; ++i) {
+        for (unsigned int i = 0; mLevel >= aiValidationLevel_FULL && i < pNodeAnim->mNumScalingKeys; ++i) {
             if (pAnimation->mDuration > 0. && pNodeAnim->mScalingKeys[i].mTime > pAnimation->mDuration + 0.001) {
                 ReportError("aiNodeAnim::mScalingKeys[%i].mTime (%.5f) is larger "
                             "than aiAnimation::mDuration (which is %.5f)",
@@ -823,7 +977,7 @@ void ValidateDSProcess::Validate(const aiAnimation *pAnimation,
                     pMeshMorphAnim->mNumKeys);
         }
         double dLast = -10e10;
-        for (unsigned int i = 0; i < pMeshMorphAnim->mNumKeys; ++i) {
+        for (unsigned int i = 0; mLevel >= aiValidationLevel_FULL && i < pMeshMorphAnim->mNumKeys; ++i) {
             // ScenePreprocessor will compute the duration if still the default value
             // (Aramis) Add small epsilon, comparison tended to fail if max_time == duration,
             //  seems to be due the compilers register usage/width.
@@ -865,12 +1019,17 @@ void ValidateDSProcess::Validate(const aiNode *pNode) {
                     nodeName, pNode->mNumMeshes);
         }
         std::vector<bool> abHadMesh;
-        abHadMesh.resize(mScene->mNumMeshes, false);
+        if (mLevel >= aiValidationLevel_FULL) {
+            abHadMesh.resize(mScene->mNumMeshes, false);
+        }
         for (unsigned int i = 0; i < pNode->mNumMeshes; ++i) {
             if (pNode->mMeshes[i] >= mScene->mNumMeshes) {
                 ReportError("aiNode::mMeshes[%i] is out of range for node %s (maximum is %i)",
                         pNode->mMeshes[i], nodeName, mScene->mNumMeshes - 1);
             }
+            if (abHadMesh.empty()) {
+                continue;
+            }
             if (abHadMesh[pNode->mMeshes[i]]) {
                 ReportError("aiNode::mMeshes[%i] is already referenced by this node %s (value: %i)",
                         i, nodeName, pNode->mMeshes[i]);
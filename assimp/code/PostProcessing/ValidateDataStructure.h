@@ -68,7 +68,7 @@ namespace Assimp {
 /** Validates the whole ASSIMP scene data structure for correctness.
  *  ImportErrorException is thrown of the scene is corrupt.*/
 // --------------------------------------------------------------------------------------
-class ValidateDSProcess : public BaseProcess {
+class ASSIMP_API ValidateDSProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -78,6 +78,9 @@ public:
     // -------------------------------------------------------------------
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    void SetupProperties(const Importer* pImp) override;
+
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
 
@@ -96,6 +99,11 @@ protected:
     void ReportWarning(const char* msg,...);
 
 
+    // -------------------------------------------------------------------
+    /** Validates all meshes of the scene concurrently. Warnings and the
+     *  first error are reported in mesh order, as a serial run would. */
+    void ValidateMeshes();
+
     // -------------------------------------------------------------------
     /** Validates a mesh
      * @param pMesh Input mesh*/
@@ -184,6 +192,7 @@ private:
         const char* firstName, const char* secondName);
 
     aiScene* mScene;
+    unsigned int mLevel;
 };
 
 
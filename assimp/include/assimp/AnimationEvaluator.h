@@ -0,0 +1,179 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file AnimationEvaluator.h
+ *  Declares AnimationEvaluator, a helper to sample an animation into the
+ *  local and global transformations of all nodes of a scene.
+ */
+
+#pragma once
+#ifndef AI_ANIMATIONEVALUATOR_H_INC
+#define AI_ANIMATIONEVALUATOR_H_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/matrix4x4.h>
+#include <assimp/quaternion.h>
+#include <assimp/vector3.h>
+
+#include <climits>
+#include <vector>
+
+struct aiAnimation;
+struct aiNode;
+struct aiScene;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * Samples an animation of a scene at a given time.
+ *
+ * The node hierarchy is flattened once on construction, parents always come
+ * before their children, so the global transformations are computed in a
+ * single pass. Evaluate() fills a local and a global transformation per
+ * node; nodes without an animation channel keep their aiNode::mTransformation.
+ *
+ * Each channel remembers the key it used last. For monotonic playback the
+ * keys are found with a few forward steps, jumps fall back to a binary
+ * search. Positions and scalings are interpolated linearly and rotations
+ * spherically, keys with aiAnimInterpolation_Step hold their value. Before
+ * the first and after the last key the nearest key value is used.
+ *
+ * The evaluator references the scene, which must outlive it. Evaluators of
+ * the same scene are independent of each other, so many characters can be
+ * evaluated concurrently.
+ */
+class ASSIMP_API AnimationEvaluator {
+public:
+    /// Index returned for nodes that don't exist.
+    static const unsigned int NoNode = UINT_MAX;
+
+    // -------------------------------------------------------------------
+    /** Builds the node table of the scene and binds an animation.
+     * @param pScene The scene, must have a root node.
+     * @param pAnimation The animation to sample, one of the animations of
+     *   the scene. nullptr evaluates the bind pose.
+     */
+    AnimationEvaluator(const aiScene *pScene, const aiAnimation *pAnimation);
+
+    // -------------------------------------------------------------------
+    /** Binds another animation of the same scene and resets the key cache.
+     * @param pAnimation The animation to sample, may be nullptr.
+     */
+    void SetAnimation(const aiAnimation *pAnimation);
+
+    // -------------------------------------------------------------------
+    /** Samples the animation.
+     * @param pTime The time in seconds. Times beyond the duration of the
+     *   animation wrap around, so it may grow without limits.
+     */
+    void Evaluate(double pTime);
+
+    // -------------------------------------------------------------------
+    /** Samples the animation at a time given in ticks, without wrapping.
+     * @param pTicks The time in the time unit of the animation keys.
+     */
+    void EvaluateTicks(double pTicks);
+
+    // -------------------------------------------------------------------
+    /// Returns the number of nodes in the node table.
+    unsigned int GetNumNodes() const {
+        return static_cast<unsigned int>(mNodes.size());
+    }
+
+    // -------------------------------------------------------------------
+    /// Returns the node at the given index of the node table.
+    const aiNode *GetNode(unsigned int index) const {
+        return mNodes[index];
+    }
+
+    // -------------------------------------------------------------------
+    /// Returns the index of the parent of a node, NoNode for the root.
+    unsigned int GetParent(unsigned int index) const {
+        return mParents[index];
+    }
+
+    // -------------------------------------------------------------------
+    /** Looks up a node by name.
+     * @return The index of the first node with that name, NoNode if
+     *   there is none.
+     */
+    unsigned int FindNode(const char *name) const;
+
+    // -------------------------------------------------------------------
+    /// Returns the transformations of all nodes relative to their parents.
+    const aiMatrix4x4 *GetLocalTransforms() const {
+        return mLocal.data();
+    }
+
+    // -------------------------------------------------------------------
+    /// Returns the transformations of all nodes relative to the root.
+    const aiMatrix4x4 *GetGlobalTransforms() const {
+        return mGlobal.data();
+    }
+
+private:
+    /** The channel bound to a node, the keys it used last and the
+     *  default transformation of the node for missing tracks. */
+    struct Channel {
+        unsigned int mNode;
+        unsigned int mPositionKey;
+        unsigned int mRotationKey;
+        unsigned int mScalingKey;
+        aiVector3D mPosition;
+        aiQuaternion mRotation;
+        aiVector3D mScaling;
+    };
+
+    const aiAnimation *mAnimation;
+    std::vector<const aiNode *> mNodes;
+    std::vector<unsigned int> mParents;
+    std::vector<Channel> mChannels;
+    std::vector<aiMatrix4x4> mLocal;
+    std::vector<aiMatrix4x4> mGlobal;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_ANIMATIONEVALUATOR_H_INC
@@ -0,0 +1,301 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file AssbinMappedView.h
+ *  @brief Read-only, zero-copy access to memory-mappable assbin files.
+ *
+ *  Mappable assbin files (see #AI_CONFIG_EXPORT_ASSBIN_MAPPABLE) store all
+ *  mesh arrays contiguously, 64-byte aligned and in little-endian byte order,
+ *  and list them in a table of fixed-size records. Once the file is in memory
+ *  (i.e. mapped by the application), AssbinMappedView hands out pointers
+ *  straight into it, without copying or converting anything.
+ */
+#pragma once
+#ifndef AI_ASSBINMAPPEDVIEW_H_INC
+#define AI_ASSBINMAPPEDVIEW_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/ai_assert.h>
+#include <assimp/mesh.h>
+#include <assimp/types.h>
+
+#include <stdint.h>
+#include <string.h>
+
+namespace Assimp {
+
+/// Major version in the assbin header of mappable files
+#define AI_ASSBIN_MAPPED_VERSION_MAJOR 2
+
+/// Identifies the table header following the regular 512 byte assbin header
+#define AI_ASSBIN_MAPPED_MAGIC 0x32564241u // 'ABV2'
+
+/// Alignment of all arrays and tables in a mappable file
+#define AI_ASSBIN_MAPPED_ALIGNMENT 64
+
+/// Offset of the table header in a mappable file
+#define AI_ASSBIN_MAPPED_TABLE_OFFSET 512
+
+// ----------------------------------------------------------------------------------
+/** Table header of a mappable assbin file. All offsets are relative to the
+ *  start of the file, 0 means 'not present'. */
+struct AssbinMappedHeader {
+    uint32_t mMagic;          ///< AI_ASSBIN_MAPPED_MAGIC
+    uint32_t mRealSize;       ///< sizeof(ai_real) of the writer
+    uint32_t mNumMeshes;      ///< Number of records in the mesh table
+    uint32_t mReserved;
+    uint64_t mMeshTable;      ///< Offset of the AssbinMappedMesh records
+    uint64_t mSceneChunk;     ///< Offset of the regular ASSBIN_CHUNK_AISCENE chunk, without meshes
+    uint64_t mSceneChunkSize; ///< Size of the scene chunk, in bytes
+    uint64_t mFileSize;       ///< Total size of the file, in bytes
+    uint8_t mPadding[16];
+};
+
+// ----------------------------------------------------------------------------------
+/** Describes one mesh of a mappable assbin file. Vertex arrays use the layout
+ *  of the aiMesh members, faces are stored as one index buffer plus
+ *  mNumFaces + 1 offsets into it. */
+struct AssbinMappedMesh {
+    uint32_t mPrimitiveTypes;
+    uint32_t mNumVertices;
+    uint32_t mNumFaces;
+    uint32_t mNumIndices;
+    uint32_t mNumBones;
+    uint32_t mMaterialIndex;
+    uint32_t mNameLength;
+    uint32_t mReserved;
+    uint32_t mNumUVComponents[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+    uint64_t mName;           ///< char[mNameLength], not terminated
+    uint64_t mVertices;       ///< aiVector3D[mNumVertices]
+    uint64_t mNormals;        ///< aiVector3D[mNumVertices]
+    uint64_t mTangents;       ///< aiVector3D[mNumVertices]
+    uint64_t mBitangents;     ///< aiVector3D[mNumVertices]
+    uint64_t mColors[AI_MAX_NUMBER_OF_COLOR_SETS];           ///< aiColor4D[mNumVertices]
+    uint64_t mTextureCoords[AI_MAX_NUMBER_OF_TEXTURECOORDS]; ///< aiVector3D[mNumVertices]
+    uint64_t mFaceOffsets;    ///< uint32_t[mNumFaces + 1]
+    uint64_t mIndices;        ///< uint32_t[mNumIndices]
+    uint64_t mBones;          ///< AssbinMappedBone[mNumBones]
+};
+
+// ----------------------------------------------------------------------------------
+/** Describes one bone of a mesh in a mappable assbin file. */
+struct AssbinMappedBone {
+    ai_real mOffsetMatrix[16]; ///< Row-major, like aiMatrix4x4
+    uint32_t mNumWeights;
+    uint32_t mNameLength;
+    uint64_t mName;            ///< char[mNameLength], not terminated
+    uint64_t mWeights;         ///< aiVertexWeight[mNumWeights]
+};
+
+static_assert(sizeof(AssbinMappedHeader) == 64, "AssbinMappedHeader must be 64 bytes");
+static_assert(sizeof(AssbinMappedMesh) % 8 == 0, "AssbinMappedMesh must not need padding");
+static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D must be tightly packed");
+static_assert(sizeof(aiColor4D) == 4 * sizeof(ai_real), "aiColor4D must be tightly packed");
+
+// ----------------------------------------------------------------------------------
+/** Read-only view on a mappable assbin file in memory.
+ *
+ *  Open() validates the header and checks that all tables and arrays lie
+ *  within the buffer. The index values themselves are not checked, so only
+ *  open files that were written by a trusted source or validate them first.
+ *  The buffer must outlive the view and should be aligned to
+ *  #AI_ASSBIN_MAPPED_ALIGNMENT bytes, which every memory mapping is. Buffers
+ *  that are not even 8-byte aligned are rejected.
+ */
+class AssbinMappedView {
+public:
+    AssbinMappedView() = default;
+
+    // ------------------------------------------------------------------
+    /** Attach the view to a file in memory.
+     *  @return false if the buffer does not hold a valid mappable assbin
+     *    file written with the same ai_real precision. */
+    bool Open(const void *data, size_t size) {
+        mData = nullptr;
+        mSize = 0;
+        mHeader = nullptr;
+        mMeshes = nullptr;
+
+        // all records hold 64 bit offsets, so the buffer needs at least their alignment
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        if (nullptr == bytes || reinterpret_cast<uintptr_t>(bytes) % alignof(AssbinMappedMesh) != 0 ||
+                size < AI_ASSBIN_MAPPED_TABLE_OFFSET + sizeof(AssbinMappedHeader)) {
+            return false;
+        }
+        if (::memcmp(bytes, "ASSIMP.binary-dump.", 19) != 0) {
+            return false;
+        }
+
+        uint32_t versionMajor;
+        uint16_t compressed;
+        ::memcpy(&versionMajor, bytes + 44, sizeof(versionMajor));
+        ::memcpy(&compressed, bytes + 62, sizeof(compressed));
+        if (versionMajor != AI_ASSBIN_MAPPED_VERSION_MAJOR || compressed != 0) {
+            return false;
+        }
+
+        const AssbinMappedHeader *header = reinterpret_cast<const AssbinMappedHeader *>(bytes + AI_ASSBIN_MAPPED_TABLE_OFFSET);
+        if (header->mMagic != AI_ASSBIN_MAPPED_MAGIC || header->mRealSize != sizeof(ai_real) || header->mFileSize > size) {
+            return false;
+        }
+
+        mData = bytes;
+        mSize = static_cast<size_t>(header->mFileSize);
+        if (!IsValidArray(header->mMeshTable, header->mNumMeshes, sizeof(AssbinMappedMesh)) ||
+                !IsValidRange(header->mSceneChunk, header->mSceneChunkSize, 1)) {
+            mData = nullptr;
+            mSize = 0;
+            return false;
+        }
+
+        mHeader = header;
+        mMeshes = reinterpret_cast<const AssbinMappedMesh *>(bytes + header->mMeshTable);
+        for (uint32_t i = 0; i < header->mNumMeshes; ++i) {
+            if (!IsValidMesh(mMeshes[i])) {
+                mData = nullptr;
+                mSize = 0;
+                mHeader = nullptr;
+                mMeshes = nullptr;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns whether Open() succeeded. */
+    bool IsOpen() const {
+        return nullptr != mHeader;
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns the number of meshes in the file. */
+    unsigned int GetNumMeshes() const {
+        return mHeader ? mHeader->mNumMeshes : 0;
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns the record of a mesh, the index must be < GetNumMeshes(). */
+    const AssbinMappedMesh &GetMesh(unsigned int index) const {
+        ai_assert(index < GetNumMeshes());
+        return mMeshes[index];
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns the bone records of a mesh. */
+    const AssbinMappedBone *GetBones(const AssbinMappedMesh &mesh) const {
+        return GetArray<AssbinMappedBone>(mesh.mBones);
+    }
+
+    // ------------------------------------------------------------------
+    /** Resolves an offset of a record into a pointer into the file,
+     *  nullptr for absent arrays. */
+    template <typename T>
+    const T *GetArray(uint64_t offset) const {
+        return offset ? reinterpret_cast<const T *>(mData + offset) : nullptr;
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns the scene chunk with everything but the meshes. */
+    const uint8_t *GetSceneChunk() const {
+        return mHeader ? mData + mHeader->mSceneChunk : nullptr;
+    }
+
+    // ------------------------------------------------------------------
+    /** Returns the size of the scene chunk, in bytes. */
+    size_t GetSceneChunkSize() const {
+        return mHeader ? static_cast<size_t>(mHeader->mSceneChunkSize) : 0;
+    }
+
+private:
+    bool IsValidRange(uint64_t offset, uint64_t count, uint64_t elementSize) const {
+        if (0 == offset) {
+            return true;
+        }
+        return offset <= mSize && count <= (mSize - offset) / elementSize;
+    }
+
+    bool IsValidArray(uint64_t offset, uint64_t count, uint64_t elementSize) const {
+        return IsValidRange(offset, count, elementSize) && offset % AI_ASSBIN_MAPPED_ALIGNMENT == 0;
+    }
+
+    bool IsValidMesh(const AssbinMappedMesh &mesh) const {
+        const uint32_t numVertices = mesh.mNumVertices;
+        bool valid = IsValidRange(mesh.mName, mesh.mNameLength, 1) &&
+                     IsValidArray(mesh.mVertices, numVertices, sizeof(aiVector3D)) &&
+                     IsValidArray(mesh.mNormals, numVertices, sizeof(aiVector3D)) &&
+                     IsValidArray(mesh.mTangents, numVertices, sizeof(aiVector3D)) &&
+                     IsValidArray(mesh.mBitangents, numVertices, sizeof(aiVector3D)) &&
+                     IsValidArray(mesh.mFaceOffsets, uint64_t(mesh.mNumFaces) + 1, sizeof(uint32_t)) &&
+                     IsValidArray(mesh.mIndices, mesh.mNumIndices, sizeof(uint32_t)) &&
+                     IsValidArray(mesh.mBones, mesh.mNumBones, sizeof(AssbinMappedBone));
+        for (unsigned int i = 0; valid && i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            valid = IsValidArray(mesh.mColors[i], numVertices, sizeof(aiColor4D));
+        }
+        for (unsigned int i = 0; valid && i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            valid = IsValidArray(mesh.mTextureCoords[i], numVertices, sizeof(aiVector3D));
+        }
+        if (!valid || (mesh.mNumFaces && (0 == mesh.mFaceOffsets || 0 == mesh.mIndices)) || (mesh.mNumBones && 0 == mesh.mBones)) {
+            return false;
+        }
+
+        const AssbinMappedBone *bones = GetBones(mesh);
+        for (uint32_t i = 0; i < mesh.mNumBones; ++i) {
+            if (!IsValidRange(bones[i].mName, bones[i].mNameLength, 1) ||
+                    !IsValidArray(bones[i].mWeights, bones[i].mNumWeights, sizeof(aiVertexWeight))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const uint8_t *mData = nullptr;
+    size_t mSize = 0;
+    const AssbinMappedHeader *mHeader = nullptr;
+    const AssbinMappedMesh *mMeshes = nullptr;
+};
+
+} // namespace Assimp
+
+#endif // AI_ASSBINMAPPEDVIEW_H_INC
@@ -69,6 +69,8 @@ class IOSystem;
 class BaseProcess;
 class SharedPostProcessInfo;
 class IOStream;
+class CancelToken;
+class MeshStreamer;
 
 // utility to do char4 to uint32 in a portable manner
 #define AI_MAKE_MAGIC(string) ((uint32_t)((string[0] << 24) + \
@@ -298,6 +300,15 @@ public: // static utilities
     static std::string GetExtension(
             const std::string &pFile);
 
+    // -------------------------------------------------------------------
+    /** @brief Remove a version hash from a file name, as found for
+     *    example in gcs uris (e.g. `gs://bucket/model.glb#1234`).
+     *  @param pFile Input file
+     *  @return The file name without the hash
+     */
+    static std::string StripVersionHash(
+            const std::string &pFile);
+
     // -------------------------------------------------------------------
     /** @brief Check whether a file starts with one or more magic tokens
      *  @param pFile Input file
@@ -394,6 +405,30 @@ public: // static utilities
         }
     }
 
+    // -------------------------------------------------------------------
+    /** Throws a DeadlyImportError if the import was cancelled or ran out
+     *  of time, see Importer::Cancel(). Importers call this at bounded
+     *  intervals inside long loops. Does nothing outside of ReadFile().
+     */
+    void CheckCancel() const;
+
+    // -------------------------------------------------------------------
+    /** Same as CheckCancel(), but only checks every few thousand values
+     *  of a running counter, for loops with cheap iterations.
+     *  @param counter The loop counter
+     */
+    void CheckCancel(size_t counter) const;
+
+    // -------------------------------------------------------------------
+    /** Hands out a finished mesh while the import is still running, see
+     *  #AI_CONFIG_IMPORT_MESH_STREAMING. The importer must not change the
+     *  mesh afterwards. Meshes not passed here are handed out once the
+     *  importer returns. Does nothing if meshes aren't streamed.
+     *  @param mesh The finished mesh
+     *  @param meshIndex Index of the mesh in the final aiScene::mMeshes
+     */
+    void MeshFinished(aiMesh *mesh, unsigned int meshIndex);
+
 private:
     /* Pushes state into importer for the importer scale */
     void UpdateImporterScale(Importer *pImp);
@@ -405,6 +440,11 @@ protected:
     std::exception_ptr m_Exception;
     /// Currently set progress handler.
     ProgressHandler *m_progress;
+    /// Cancellation state of the running import, for parsers which
+    /// want to check it themselves. nullptr outside of ReadFile().
+    const CancelToken *m_cancel = nullptr;
+    /// Receives finished meshes, nullptr if meshes aren't streamed.
+    MeshStreamer *m_meshStreamer = nullptr;
 };
 
 } // end of namespace Assimp
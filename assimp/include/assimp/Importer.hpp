@@ -469,6 +469,12 @@ public:
      *  This is strictly equivalent to calling #ReadFile() with the same
      *  flags. However, you can use this separate function to inspect
      *  the imported scene first to fine-tune your post-processing setup.
+     *
+     *  Some steps have no #aiPostProcessSteps flag, they are enabled by a
+     *  property instead and run after all flag-driven steps, in this order:
+     *  #AI_CONFIG_PP_LOD_LEVELS, #AI_CONFIG_PP_ML_ENABLE,
+     *  #AI_CONFIG_PP_QV_ENABLE, #AI_CONFIG_PP_RK_ENABLE and
+     *  #AI_CONFIG_PP_PI_ENABLE.
      *  @param pFlags Provide a bitwise combination of the
      *   #aiPostProcessSteps flags.
      *  @return A pointer to the post-processed data. This is still the
@@ -550,6 +556,16 @@ public:
      *   It will work as well for static linkage with Assimp.*/
     aiScene *GetOrphanedScene();
 
+    // -------------------------------------------------------------------
+    /** Aborts the import which is currently running.
+     *
+     * This is the only method which may be called from another thread
+     * while ReadFile() or ApplyPostProcessing() runs. The running call
+     * stops shortly afterwards, frees all data it built so far and
+     * returns nullptr. Calls made later are not affected.
+     * @see AI_CONFIG_IMPORT_TIME_LIMIT */
+    void Cancel();
+
     // -------------------------------------------------------------------
     /** Returns whether a given file extension is supported by ASSIMP.
      *
@@ -0,0 +1,167 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MeshDeformer.h
+ *  Declares MeshDeformer, a helper to pose skinned and morphed meshes on
+ *  the cpu.
+ */
+
+#pragma once
+#ifndef AI_MESHDEFORMER_H_INC
+#define AI_MESHDEFORMER_H_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/matrix4x4.h>
+#include <assimp/vector3.h>
+
+#include <vector>
+
+struct aiMesh;
+
+namespace Assimp {
+
+class AnimationEvaluator;
+
+// ---------------------------------------------------------------------------
+/**
+ * Computes the posed vertices of a mesh from its bones and morph targets.
+ *
+ * On construction the bone weights of the mesh are converted into a fixed
+ * number of influences per vertex, the strongest ones, renormalized to a
+ * sum of one. Vertices without weights stay in place. Deform() first blends
+ * the morph targets, base + sum(weight * (target - base)), and then skins
+ * the result with linear blending or dual quaternions. The vertices are
+ * processed in parallel ranges.
+ *
+ * The deformer references the mesh, which must outlive it. Apart from
+ * BindNodes() all methods are const, so one deformer may pose a mesh for
+ * several characters at once.
+ */
+class ASSIMP_API MeshDeformer {
+public:
+    /// The skinning algorithms.
+    enum Method {
+        /// Blends the bone matrices linearly, cheap but thins out joints
+        /// which twist.
+        LinearBlend,
+        /// Blends the rigid part of the bone transformations as dual
+        /// quaternions, which keeps the volume. Scaling of the bones is
+        /// ignored.
+        DualQuaternion
+    };
+
+    // -------------------------------------------------------------------
+    /** Converts the bone weights of a mesh.
+     * @param pMesh The mesh.
+     * @param maxInfluences The number of bones per vertex, at least 1.
+     *   Weaker influences are dropped.
+     */
+    explicit MeshDeformer(const aiMesh *pMesh, unsigned int maxInfluences = 4);
+
+    // -------------------------------------------------------------------
+    /// Returns the number of influences stored per vertex.
+    unsigned int GetNumInfluences() const {
+        return mNumInfluences;
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the bone indices of the influences, GetNumInfluences()
+     *  per vertex. Unused slots have bone 0 and weight 0. */
+    const unsigned int *GetBoneIndices() const {
+        return mBoneIndices.data();
+    }
+
+    // -------------------------------------------------------------------
+    /// Returns the weights of the influences, see GetBoneIndices().
+    const float *GetBoneWeights() const {
+        return mBoneWeights.data();
+    }
+
+    // -------------------------------------------------------------------
+    /** Looks up the nodes of the bones once, so ComputeBoneMatrices()
+     *  doesn't have to search them by name on every call.
+     * @param evaluator An evaluator of the scene of the mesh. The binding
+     *   holds for all evaluators of that scene.
+     */
+    void BindNodes(const AnimationEvaluator &evaluator);
+
+    // -------------------------------------------------------------------
+    /** Computes the skinning matrices of the bones from an evaluated pose,
+     *  inverse(global(meshNode)) * global(bone node) * offset.
+     * @param evaluator The evaluated animation of the scene of the mesh.
+     * @param meshNode The index of the node referencing the mesh in the
+     *   evaluator. AnimationEvaluator::NoNode for the root space.
+     * @param out Receives aiMesh::mNumBones matrices. Bones without a
+     *   node of their name get the identity.
+     *
+     * Without BindNodes() the nodes of the bones are looked up on every
+     * call.
+     */
+    void ComputeBoneMatrices(const AnimationEvaluator &evaluator, unsigned int meshNode, aiMatrix4x4 *out) const;
+
+    // -------------------------------------------------------------------
+    /** Poses the mesh.
+     * @param boneMatrices aiMesh::mNumBones skinning matrices, nullptr to
+     *   apply the morph targets only.
+     * @param morphWeights aiMesh::mNumAnimMeshes weights, nullptr to use
+     *   aiAnimMesh::mWeight.
+     * @param method The skinning algorithm.
+     * @param outPositions Receives aiMesh::mNumVertices positions.
+     * @param outNormals Receives aiMesh::mNumVertices normalized normals,
+     *   may be nullptr. Ignored if the mesh has no normals.
+     */
+    void Deform(const aiMatrix4x4 *boneMatrices, const float *morphWeights, Method method,
+            aiVector3D *outPositions, aiVector3D *outNormals) const;
+
+private:
+    const aiMesh *mMesh;
+    unsigned int mNumInfluences;
+    std::vector<unsigned int> mBoneIndices;
+    std::vector<float> mBoneWeights;
+    std::vector<unsigned int> mBoneNodes;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_MESHDEFORMER_H_INC
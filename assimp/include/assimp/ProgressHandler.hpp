@@ -52,6 +52,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+struct aiMesh;
+
 namespace Assimp {
 
 // ------------------------------------------------------------------------------------
@@ -136,6 +138,22 @@ public:
         float f = numberOfSteps ? currentStep / (float)numberOfSteps : 1.0f;
         Update(f * 0.5f);
     }
+
+    // -------------------------------------------------------------------
+    /** @brief Callback for finished meshes, see #AI_CONFIG_IMPORT_MESH_STREAMING.
+     *
+     *  Called once for each mesh as soon as it went through all
+     *  post-processing steps, which may be well before
+     *  #Importer::ReadFile() returns. The mesh is owned by the scene
+     *  that is being built, so copy out what you need. Its material
+     *  index refers to the materials of the final scene.
+     *  @param meshIndex Index of the mesh in aiScene::mMeshes
+     *  @param mesh The finished mesh
+     *   */
+    virtual void MeshReady(unsigned int meshIndex, const aiMesh *mesh) {
+        (void)meshIndex;
+        (void)mesh;
+    }
 }; // !class ProgressHandler
 
 // ------------------------------------------------------------------------------------
@@ -57,7 +57,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp {
 
-class ZipArchiveIOSystem : public IOSystem {
+class ASSIMP_API ZipArchiveIOSystem : public IOSystem {
 public:
     //! Open a Zip using the proffered IOSystem
     ZipArchiveIOSystem(IOSystem* pIOHandler, const char *pFilename, const char* pMode = "r");
@@ -80,6 +80,11 @@ public:
     //! Intended for use within Assimp library boundaries
     void getFileListExtension(std::vector<std::string>& rFileList, const std::string& extension) const;
 
+    //! Inflate the given files concurrently and keep them until they are opened.
+    //! The first Open() of a prefetched file takes over its data without a copy.
+    //! Intended for use within Assimp library boundaries
+    void prefetchFiles(const std::vector<std::string>& rFileList);
+
     static bool isZipArchive(IOSystem* pIOHandler, const char *pFilename);
     static bool isZipArchive(IOSystem* pIOHandler, const std::string& rFilename);
 
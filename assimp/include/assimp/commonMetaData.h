@@ -66,4 +66,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /// Not all formats add this metadata.
 #define AI_METADATA_SOURCE_COPYRIGHT "SourceAsset_Copyright"
 
+/// Node metadata linking a mesh of the node to one of its levels of detail, see #AI_CONFIG_PP_LOD_LEVELS.
+/// The key is the prefix followed by the level and the index of the source mesh, e.g. "LOD2_5" for
+/// the second level of aiScene::mMeshes[5]. The uint32 value is the index of the LOD mesh in aiScene::mMeshes.
+#define AI_METADATA_LOD_PREFIX "LOD"
+
 #endif
@@ -88,6 +88,41 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_CONFIG_IMPORT_NO_SKELETON_MESHES \
     "IMPORT_NO_SKELETON_MESHES"
 
+// ---------------------------------------------------------------------------
+/** @brief Global setting to limit the time spent in a single import
+ *
+ * If non-zero, Importer::ReadFile() gives up once the given number of
+ * milliseconds has passed, the limit covers loading and post-processing.
+ * Importers and post-processing steps check it at bounded intervals, so
+ * the import ends shortly after the limit with a nullptr scene and the
+ * error string "Import cancelled". A standalone call to
+ * Importer::ApplyPostProcessing() gets the same limit of its own.
+ * See Importer::Cancel() to abort an import from another thread.
+ * Property data type: integer. Default value: 0 (no limit)
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_TIME_LIMIT \
+    "IMPORT_TIME_LIMIT"
+
+// ---------------------------------------------------------------------------
+/** @brief Global setting to hand out meshes while the import is running
+ *
+ * If enabled, ProgressHandler::MeshReady() is called for each mesh as soon
+ * as it is final. Meshes of importers that support it are post-processed
+ * one by one while the rest of the file is still being converted, so an
+ * application can start uploading them early. Streaming needs all requested
+ * post-processing steps to be mesh-local (e.g. triangulation, normals,
+ * tangents, joining vertices) and can't be combined with
+ * #aiProcess_ValidateDataStructure or with the steps enabled by
+ * #AI_CONFIG_PP_LOD_LEVELS, #AI_CONFIG_PP_ML_ENABLE, #AI_CONFIG_PP_QV_ENABLE,
+ * #AI_CONFIG_PP_RK_ENABLE and #AI_CONFIG_PP_PI_ENABLE; otherwise the
+ * callbacks are made once the import has finished.
+ * Property data type: bool. Default value: false
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_MESH_STREAMING \
+    "IMPORT_MESH_STREAMING"
+
 // ###########################################################################
 // POST PROCESSING SETTINGS
 // Various stuff to fine-tune the behavior of a specific post processing step.
@@ -371,6 +406,243 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #define AI_CONFIG_PP_ICL_PTCACHE_SIZE   "PP_ICL_PTCACHE_SIZE"
 
+// ImproveCacheLocality orders the faces with the Tipsify algorithm
+#define AI_ICL_ALGORITHM_TIPSIFY 0
+
+// ImproveCacheLocality orders the faces with Tom Forsyth's linear-speed algorithm
+#define AI_ICL_ALGORITHM_FORSYTH 1
+
+// ---------------------------------------------------------------------------
+/** @brief Selects the face ordering algorithm of the
+ *    #aiProcess_ImproveCacheLocality step.
+ *
+ * #AI_ICL_ALGORITHM_TIPSIFY is fast and the default.
+ * #AI_ICL_ALGORITHM_FORSYTH usually reaches a slightly lower ACMR at a
+ * somewhat higher cost.
+ * Property type: integer (one of the AI_ICL_ALGORITHM_XXX values).
+ */
+#define AI_CONFIG_PP_ICL_ALGORITHM   "PP_ICL_ALGORITHM"
+
+// ---------------------------------------------------------------------------
+/** @brief Enables overdraw reduction in the #aiProcess_ImproveCacheLocality
+ *    step.
+ *
+ * After the cache optimization the faces are cut into clusters which are
+ * reordered so that outward facing clusters are drawn first. The value is the
+ * factor by which the ACMR of a cluster may exceed the ACMR of the cache
+ * optimized order, e.g. 1.05. Values <= 0 disable the reordering.
+ * @note The default value is 0.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD   "PP_ICL_OVERDRAW_THRESHOLD"
+
+// ---------------------------------------------------------------------------
+/** @brief Enables vertex fetch optimization in the
+ *    #aiProcess_ImproveCacheLocality step.
+ *
+ * If enabled, the vertices of each mesh are physically reordered in the order
+ * of their first use by the faces, unused vertices move to the end. Bone
+ * weights and animation meshes are remapped accordingly.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_ICL_REORDER_VERTICES   "PP_ICL_REORDER_VERTICES"
+
+// ---------------------------------------------------------------------------
+/** @brief Number of simplified levels of detail to generate for each mesh.
+ *
+ * Steps without an aiProcess flag are enabled by their property and run
+ * after all flag-driven steps, see Importer::ApplyPostProcessing().
+ *
+ * Values > 0 enable the step. Each triangle mesh is simplified by quadric
+ * error edge collapses, level n aims for #AI_CONFIG_PP_LOD_RATIO to the
+ * power of n of the original face count.
+ * Mesh borders and seams between different normals, texture coordinates or
+ * colors stay in place. The generated meshes are appended to
+ * aiScene::mMeshes, but aren't referenced by any node. Instead, every node
+ * using a simplified mesh gets a metadata entry for each level, see
+ * #AI_METADATA_LOD_PREFIX. The chain of a mesh ends early once no further
+ * face can be removed, so it may have less levels than requested.
+ * Meshes with other primitives than triangles are skipped, so this is
+ * usually combined with #aiProcess_Triangulate and #aiProcess_SortByPType.
+ * @note The default value is 0.
+ * Property type: integer.
+ */
+#define AI_CONFIG_PP_LOD_LEVELS   "PP_LOD_LEVELS"
+
+// ---------------------------------------------------------------------------
+/** @brief Face count of each level of detail relative to the one before.
+ *
+ * Only has an effect if #AI_CONFIG_PP_LOD_LEVELS is set. The value must be
+ * in (0, 1), the default generates levels with 50%, 25%, 12.5%, ... of the
+ * original faces.
+ * @note The default value is 0.5.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_LOD_RATIO   "PP_LOD_RATIO"
+
+// ---------------------------------------------------------------------------
+/** @brief Split all triangle meshes into meshlets.
+ *
+ * Each triangle mesh gets an aiMesh::mMeshletData table of small clusters
+ * of adjacent triangles with bounding spheres and normal cones for
+ * culling, as used by mesh shaders.
+ * Meshes with other primitives than triangles are skipped. For best
+ * results, combine it with #aiProcess_Triangulate,
+ * #aiProcess_JoinIdenticalVertices and #aiProcess_ImproveCacheLocality.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_ML_ENABLE   "PP_ML_ENABLE"
+
+// ---------------------------------------------------------------------------
+/** @brief Maximum number of vertices per meshlet.
+ *
+ * Only has an effect if #AI_CONFIG_PP_ML_ENABLE is set. The value is
+ * clamped to [3, 256].
+ * @note The default value is 64.
+ * Property type: integer.
+ */
+#define AI_CONFIG_PP_ML_MAX_VERTICES   "PP_ML_MAX_VERTICES"
+
+// ---------------------------------------------------------------------------
+/** @brief Maximum number of triangles per meshlet.
+ *
+ * Only has an effect if #AI_CONFIG_PP_ML_ENABLE is set. The value must be
+ * at least 1.
+ * @note The default value is 124.
+ * Property type: integer.
+ */
+#define AI_CONFIG_PP_ML_MAX_TRIANGLES   "PP_ML_MAX_TRIANGLES"
+
+// ---------------------------------------------------------------------------
+/** @brief Build quantized copies of the vertex streams of all meshes.
+ *
+ * Each mesh gets an aiMesh::mQuantizedVertices table with 16-bit positions
+ * relative to its bounding box, 2x16-bit octahedral normals, tangents and
+ * bitangents, 16-bit texture coordinates and 8-bit colors, along with the
+ * largest error of each kind of stream. The full precision streams are kept.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_QV_ENABLE   "PP_QV_ENABLE"
+
+// ---------------------------------------------------------------------------
+/** @brief Store quantized texture coordinates as normalized integers.
+ *
+ * Only has an effect if #AI_CONFIG_PP_QV_ENABLE is set. By default texture
+ * coordinates are stored as half floats, which keeps repeating
+ * coordinates exact near 0 but loses precision for large values. If set,
+ * they are stored as unsigned 16-bit integers relative to the bounds of
+ * each channel instead, which gives an even precision.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_QV_UNORM_UVS   "PP_QV_UNORM_UVS"
+
+// ---------------------------------------------------------------------------
+/** @brief Remove redundant animation keys.
+ *
+ * Position, rotation and scaling keys of all node animation channels are
+ * dropped where interpolating the remaining keys reproduces them within
+ * the tolerances below, constant tracks keep a single key. Keys with cubic
+ * spline interpolation are left alone.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_RK_ENABLE   "PP_RK_ENABLE"
+
+// ---------------------------------------------------------------------------
+/** @brief The largest error allowed for position keys, in scene units.
+ *
+ * Only has an effect if #AI_CONFIG_PP_RK_ENABLE is set.
+ * @note The default value is 1e-4.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_RK_POSITION_ERROR   "PP_RK_POSITION_ERROR"
+
+// ---------------------------------------------------------------------------
+/** @brief The largest error allowed for rotation keys, in radians.
+ *
+ * Only has an effect if #AI_CONFIG_PP_RK_ENABLE is set.
+ * @note The default value is 1e-4.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_RK_ROTATION_ERROR   "PP_RK_ROTATION_ERROR"
+
+// ---------------------------------------------------------------------------
+/** @brief The largest error allowed for scaling keys, per component.
+ *
+ * Only has an effect if #AI_CONFIG_PP_RK_ENABLE is set.
+ * @note The default value is 1e-4.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_RK_SCALING_ERROR   "PP_RK_SCALING_ERROR"
+
+// ---------------------------------------------------------------------------
+/** @brief Store the faces of each mesh in a contiguous index buffer.
+ *
+ * This is the very last step of the post-processing pipeline. Afterwards
+ * aiMesh::mIndices holds the indices of all faces back to back, and
+ * aiFace::mIndices of each face points into it, so the whole
+ * index data of a mesh can be uploaded with a single copy. The buffer is
+ * dropped again (faces get their own index arrays back) whenever further
+ * post-processing is applied to the scene.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_PI_ENABLE   "PP_PI_ENABLE"
+
+// ---------------------------------------------------------------------------
+/** @brief Provide a 16-bit copy of the contiguous index buffer.
+ *
+ * Only has an effect if #AI_CONFIG_PP_PI_ENABLE is set. aiMesh::mIndices16
+ * is filled for all meshes with no more than 65536 vertices.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_PI_16BIT   "PP_PI_16BIT"
+
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the levels of the #aiProcess_ValidateDataStructure step.
+ *
+ *  Each level includes the checks of the levels below it.
+ */
+enum aiValidationLevel
+{
+    /** Only the layout of the scene: array pointers match their counts,
+     *  including the index array of every face, strings are valid and the
+     *  node graph is consistent. Apart from one pass over the faces, the
+     *  cost does not depend on the number of vertices, weights or keys. */
+    aiValidationLevel_STRUCTURE = 0x0,
+
+    /** Additionally all indices are checked to be in range (faces, bone
+     *  weights, meshlets, material properties), so the scene is safe to
+     *  access. */
+    aiValidationLevel_BOUNDS = 0x1,
+
+    /** All checks, including semantic ones such as duplicate names,
+     *  animation key order, bone weight sums and material consistency. */
+    aiValidationLevel_FULL = 0x2,
+
+    /** This value is not used. It is just there to force the
+     *  compiler to map this enum to a 32 Bit integer. */
+#ifndef SWIG
+    _aiValidationLevel_Force32Bit = 0x9fffffff
+#endif
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Input parameter to the #aiProcess_ValidateDataStructure step:
+ *  Specifies how thorough the scene is validated.
+ *
+ * A value of the #aiValidationLevel enum. Lower levels skip the sweeps
+ * over all elements, which makes validation affordable for large scenes.
+ * @note The default value is aiValidationLevel_FULL.
+ * Property type: integer.
+ */
+#define AI_CONFIG_PP_VDS_LEVEL   "PP_VDS_LEVEL"
+
 // ---------------------------------------------------------------------------
 /** @brief Enumerates components of the aiScene and aiMesh data structures
  *  that can be excluded from the import using the #aiProcess_RemoveComponent step.
@@ -492,6 +764,21 @@ enum aiComponent
 #define AI_CONFIG_PP_FID_IGNORE_TEXTURECOORDS        \
     "PP_FID_IGNORE_TEXTURECOORDS"
 
+// ---------------------------------------------------------------------------
+/** @brief Configures the #aiProcess_JoinIdenticalVertices step to join only
+ *  vertices whose attributes are bitwise identical.
+ *
+ *  Instead of comparing every vertex component with a small epsilon, the
+ *  present attributes of each vertex (including the ones of its animation
+ *  meshes) are packed into a compact key and equal keys are grouped by
+ *  sorting. This is considerably faster and lighter on memory for large
+ *  meshes, and the meshes of a scene are processed in parallel.
+ *  Vertices that differ by a tiny amount are not joined in this mode.
+ *  Property type: bool. Default value: false.
+ */
+#define AI_CONFIG_PP_JIV_EXACT_MATCH                \
+    "PP_JIV_EXACT_MATCH"
+
 // TransformUVCoords evaluates UV scalings
 #define AI_UVTRAFO_SCALING 0x1
 
@@ -931,6 +1218,20 @@ enum aiComponent
 #define AI_CONFIG_IMPORT_MD5_NO_ANIM_AUTOLOAD           \
     "IMPORT_MD5_NO_ANIM_AUTOLOAD"
 
+// ---------------------------------------------------------------------------
+/** @brief Configures the STL loader to weld vertices of binary files while
+ *  reading the facets.
+ *
+ * Binary STL stores three unique vertices per facet. If this property is
+ * set, vertices with bitwise identical positions (and facet colors) are
+ * shared between facets, which yields an indexed mesh with roughly half
+ * as many vertices without running #aiProcess_JoinIdenticalVertices. The
+ * vertex normals are the normalized sum of the adjacent facet normals.
+ * Property type: bool. Default value: false.
+ */
+#define AI_CONFIG_IMPORT_STL_WELD_VERTICES \
+    "IMPORT_STL_WELD_VERTICES"
+
 // ---------------------------------------------------------------------------
 /** @brief Defines the begin of the time range for which the LWS loader
  *    evaluates animations and computes aiNodeAnim's.
@@ -1108,6 +1409,18 @@ enum aiComponent
  */
 #define AI_CONFIG_EXPORT_POINT_CLOUDS "EXPORT_POINT_CLOUDS"
 
+/** @brief Specifies whether the assbin exporter writes a memory-mappable file
+ *
+ *  Mappable files store all mesh arrays contiguously and 64-byte aligned, and
+ *  list them in an offset table. The assbin importer reads them with a few bulk
+ *  copies, and applications can access the meshes of a mapped file without any
+ *  copy through AssbinMappedView (see AssbinMappedView.h). They are never
+ *  compressed, and importers predating the format reject them.
+ *
+ * Property type: Bool. Default value: false.
+ */
+#define AI_CONFIG_EXPORT_ASSBIN_MAPPABLE "EXPORT_ASSBIN_MAPPABLE"
+
 /** @brief Specifies whether to use the deprecated KHR_materials_pbrSpecularGlossiness extension
  * 
  * When this flag is undefined any material with specularity will use the new KHR_materials_specular
@@ -1184,4 +1497,11 @@ enum aiComponent
 
 /* #undef ASSIMP_DOUBLE_PRECISION */
 
+/** @brief Specifies if assimp is built without threading support
+ *
+ * Property type: Bool. Default value: undefined.
+ */
+
+/* #undef ASSIMP_BUILD_SINGLETHREADED */
+
 #endif // !! AI_CONFIG_H_INC
@@ -616,6 +616,319 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief A small cluster of triangles of a mesh, e.g. for mesh shaders.
+ *
+ * The vertices of the meshlet are aiMeshletData::mVertices[mVertexOffset]
+ * to aiMeshletData::mVertices[mVertexOffset + mNumVertices - 1], each one
+ * an index into the vertex arrays of the mesh. Its triangles are stored as
+ * three indices into this vertex list each, starting at
+ * aiMeshletData::mTriangles[mTriangleOffset].
+ *
+ * The bounds allow culling the whole meshlet. It is invisible if its
+ * bounding sphere is outside of the view frustum, or if all of its
+ * triangles face away from the camera, i.e. if
+ * @code
+ * dot(normalize(mConeApex - cameraPosition), mConeAxis) >= mConeCutoff
+ * @endcode
+ */
+struct aiMeshlet {
+    /** First entry of the meshlet in aiMeshletData::mVertices */
+    unsigned int mVertexOffset;
+
+    /** Number of vertices of the meshlet */
+    unsigned int mNumVertices;
+
+    /** First entry of the meshlet in aiMeshletData::mTriangles */
+    unsigned int mTriangleOffset;
+
+    /** Number of triangles of the meshlet, each takes three entries */
+    unsigned int mNumTriangles;
+
+    /** Center of the bounding sphere of the meshlet */
+    C_STRUCT aiVector3D mCenter;
+
+    /** Radius of the bounding sphere of the meshlet */
+    ai_real mRadius;
+
+    /** Apex of the normal cone of the meshlet */
+    C_STRUCT aiVector3D mConeApex;
+
+    /** Axis of the normal cone, a zero vector if the normals span too
+     *  wide a range for backface culling */
+    C_STRUCT aiVector3D mConeAxis;
+
+    /** Sine of the half angle of the normal cone, 1 if the meshlet can't
+     *  be culled by its normal cone */
+    ai_real mConeCutoff;
+
+#ifdef __cplusplus
+    //! Default constructor
+    aiMeshlet() AI_NO_EXCEPT
+            : mVertexOffset(0),
+              mNumVertices(0),
+              mTriangleOffset(0),
+              mNumTriangles(0),
+              mCenter(),
+              mRadius(0),
+              mConeApex(),
+              mConeAxis(),
+              mConeCutoff(1) {
+        // empty
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief The meshlets of a mesh and their shared vertex and triangle tables.
+ *
+ * Only present if meshlets were built by the #AI_CONFIG_PP_ML_ENABLE
+ * post-processing, see aiMesh::mMeshletData. Every face of the mesh is
+ * part of exactly one meshlet.
+ */
+struct aiMeshletData {
+    /** Number of meshlets */
+    unsigned int mNumMeshlets;
+
+    /** The meshlets, mNumMeshlets in size */
+    C_STRUCT aiMeshlet *mMeshlets;
+
+    /** Number of entries in mVertices */
+    unsigned int mNumVertices;
+
+    /** Vertex indices of all meshlets, back to back */
+    unsigned int *mVertices;
+
+    /** Number of triangles of all meshlets, mTriangles holds three
+     *  times as many entries */
+    unsigned int mNumTriangles;
+
+    /** Triangles of all meshlets, back to back. Each entry is an index
+     *  into the vertex list of its meshlet. */
+    unsigned char *mTriangles;
+
+#ifdef __cplusplus
+    //! Default constructor
+    aiMeshletData() AI_NO_EXCEPT
+            : mNumMeshlets(0),
+              mMeshlets(nullptr),
+              mNumVertices(0),
+              mVertices(nullptr),
+              mNumTriangles(0),
+              mTriangles(nullptr) {
+        // empty
+    }
+
+    //! Copy constructor
+    aiMeshletData(const aiMeshletData &o)
+            : mNumMeshlets(o.mNumMeshlets),
+              mMeshlets(nullptr),
+              mNumVertices(o.mNumVertices),
+              mVertices(nullptr),
+              mNumTriangles(o.mNumTriangles),
+              mTriangles(nullptr) {
+        if (o.mMeshlets) {
+            mMeshlets = new aiMeshlet[mNumMeshlets];
+            for (unsigned int a = 0; a < mNumMeshlets; a++) {
+                mMeshlets[a] = o.mMeshlets[a];
+            }
+        }
+        if (o.mVertices) {
+            mVertices = new unsigned int[mNumVertices];
+            ::memcpy(mVertices, o.mVertices, mNumVertices * sizeof(unsigned int));
+        }
+        if (o.mTriangles) {
+            mTriangles = new unsigned char[mNumTriangles * 3];
+            ::memcpy(mTriangles, o.mTriangles, mNumTriangles * 3);
+        }
+    }
+
+    aiMeshletData &operator=(const aiMeshletData &) = delete;
+
+    //! Destructor
+    ~aiMeshletData() {
+        delete[] mMeshlets;
+        delete[] mVertices;
+        delete[] mTriangles;
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the storage formats of quantized texture coordinates,
+ *  see aiQuantizedVertices::mTextureCoordsFormat.
+ */
+enum aiQuantizedUVFormat {
+    /** IEEE 754 half precision floats */
+    aiQuantizedUVFormat_HALF = 0x0,
+
+    /** Unsigned 16-bit integers, normalized to the bounds of the channel */
+    aiQuantizedUVFormat_UNORM16 = 0x1,
+
+/** This value is not used. It is just here to force the
+     *  compiler to map this enum to a 32 Bit integer.
+     */
+#ifndef SWIG
+    _aiQuantizedUVFormat_Force32Bit = INT_MAX
+#endif
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Compact copies of the vertex streams of a mesh.
+ *
+ * Only present if the #AI_CONFIG_PP_QV_ENABLE post-processing was applied,
+ * see aiMesh::mQuantizedVertices. Each stream is present if the mesh has
+ * the corresponding stream, all of them are mNumVertices long:
+ *
+ * - Positions are 3 unsigned 16-bit integers per vertex, normalized to
+ *   the bounding box of the mesh:
+ *   @code position = mPositionOffset + mPositionScale * (q / 65535) @endcode
+ * - Normals, tangents and bitangents are 2 signed 16-bit integers per
+ *   vertex, an octahedral encoding of the direction. With
+ *   @code x = q[0] / 32767, y = q[1] / 32767, z = 1 - |x| - |y| @endcode
+ *   x and y move towards zero by max(-z, 0) each, then (x, y, z) is
+ *   normalized.
+ * - Texture coordinates are mNumUVComponents values per vertex, either
+ *   half floats or unsigned 16-bit integers normalized to the
+ *   bounds of the channel, see mTextureCoordsFormat.
+ * - Colors are 4 unsigned 8-bit integers per vertex (r, g, b, a), value
+ *   divided by 255. Components outside [0, 1] are clamped.
+ *
+ * The largest deviation of any decoded value from the original value is
+ * reported for each kind of stream.
+ */
+struct aiQuantizedVertices {
+    /** Number of vertices, same as aiMesh::mNumVertices */
+    unsigned int mNumVertices;
+
+    /** Position of the minimum corner of the bounding box */
+    C_STRUCT aiVector3D mPositionOffset;
+
+    /** Size of the bounding box */
+    C_STRUCT aiVector3D mPositionScale;
+
+    /** Quantized positions, nullptr if not present */
+    unsigned short *mPositions;
+
+    /** Octahedral normals, nullptr if not present */
+    short *mNormals;
+
+    /** Octahedral tangents, nullptr if not present */
+    short *mTangents;
+
+    /** Octahedral bitangents, nullptr if not present */
+    short *mBitangents;
+
+    /** Format of all texture coordinate channels */
+    C_ENUM aiQuantizedUVFormat mTextureCoordsFormat;
+
+    /** Values per vertex of each texture coordinate channel, same as
+     *  aiMesh::mNumUVComponents */
+    unsigned int mNumUVComponents[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+    /** Minimum of each texture coordinate channel, for #aiQuantizedUVFormat_UNORM16 */
+    C_STRUCT aiVector3D mTextureCoordsOffset[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+    /** Extent of each texture coordinate channel, for #aiQuantizedUVFormat_UNORM16 */
+    C_STRUCT aiVector3D mTextureCoordsScale[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+    /** Quantized texture coordinates, nullptr if not present */
+    unsigned short *mTextureCoords[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+    /** Quantized vertex colors, nullptr if not present */
+    unsigned char *mColors[AI_MAX_NUMBER_OF_COLOR_SETS];
+
+    /** Largest deviation of a decoded position component */
+    ai_real mPositionError;
+
+    /** Largest angle between a decoded and the original normal, tangent
+     *  or bitangent, in radians */
+    ai_real mNormalError;
+
+    /** Largest deviation of a decoded texture coordinate component */
+    ai_real mTextureCoordsError;
+
+    /** Largest deviation of a decoded color component */
+    ai_real mColorError;
+
+#ifdef __cplusplus
+    //! Default constructor
+    aiQuantizedVertices() AI_NO_EXCEPT
+            : mNumVertices(0),
+              mPositionOffset(),
+              mPositionScale(),
+              mPositions(nullptr),
+              mNormals(nullptr),
+              mTangents(nullptr),
+              mBitangents(nullptr),
+              mTextureCoordsFormat(aiQuantizedUVFormat_HALF),
+              mNumUVComponents{ 0 },
+              mTextureCoordsOffset(),
+              mTextureCoordsScale(),
+              mTextureCoords{ nullptr },
+              mColors{ nullptr },
+              mPositionError(0),
+              mNormalError(0),
+              mTextureCoordsError(0),
+              mColorError(0) {
+        // empty
+    }
+
+    //! Copy constructor
+    aiQuantizedVertices(const aiQuantizedVertices &o)
+            : aiQuantizedVertices() {
+        mNumVertices = o.mNumVertices;
+        mPositionOffset = o.mPositionOffset;
+        mPositionScale = o.mPositionScale;
+        mPositions = CopyStream(o.mPositions, 3);
+        mNormals = CopyStream(o.mNormals, 2);
+        mTangents = CopyStream(o.mTangents, 2);
+        mBitangents = CopyStream(o.mBitangents, 2);
+        mTextureCoordsFormat = o.mTextureCoordsFormat;
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; a++) {
+            mNumUVComponents[a] = o.mNumUVComponents[a];
+            mTextureCoordsOffset[a] = o.mTextureCoordsOffset[a];
+            mTextureCoordsScale[a] = o.mTextureCoordsScale[a];
+            mTextureCoords[a] = CopyStream(o.mTextureCoords[a], mNumUVComponents[a]);
+        }
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; a++) {
+            mColors[a] = CopyStream(o.mColors[a], 4);
+        }
+        mPositionError = o.mPositionError;
+        mNormalError = o.mNormalError;
+        mTextureCoordsError = o.mTextureCoordsError;
+        mColorError = o.mColorError;
+    }
+
+    aiQuantizedVertices &operator=(const aiQuantizedVertices &) = delete;
+
+    //! Destructor
+    ~aiQuantizedVertices() {
+        delete[] mPositions;
+        delete[] mNormals;
+        delete[] mTangents;
+        delete[] mBitangents;
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; a++) {
+            delete[] mTextureCoords[a];
+        }
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; a++) {
+            delete[] mColors[a];
+        }
+    }
+
+private:
+    unsigned short *CopyStream(const unsigned short *in, unsigned int perVertex) const {
+        return in ? static_cast<unsigned short *>(::memcpy(new unsigned short[mNumVertices * perVertex], in, mNumVertices * perVertex * sizeof(unsigned short))) : nullptr;
+    }
+    short *CopyStream(const short *in, unsigned int perVertex) const {
+        return in ? static_cast<short *>(::memcpy(new short[mNumVertices * perVertex], in, mNumVertices * perVertex * sizeof(short))) : nullptr;
+    }
+    unsigned char *CopyStream(const unsigned char *in, unsigned int perVertex) const {
+        return in ? static_cast<unsigned char *>(::memcpy(new unsigned char[mNumVertices * perVertex], in, mNumVertices * perVertex)) : nullptr;
+    }
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +1139,50 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * The number of indices in the contiguous index buffer. This is the
+     * sum of aiFace::mNumIndices over all faces, 0 if there is no buffer.
+     */
+    unsigned int mNumIndices;
+
+    /**
+     * @brief Contiguous index buffer, nullptr if not present.
+     *
+     * Only present if the #AI_CONFIG_PP_PI_ENABLE property was set for the
+     * post-processing pipeline. All faces of the mesh are stored back to
+     * back in this array, in face order, and aiFace::mIndices of each face
+     * points into it, so the faces don't own their indices anymore. The
+     * array is mNumIndices in size.
+     */
+    unsigned int *mIndices;
+
+    /**
+     * @brief 16-bit copy of #mIndices, nullptr if not present.
+     *
+     * Only present if #AI_CONFIG_PP_PI_16BIT was set as well and the mesh
+     * has no more than 65536 vertices. The array is mNumIndices in size.
+     */
+    unsigned short *mIndices16;
+
+    /**
+     * @brief Meshlets covering the faces of the mesh, nullptr if not present.
+     *
+     * Only present if the #AI_CONFIG_PP_ML_ENABLE property was set for the
+     * post-processing pipeline. The meshlets refer to the vertices and
+     * faces as they are, so they are dropped whenever further
+     * post-processing is applied.
+     */
+    C_STRUCT aiMeshletData *mMeshletData;
+
+    /**
+     * @brief Quantized copies of the vertex streams, nullptr if not present.
+     *
+     * Only present if the #AI_CONFIG_PP_QV_ENABLE property was set for the
+     * post-processing pipeline. The full precision streams are kept. The
+     * copies are dropped whenever further post-processing is applied.
+     */
+    C_STRUCT aiQuantizedVertices *mQuantizedVertices;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +1205,12 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mNumIndices(0),
+              mIndices(nullptr),
+              mIndices16(nullptr),
+              mMeshletData(nullptr),
+              mQuantizedVertices(nullptr) {
         // empty
     }
 
@@ -894,7 +1256,10 @@ struct aiMesh {
             delete[] mAnimMeshes;
         }
 
+        ReleaseIndexBuffer(false);
         delete[] mFaces;
+        delete mMeshletData;
+        delete mQuantizedVertices;
     }
 
     //! @brief Check whether the mesh contains positions. Provided no special
@@ -1027,6 +1392,57 @@ struct aiMesh {
         return mTextureCoordsNames[index];
     }
 
+    //! @brief  Check whether the faces of the mesh are stored in a
+    //!         contiguous index buffer.
+    //! @return true, if #mIndices is present.
+    bool HasIndexBuffer() const {
+        return mIndices != nullptr && mNumIndices > 0;
+    }
+
+    //! @brief  Check whether the mesh has been split into meshlets.
+    //! @return true, if #mMeshletData is present.
+    bool HasMeshlets() const {
+        return mMeshletData != nullptr && mMeshletData->mNumMeshlets > 0;
+    }
+
+    //! @brief  Check whether the mesh has quantized vertex streams.
+    //! @return true, if #mQuantizedVertices is present.
+    bool HasQuantizedVertices() const {
+        return mQuantizedVertices != nullptr && mQuantizedVertices->mNumVertices > 0;
+    }
+
+    //! @brief  Drop the contiguous index buffer.
+    //! @param  keepFaces If true, each face gets its own copy of its
+    //!         indices again, otherwise faces pointing into the buffer
+    //!         are left without indices.
+    void ReleaseIndexBuffer(bool keepFaces = true) {
+        if (mIndices == nullptr) {
+            return;
+        }
+
+        const unsigned int *end = mIndices + mNumIndices;
+        for (unsigned int a = 0; mFaces != nullptr && a < mNumFaces; a++) {
+            aiFace &face = mFaces[a];
+            if (face.mIndices < mIndices || face.mIndices >= end) {
+                continue;
+            }
+            if (keepFaces) {
+                unsigned int *indices = new unsigned int[face.mNumIndices];
+                ::memcpy(indices, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+                face.mIndices = indices;
+            } else {
+                face.mIndices = nullptr;
+                face.mNumIndices = 0;
+            }
+        }
+
+        delete[] mIndices;
+        delete[] mIndices16;
+        mIndices = nullptr;
+        mIndices16 = nullptr;
+        mNumIndices = 0;
+    }
+
 #endif // __cplusplus
 };
 
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "UnitTestPCH.h"
 
+#include "Common/ScenePrivate.h"
 #include <assimp/scene.h>
 #include <assimp/SceneCombiner.h>
 
@@ -70,6 +71,36 @@ TEST_F(utScene, findNodeTest) {
 	EXPECT_EQ(child, found);
 }
 
+TEST_F(utScene, sceneIndexTest) {
+	scene->mRootNode = new aiNode("root");
+	aiNode *children[3] = { new aiNode("a"), new aiNode("b"), new aiNode("a") };
+	scene->mRootNode->addChildren(3, children);
+	aiNode *grandChild = new aiNode("c");
+	children[0]->addChildren(1, &grandChild);
+
+	scene->mNumAnimations = 1;
+	scene->mAnimations = new aiAnimation *[1]{ new aiAnimation() };
+	scene->mAnimations[0]->mNumChannels = 1;
+	scene->mAnimations[0]->mChannels = new aiNodeAnim *[1]{ new aiNodeAnim() };
+	scene->mAnimations[0]->mChannels[0]->mNodeName.Set("b");
+
+	// same results as the recursive search, the first node in pre-order wins
+	SceneIndex &index = GetSceneIndex(scene);
+	EXPECT_EQ(&index, &GetSceneIndex(scene));
+	for (const char *name : { "root", "a", "b", "c", "d" }) {
+		EXPECT_EQ(scene->mRootNode->FindNode(name), index.FindNode(aiString(name)));
+	}
+	EXPECT_EQ(children[0], index.FindNode(aiString("a")));
+	EXPECT_EQ(nullptr, index.FindBone(aiString("a")));
+	EXPECT_EQ(scene->mAnimations[0]->mChannels[0], index.FindNodeAnim(0, aiString("b")));
+	EXPECT_EQ(nullptr, index.FindNodeAnim(0, aiString("a")));
+	EXPECT_EQ(nullptr, index.FindNodeAnim(1, aiString("b")));
+
+	InvalidateSceneIndex(scene);
+	children[0]->mName.Set("renamed");
+	EXPECT_EQ(children[2], GetSceneIndex(scene).FindNode(aiString("a")));
+}
+
 TEST_F(utScene, sceneHasContentTest) {
     EXPECT_FALSE(scene->HasAnimations());
 	EXPECT_FALSE(scene->HasMaterials());
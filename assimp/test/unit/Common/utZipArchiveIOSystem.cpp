@@ -0,0 +1,186 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+#include "UnitTestPCH.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/ZipArchiveIOSystem.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+class utZipArchiveIOSystem : public ::testing::Test {
+    // empty
+};
+
+namespace {
+
+// Reads a whole file of the archive, empty if it can't be opened
+std::vector<char> ReadAll(ZipArchiveIOSystem &archive, const std::string &name) {
+    std::vector<char> data;
+    IOStream *stream = archive.Open(name.c_str());
+    if (nullptr != stream) {
+        data.resize(stream->FileSize());
+        EXPECT_EQ(data.size(), stream->Read(data.data(), 1, data.size()));
+        archive.Close(stream);
+    }
+    return data;
+}
+
+// Compares every file of an archive once prefetched and once extracted as usual
+void ExpectPrefetchedContents(const char *path, size_t expectedFiles) {
+    DefaultIOSystem io;
+    ZipArchiveIOSystem plain(&io, path);
+    ZipArchiveIOSystem prefetched(&io, path);
+    ASSERT_TRUE(plain.isOpen());
+    ASSERT_TRUE(prefetched.isOpen());
+
+    std::vector<std::string> files;
+    prefetched.getFileList(files);
+    ASSERT_EQ(expectedFiles, files.size());
+
+    // unknown names are skipped, prefetching twice keeps the data
+    std::vector<std::string> prefetchList = files;
+    prefetchList.emplace_back("missing.txt");
+    prefetched.prefetchFiles(prefetchList);
+    prefetched.prefetchFiles(prefetchList);
+
+    for (const std::string &file : files) {
+        const std::vector<char> expected = ReadAll(plain, file);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(expected, ReadAll(prefetched, file));
+
+        // the prefetched data is handed over once, later opens extract again
+        EXPECT_EQ(expected, ReadAll(prefetched, file));
+    }
+}
+
+// CRC-32 as used by zip
+uint32_t Crc32(const std::string &data) {
+    uint32_t crc = 0xffffffffu;
+    for (const char c : data) {
+        crc ^= static_cast<uint8_t>(c);
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void Append(std::string &out, uint32_t value, unsigned int bytes) {
+    for (unsigned int i = 0; i < bytes; ++i) {
+        out += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+// Writes a zip archive with stored, uncompressed entries
+void WriteStoredZip(const char *path, const std::vector<std::pair<std::string, std::string>> &entries) {
+    std::string zip, directory;
+    for (const auto &entry : entries) {
+        const uint32_t crc = Crc32(entry.second), size = static_cast<uint32_t>(entry.second.size());
+        const uint32_t nameLength = static_cast<uint32_t>(entry.first.size());
+
+        Append(directory, 0x02014b50u, 4);
+        Append(directory, 20, 2); // version made by
+        Append(directory, 20, 2); // version needed
+        Append(directory, 0, 2); // flags
+        Append(directory, 0, 2); // stored
+        Append(directory, 0, 2); // time
+        Append(directory, 0x21, 2); // date
+        Append(directory, crc, 4);
+        Append(directory, size, 4);
+        Append(directory, size, 4);
+        Append(directory, nameLength, 2);
+        Append(directory, 0, 2); // extra field
+        Append(directory, 0, 2); // comment
+        Append(directory, 0, 2); // disk
+        Append(directory, 0, 2); // internal attributes
+        Append(directory, 0, 4); // external attributes
+        Append(directory, static_cast<uint32_t>(zip.size()), 4);
+        directory += entry.first;
+
+        Append(zip, 0x04034b50u, 4);
+        Append(zip, 20, 2);
+        Append(zip, 0, 2);
+        Append(zip, 0, 2);
+        Append(zip, 0, 2);
+        Append(zip, 0x21, 2);
+        Append(zip, crc, 4);
+        Append(zip, size, 4);
+        Append(zip, size, 4);
+        Append(zip, nameLength, 2);
+        Append(zip, 0, 2);
+        zip += entry.first;
+        zip += entry.second;
+    }
+
+    const uint32_t directoryOffset = static_cast<uint32_t>(zip.size());
+    zip += directory;
+    Append(zip, 0x06054b50u, 4);
+    Append(zip, 0, 2);
+    Append(zip, 0, 2);
+    Append(zip, static_cast<uint32_t>(entries.size()), 2);
+    Append(zip, static_cast<uint32_t>(entries.size()), 2);
+    Append(zip, static_cast<uint32_t>(directory.size()), 4);
+    Append(zip, directoryOffset, 4);
+    Append(zip, 0, 2);
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(zip.data(), static_cast<std::streamsize>(zip.size()));
+}
+
+} // namespace
+
+TEST_F(utZipArchiveIOSystem, prefetchDeflatedTest) {
+    ExpectPrefetchedContents(ASSIMP_TEST_MODELS_DIR "/Collada/duck.zae", 3);
+}
+
+TEST_F(utZipArchiveIOSystem, prefetchStoredTest) {
+    WriteStoredZip(ASSIMP_TEST_MODELS_DIR "/stored_out.zip", {
+            { "a.txt", "stored entries are used as they are" },
+            { "dir/b.txt", std::string(100000, 'b') } });
+    ExpectPrefetchedContents(ASSIMP_TEST_MODELS_DIR "/stored_out.zip", 2);
+}
@@ -90,6 +90,55 @@ public:
         return scene;
     }
 
+    // A grid of n x n quads in the xy plane, split into triangles facing +z, with
+    // uvs spanning [0,1]. bump lifts the vertices by up to 4 * bump in a fixed
+    // pattern. If seam is set, the vertices of the middle column are duplicated
+    // with different uvs and used by the right half of the grid.
+    static aiMesh *createGridMesh( unsigned int n, ai_real bump = 0, bool seam = false ) {
+        const unsigned int row = n + 1;
+        const unsigned int mid = n / 2;
+        aiMesh *mesh = new aiMesh;
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = row * row + ( seam ? row : 0 );
+        mesh->mVertices = new aiVector3D[ mesh->mNumVertices ];
+        mesh->mTextureCoords[ 0 ] = new aiVector3D[ mesh->mNumVertices ];
+        mesh->mNumUVComponents[ 0 ] = 2;
+        for ( unsigned int y = 0; y < row; ++y ) {
+            for ( unsigned int x = 0; x < row; ++x ) {
+                const ai_real z = ( ( x * 7 + y * 3 ) % 5 ) * bump;
+                mesh->mVertices[ y * row + x ] = aiVector3D( ai_real( x ), ai_real( y ), z );
+                mesh->mTextureCoords[ 0 ][ y * row + x ] = aiVector3D( ai_real( x ) / n, ai_real( y ) / n, 0 );
+            }
+            if ( seam ) {
+                const unsigned int copy = row * row + y;
+                mesh->mVertices[ copy ] = mesh->mVertices[ y * row + mid ];
+                mesh->mTextureCoords[ 0 ][ copy ] = aiVector3D( 1, 1, 0 );
+            }
+        }
+
+        mesh->mNumFaces = n * n * 2;
+        mesh->mFaces = new aiFace[ mesh->mNumFaces ];
+        unsigned int f = 0;
+        for ( unsigned int y = 0; y < n; ++y ) {
+            for ( unsigned int x = 0; x < n; ++x ) {
+                auto index = [&]( unsigned int vx, unsigned int vy ) {
+                    if ( seam && vx == mid && x >= mid ) {
+                        return row * row + vy;
+                    }
+                    return vy * row + vx;
+                };
+                const unsigned int quad[ 4 ] = { index( x, y ), index( x + 1, y ), index( x + 1, y + 1 ), index( x, y + 1 ) };
+                const unsigned int tris[ 2 ][ 3 ] = { { quad[ 0 ], quad[ 1 ], quad[ 2 ] }, { quad[ 0 ], quad[ 2 ], quad[ 3 ] } };
+                for ( const auto &tri : tris ) {
+                    aiFace &face = mesh->mFaces[ f++ ];
+                    face.mNumIndices = 3;
+                    face.mIndices = new unsigned int[ 3 ]{ tri[ 0 ], tri[ 1 ], tri[ 2 ] };
+                }
+            }
+        }
+        return mesh;
+    }
+
     static void releaseDefaultTestModel( aiScene **scene ) {
         delete *scene;
         *scene = nullptr;
@@ -0,0 +1,159 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/AnimationEvaluator.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utAnimationEvaluator : public ::testing::Test {
+public:
+    // root -> arm -> hand, the arm moves along x over 20 keys and the
+    // hand turns a quarter around z.
+    static aiScene *MakeScene() {
+        aiScene *scene = new aiScene();
+        scene->mRootNode = new aiNode("root");
+        scene->mRootNode->mTransformation.c4 = 5;
+        aiNode *arm = new aiNode("arm");
+        arm->mTransformation.a4 = 1;
+        aiNode *hand = new aiNode("hand");
+        hand->mTransformation.b4 = 2;
+        scene->mRootNode->addChildren(1, &arm);
+        arm->addChildren(1, &hand);
+
+        aiAnimation *anim = new aiAnimation();
+        anim->mDuration = 20;
+        anim->mTicksPerSecond = 10;
+        anim->mNumChannels = 3;
+        anim->mChannels = new aiNodeAnim *[3];
+
+        aiNodeAnim *armAnim = anim->mChannels[0] = new aiNodeAnim();
+        armAnim->mNodeName.Set("arm");
+        armAnim->mNumPositionKeys = 21;
+        armAnim->mPositionKeys = new aiVectorKey[21];
+        for (unsigned int i = 0; i < 21; ++i) {
+            armAnim->mPositionKeys[i] = aiVectorKey(i, aiVector3D(ai_real(i), 0, 0));
+        }
+        armAnim->mPositionKeys[4].mInterpolation = aiAnimInterpolation_Step;
+
+        aiNodeAnim *handAnim = anim->mChannels[1] = new aiNodeAnim();
+        handAnim->mNodeName.Set("hand");
+        handAnim->mNumRotationKeys = 2;
+        handAnim->mRotationKeys = new aiQuatKey[2];
+        handAnim->mRotationKeys[0] = aiQuatKey(0, aiQuaternion());
+        handAnim->mRotationKeys[1] = aiQuatKey(20, aiQuaternion(aiVector3D(0, 0, 1), ai_real(AI_MATH_HALF_PI)));
+
+        anim->mChannels[2] = new aiNodeAnim();
+        anim->mChannels[2]->mNodeName.Set("missing");
+
+        scene->mNumAnimations = 1;
+        scene->mAnimations = new aiAnimation *[1];
+        scene->mAnimations[0] = anim;
+        return scene;
+    }
+
+    static ai_real ArmX(const AnimationEvaluator &evaluator) {
+        return evaluator.GetLocalTransforms()[1].a4;
+    }
+};
+
+TEST_F(utAnimationEvaluator, nodeTableTest) {
+    std::unique_ptr<aiScene> scene(MakeScene());
+    AnimationEvaluator evaluator(scene.get(), nullptr);
+    ASSERT_EQ(3u, evaluator.GetNumNodes());
+    EXPECT_EQ(AnimationEvaluator::NoNode, evaluator.GetParent(0));
+    EXPECT_EQ(0u, evaluator.GetParent(1));
+    EXPECT_EQ(1u, evaluator.GetParent(2));
+    EXPECT_EQ(2u, evaluator.FindNode("hand"));
+    EXPECT_EQ(AnimationEvaluator::NoNode, evaluator.FindNode("missing"));
+
+    // without an animation the bind pose is evaluated
+    evaluator.Evaluate(1.0);
+    const aiMatrix4x4 &hand = evaluator.GetGlobalTransforms()[2];
+    EXPECT_EQ(aiVector3D(1, 2, 5), aiVector3D(hand.a4, hand.b4, hand.c4));
+}
+
+TEST_F(utAnimationEvaluator, sampleKeysTest) {
+    std::unique_ptr<aiScene> scene(MakeScene());
+    AnimationEvaluator evaluator(scene.get(), scene->mAnimations[0]);
+
+    evaluator.EvaluateTicks(0.5);
+    EXPECT_FLOAT_EQ(0.5f, ArmX(evaluator));
+    // far jumps forward and seeks backward find the right keys
+    evaluator.EvaluateTicks(17.25);
+    EXPECT_FLOAT_EQ(17.25f, ArmX(evaluator));
+    evaluator.EvaluateTicks(3.0);
+    EXPECT_FLOAT_EQ(3.0f, ArmX(evaluator));
+    // step keys hold their value
+    evaluator.EvaluateTicks(4.5);
+    EXPECT_FLOAT_EQ(4.0f, ArmX(evaluator));
+    // outside the key range the nearest key is used
+    evaluator.EvaluateTicks(-1.0);
+    EXPECT_FLOAT_EQ(0.0f, ArmX(evaluator));
+    evaluator.EvaluateTicks(30.0);
+    EXPECT_FLOAT_EQ(20.0f, ArmX(evaluator));
+
+    // seconds wrap around the duration: 2.5s are 25 ticks, i.e. 5 ticks
+    evaluator.Evaluate(2.5);
+    EXPECT_FLOAT_EQ(5.0f, ArmX(evaluator));
+}
+
+TEST_F(utAnimationEvaluator, hierarchyTest) {
+    std::unique_ptr<aiScene> scene(MakeScene());
+    AnimationEvaluator evaluator(scene.get(), scene->mAnimations[0]);
+    evaluator.EvaluateTicks(10.0);
+
+    // the hand keeps its translation, only the rotation is animated
+    const aiMatrix4x4 &local = evaluator.GetLocalTransforms()[2];
+    EXPECT_NEAR(0.0f, local.a4, 1e-5f);
+    EXPECT_NEAR(2.0f, local.b4, 1e-5f);
+    const aiVector3D x = local * aiVector3D(1, 0, 0) - aiVector3D(local.a4, local.b4, local.c4);
+    EXPECT_NEAR(std::sqrt(0.5f), x.x, 1e-5f);
+    EXPECT_NEAR(std::sqrt(0.5f), x.y, 1e-5f);
+
+    const aiMatrix4x4 &global = evaluator.GetGlobalTransforms()[2];
+    EXPECT_NEAR(10.0f, global.a4, 1e-5f);
+    EXPECT_NEAR(2.0f, global.b4, 1e-5f);
+    EXPECT_NEAR(5.0f, global.c4, 1e-5f);
+}
@@ -40,10 +40,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "AssetLib/Assbin/AssbinFileWriter.h"
+#include <assimp/AssbinMappedView.h>
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 using namespace Assimp;
 
 #ifndef ASSIMP_BUILD_NO_EXPORT
@@ -66,4 +75,145 @@ TEST_F(utAssbinImportExport, import3ExportAssbinDFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+TEST_F(utAssbinImportExport, exportMappableAssbinTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_ASSBIN_MAPPABLE, true);
+    Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "assbin", ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped.assbin", 0u, &properties));
+
+    Importer mappedImporter;
+    const aiScene *mappedScene = mappedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped.assbin", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, mappedScene);
+    ASSERT_EQ(scene->mNumMeshes, mappedScene->mNumMeshes);
+    EXPECT_EQ(scene->mNumMaterials, mappedScene->mNumMaterials);
+
+    // the view resolves the same data straight from the file contents
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped.assbin", std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    AssbinMappedView view;
+    ASSERT_TRUE(view.Open(data.data(), data.size()));
+    ASSERT_EQ(scene->mNumMeshes, view.GetNumMeshes());
+
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        const aiMesh *mappedMesh = mappedScene->mMeshes[i];
+        const AssbinMappedMesh &record = view.GetMesh(i);
+        EXPECT_EQ(mesh->mName, mappedMesh->mName);
+        EXPECT_EQ(mesh->mMaterialIndex, mappedMesh->mMaterialIndex);
+        ASSERT_EQ(mesh->mNumVertices, mappedMesh->mNumVertices);
+        ASSERT_EQ(mesh->mNumFaces, mappedMesh->mNumFaces);
+        ASSERT_EQ(mesh->mNumVertices, record.mNumVertices);
+        EXPECT_EQ(0, memcmp(mesh->mVertices, mappedMesh->mVertices, mesh->mNumVertices * sizeof(aiVector3D)));
+        EXPECT_EQ(0, memcmp(mesh->mVertices, view.GetArray<aiVector3D>(record.mVertices), mesh->mNumVertices * sizeof(aiVector3D)));
+        EXPECT_EQ(mesh->HasNormals(), mappedMesh->HasNormals());
+        EXPECT_EQ(mesh->HasTextureCoords(0), mappedMesh->HasTextureCoords(0));
+
+        const uint32_t *offsets = view.GetArray<uint32_t>(record.mFaceOffsets);
+        const uint32_t *indices = view.GetArray<uint32_t>(record.mIndices);
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            const aiFace &face = mesh->mFaces[f];
+            ASSERT_EQ(face.mNumIndices, mappedMesh->mFaces[f].mNumIndices);
+            ASSERT_EQ(face.mNumIndices, offsets[f + 1] - offsets[f]);
+            for (unsigned int n = 0; n < face.mNumIndices; ++n) {
+                EXPECT_EQ(face.mIndices[n], mappedMesh->mFaces[f].mIndices[n]);
+                EXPECT_EQ(face.mIndices[n], indices[offsets[f] + n]);
+            }
+        }
+    }
+
+    // truncated and misaligned files are rejected
+    EXPECT_FALSE(view.Open(data.data(), data.size() / 2));
+    std::vector<char> shifted(data.size() + 1);
+    memcpy(shifted.data() + 1, data.data(), data.size());
+    EXPECT_FALSE(view.Open(shifted.data() + 1, data.size()));
+}
+
+TEST_F(utAssbinImportExport, importMappableAssbinBadFaceOffsetsTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_ASSBIN_MAPPABLE, true);
+    Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "assbin", ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped.assbin", 0u, &properties));
+
+    std::vector<char> data;
+    {
+        std::ifstream file(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped.assbin", std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    AssbinMappedView view;
+    ASSERT_TRUE(view.Open(data.data(), data.size()));
+    const AssbinMappedMesh &record = view.GetMesh(0);
+    ASSERT_LT(1u, record.mNumFaces);
+
+    // the first and last offsets still span the index buffer, but the second one points past it
+    const uint32_t badOffset = record.mNumIndices + 100;
+    memcpy(data.data() + record.mFaceOffsets + sizeof(uint32_t), &badOffset, sizeof(badOffset));
+    {
+        std::ofstream file(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped_bad.assbin", std::ios::binary);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    EXPECT_EQ(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider_mapped_bad.assbin", aiProcess_ValidateDataStructure));
+}
+
+TEST_F(utAssbinImportExport, exportChunkedCompressedAssbinTest) {
+    // large enough to span several compressed chunks
+    aiScene scene;
+    scene.mRootNode = new aiNode("root");
+    scene.mNumMaterials = 1;
+    scene.mMaterials = new aiMaterial *[1]{ new aiMaterial() };
+    scene.mNumMeshes = 1;
+    scene.mMeshes = new aiMesh *[1]{ new aiMesh() };
+    aiMesh *mesh = scene.mMeshes[0];
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mNumVertices = 150000;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        mesh->mVertices[i] = aiVector3D(static_cast<ai_real>(i), static_cast<ai_real>(i % 7), static_cast<ai_real>(i % 13));
+    }
+    mesh->mNumFaces = mesh->mNumVertices / 3;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        mesh->mFaces[i].mNumIndices = 3;
+        mesh->mFaces[i].mIndices = new unsigned int[3]{ 3 * i, 3 * i + 1, 3 * i + 2 };
+    }
+
+    DefaultIOSystem io;
+    DumpSceneToAssbin(ASSIMP_TEST_MODELS_DIR "/OBJ/chunked_out.assbin", "", &io, &scene, false, true);
+
+    Importer importer;
+    const aiScene *newScene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/chunked_out.assbin", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, newScene);
+    ASSERT_EQ(1u, newScene->mNumMeshes);
+    const aiMesh *newMesh = newScene->mMeshes[0];
+    ASSERT_EQ(mesh->mNumVertices, newMesh->mNumVertices);
+    ASSERT_EQ(mesh->mNumFaces, newMesh->mNumFaces);
+    EXPECT_EQ(0, memcmp(mesh->mVertices, newMesh->mVertices, mesh->mNumVertices * sizeof(aiVector3D)));
+    EXPECT_EQ(mesh->mNumFaces * 3 - 1, newMesh->mFaces[mesh->mNumFaces - 1].mIndices[2]);
+
+    // unknown compression methods are rejected instead of being read as plain zlib
+    std::vector<char> data;
+    {
+        std::ifstream file(ASSIMP_TEST_MODELS_DIR "/OBJ/chunked_out.assbin", std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    ASSERT_LT(64u, data.size());
+    uint32_t versionMinor = 0;
+    memcpy(&versionMinor, data.data() + 48, sizeof(versionMinor));
+    EXPECT_EQ(1u, versionMinor);
+    const uint16_t unknownCompression = 3;
+    memcpy(data.data() + 62, &unknownCompression, sizeof(unknownCompression));
+    {
+        std::ofstream file(ASSIMP_TEST_MODELS_DIR "/OBJ/chunked_bad.assbin", std::ios::binary);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    EXPECT_EQ(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/chunked_bad.assbin", aiProcess_ValidateDataStructure));
+}
+
 #endif // #ifndef ASSIMP_BUILD_NO_EXPORT
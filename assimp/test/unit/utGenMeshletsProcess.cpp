@@ -0,0 +1,138 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "TestModelFactory.h"
+
+#include "PostProcessing/GenMeshletsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utGenMeshletsProcess : public ::testing::Test {
+public:
+    // Checks that the meshlets hold every face exactly once
+    static void CheckCoverage(const aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles) {
+        ASSERT_TRUE(mesh->HasMeshlets());
+        const aiMeshletData *data = mesh->mMeshletData;
+        std::vector<unsigned int> seen(mesh->mNumFaces, 0);
+        unsigned int next = 0;
+        for (unsigned int i = 0; i < data->mNumMeshlets; ++i) {
+            const aiMeshlet &meshlet = data->mMeshlets[i];
+            ASSERT_LE(meshlet.mNumVertices, maxVertices);
+            ASSERT_LE(meshlet.mNumTriangles, maxTriangles);
+            ASSERT_GT(meshlet.mNumTriangles, 0u);
+            for (unsigned int t = 0; t < meshlet.mNumTriangles; ++t) {
+                unsigned int tri[3];
+                for (unsigned int b = 0; b < 3; ++b) {
+                    const unsigned char v = data->mTriangles[meshlet.mTriangleOffset + t * 3 + b];
+                    ASSERT_LT(v, meshlet.mNumVertices);
+                    tri[b] = data->mVertices[meshlet.mVertexOffset + v];
+
+                    // the bounding sphere holds all vertices
+                    EXPECT_LE((mesh->mVertices[tri[b]] - meshlet.mCenter).Length(), meshlet.mRadius * 1.001f + 1e-4f);
+                }
+
+                // find the face, it usually is one of the next ones. Faces
+                // may be duplicated, so each one can only be found once.
+                bool found = false;
+                for (unsigned int f = 0; f < mesh->mNumFaces && !found; ++f) {
+                    const unsigned int index = (next + f) % mesh->mNumFaces;
+                    const aiFace &face = mesh->mFaces[index];
+                    if (0 == seen[index] && face.mIndices[0] == tri[0] && face.mIndices[1] == tri[1] && face.mIndices[2] == tri[2]) {
+                        seen[index] = 1;
+                        next = index;
+                        found = true;
+                    }
+                }
+                ASSERT_TRUE(found);
+            }
+        }
+        EXPECT_EQ(mesh->mNumFaces, data->mNumTriangles);
+    }
+};
+
+TEST_F(utGenMeshletsProcess, buildGridTest) {
+    std::unique_ptr<aiMesh> mesh(TestModelFactory::createGridMesh(30));
+    GenMeshletsProcess::BuildMeshlets(mesh.get(), 64, 124);
+    CheckCoverage(mesh.get(), 64, 124);
+
+    // a flat grid gives tight normal cones pointing up
+    const aiMeshletData *data = mesh->mMeshletData;
+    EXPECT_LT(data->mNumMeshlets, mesh->mNumFaces / 60);
+    for (unsigned int i = 0; i < data->mNumMeshlets; ++i) {
+        const aiMeshlet &meshlet = data->mMeshlets[i];
+        EXPECT_NEAR(1.0f, meshlet.mConeAxis.z, 1e-4f);
+        EXPECT_LT(meshlet.mConeCutoff, 1e-3f);
+        EXPECT_LE(meshlet.mConeApex.z, 1e-4f);
+    }
+
+    // rebuilding with other limits replaces the meshlets
+    GenMeshletsProcess::BuildMeshlets(mesh.get(), 3, 1);
+    ASSERT_TRUE(mesh->HasMeshlets());
+    EXPECT_EQ(mesh->mNumFaces, mesh->mMeshletData->mNumMeshlets);
+    CheckCoverage(mesh.get(), 3, 1);
+}
+
+TEST_F(utGenMeshletsProcess, skipNonTrianglesTest) {
+    std::unique_ptr<aiMesh> mesh(TestModelFactory::createGridMesh(2));
+    delete[] mesh->mFaces[0].mIndices;
+    mesh->mFaces[0].mNumIndices = 2;
+    mesh->mFaces[0].mIndices = new unsigned int[2]{ 0, 1 };
+    GenMeshletsProcess::BuildMeshlets(mesh.get(), 64, 124);
+    EXPECT_FALSE(mesh->HasMeshlets());
+}
+
+TEST_F(utGenMeshletsProcess, importTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_ML_ENABLE, true);
+    importer.SetPropertyInteger(AI_CONFIG_PP_ML_MAX_VERTICES, 32);
+    importer.SetPropertyInteger(AI_CONFIG_PP_ML_MAX_TRIANGLES, 40);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        CheckCoverage(scene->mMeshes[i], 32, 40);
+    }
+}
@@ -41,6 +41,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include "PostProcessing/GenVertexNormalsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <map>
+#include <string>
+#include <tuple>
 
 using namespace ::std;
 using namespace ::Assimp;
@@ -84,3 +91,148 @@ TEST_F(GenNormalsTest, testSimpleTriangle) {
     piProcess->GenMeshVertexNormals(pcMesh, 0);
     EXPECT_TRUE(pcMesh->mNormals != nullptr);
 }
+
+// ------------------------------------------------------------------------------------------------
+// Two triangles meeting at a right angle, the edge is split into separate vertices
+static aiMesh *MakeCrease() {
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mNumVertices = 6;
+    mesh->mVertices = new aiVector3D[6];
+    mesh->mVertices[0] = aiVector3D(0, 0, 0);
+    mesh->mVertices[1] = aiVector3D(1, 0, 0);
+    mesh->mVertices[2] = aiVector3D(0, 1, 0);
+    mesh->mVertices[3] = aiVector3D(0, 0, 0);
+    mesh->mVertices[4] = aiVector3D(0, 1, 0);
+    mesh->mVertices[5] = aiVector3D(0, 0, 1);
+    mesh->mNumFaces = 2;
+    mesh->mFaces = new aiFace[2];
+    for (unsigned int f = 0; f < 2; ++f) {
+        mesh->mFaces[f].mIndices = new unsigned int[mesh->mFaces[f].mNumIndices = 3];
+        for (unsigned int i = 0; i < 3; ++i) {
+            mesh->mFaces[f].mIndices[i] = f * 3 + i;
+        }
+    }
+    return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(GenNormalsTest, testSmoothCrease) {
+    std::unique_ptr<aiMesh> mesh(MakeCrease());
+    ASSERT_TRUE(piProcess->GenMeshVertexNormals(mesh.get(), 0));
+
+    // the vertices on the edge share the smoothed normal, the others keep the face normal
+    const aiVector3D smooth = aiVector3D(1, 0, 1).Normalize();
+    for (unsigned int i : { 0, 2, 3, 4 }) {
+        EXPECT_NEAR(0.0f, (mesh->mNormals[i] - smooth).Length(), 1e-5f);
+    }
+    EXPECT_EQ(aiVector3D(0, 0, 1), mesh->mNormals[1]);
+    EXPECT_EQ(aiVector3D(1, 0, 0), mesh->mNormals[5]);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(GenNormalsTest, testSmoothingAngle) {
+    Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, 60.0f);
+    piProcess->SetupProperties(&importer);
+
+    // the faces meet at 90 degrees, so the edge stays sharp
+    std::unique_ptr<aiMesh> mesh(MakeCrease());
+    ASSERT_TRUE(piProcess->GenMeshVertexNormals(mesh.get(), 0));
+    for (unsigned int i = 0; i < 6; ++i) {
+        EXPECT_EQ(i < 3 ? aiVector3D(0, 0, 1) : aiVector3D(1, 0, 0), mesh->mNormals[i]);
+    }
+}
+
+namespace {
+
+// A bumpy grid with n * n quads as OBJ text. Every face corner becomes a vertex of
+// its own, so each grid point is a group of up to six vertices.
+std::string MakeGridObj(unsigned int n) {
+    std::string obj;
+    for (unsigned int y = 0; y <= n; ++y) {
+        for (unsigned int x = 0; x <= n; ++x) {
+            obj += "v " + std::to_string(x) + " " + std::to_string(y) + " " + std::to_string(((x * 7 + y * 3) % 5) * 0.3) + "\n";
+            obj += "vt " + std::to_string(double(x) / n) + " " + std::to_string(double(y) / n) + "\n";
+        }
+    }
+    for (unsigned int y = 0; y < n; ++y) {
+        for (unsigned int x = 0; x < n; ++x) {
+            const std::string a = std::to_string(y * (n + 1) + x + 1), b = std::to_string(y * (n + 1) + x + 2);
+            const std::string c = std::to_string((y + 1) * (n + 1) + x + 2), d = std::to_string((y + 1) * (n + 1) + x + 1);
+            obj += "f " + a + "/" + a + " " + b + "/" + b + " " + c + "/" + c + "\n";
+            obj += "f " + a + "/" + a + " " + c + "/" + c + " " + d + "/" + d + "\n";
+        }
+    }
+    return obj;
+}
+
+// Compares the vertex streams of two imports bit by bit
+void ExpectSameTangentSpace(const aiMesh *expected, const aiMesh *mesh) {
+    ASSERT_EQ(expected->mNumVertices, mesh->mNumVertices);
+    ASSERT_NE(nullptr, mesh->mNormals);
+    ASSERT_NE(nullptr, mesh->mTangents);
+    ASSERT_NE(nullptr, mesh->mBitangents);
+    EXPECT_EQ(0, memcmp(expected->mNormals, mesh->mNormals, mesh->mNumVertices * sizeof(aiVector3D)));
+    EXPECT_EQ(0, memcmp(expected->mTangents, mesh->mTangents, mesh->mNumVertices * sizeof(aiVector3D)));
+    EXPECT_EQ(0, memcmp(expected->mBitangents, mesh->mBitangents, mesh->mNumVertices * sizeof(aiVector3D)));
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(GenNormalsTest, testImportManyGroups) {
+    // 49 * 49 grid points give more vertex groups than one parallel block of 1024 holds
+    const std::string obj = MakeGridObj(48);
+    for (const float angle : { 175.0f, 30.0f }) {
+        // both steps share the adjacency of the AI_SPP_VERTEX_ADJACENCY cache
+        Importer importer;
+        importer.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, angle);
+        const aiScene *scene = importer.ReadFileFromMemory(obj.data(), obj.size(), aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace, "obj");
+        ASSERT_NE(nullptr, scene);
+        ASSERT_EQ(1u, scene->mNumMeshes);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_EQ(48u * 48u * 2u, mesh->mNumFaces);
+        ASSERT_EQ(mesh->mNumFaces * 3, mesh->mNumVertices);
+
+        // the reference computes the tangents in a second pass, with an adjacency of their own
+        Importer reference;
+        reference.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, angle);
+        ASSERT_NE(nullptr, reference.ReadFileFromMemory(obj.data(), obj.size(), aiProcess_GenSmoothNormals, "obj"));
+        const aiScene *expected = reference.ApplyPostProcessing(aiProcess_CalcTangentSpace);
+        ASSERT_NE(nullptr, expected);
+        ExpectSameTangentSpace(expected->mMeshes[0], mesh);
+
+        // the groups may be scheduled differently, the result must not change
+        Importer again;
+        again.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, angle);
+        const aiScene *second = again.ReadFileFromMemory(obj.data(), obj.size(), aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace, "obj");
+        ASSERT_NE(nullptr, second);
+        ExpectSameTangentSpace(mesh, second->mMeshes[0]);
+
+        // without an angle limit, each normal is the mean of the face normals at its position
+        if (angle < 175.0f) {
+            continue;
+        }
+        std::map<std::tuple<ai_real, ai_real, ai_real>, aiVector3D> sums;
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            const aiFace &face = mesh->mFaces[f];
+            const aiVector3D &a = mesh->mVertices[face.mIndices[0]];
+            const aiVector3D normal = ((mesh->mVertices[face.mIndices[1]] - a) ^ (mesh->mVertices[face.mIndices[2]] - a)).NormalizeSafe();
+            for (unsigned int i = 0; i < 3; ++i) {
+                const aiVector3D &v = mesh->mVertices[face.mIndices[i]];
+                sums[std::make_tuple(v.x, v.y, v.z)] += normal;
+            }
+        }
+        EXPECT_EQ(49u * 49u, sums.size());
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const aiVector3D &v = mesh->mVertices[i];
+            const aiVector3D normal = sums[std::make_tuple(v.x, v.y, v.z)].NormalizeSafe();
+            EXPECT_NEAR(normal.x, mesh->mNormals[i].x, 1e-5);
+            EXPECT_NEAR(normal.y, mesh->mNormals[i].y, 1e-5);
+            EXPECT_NEAR(normal.z, mesh->mNormals[i].z, 1e-5);
+            EXPECT_NEAR(0, mesh->mNormals[i] * mesh->mTangents[i], 1e-4);
+            EXPECT_LT(0, mesh->mTangents[i].x);
+        }
+    }
+}
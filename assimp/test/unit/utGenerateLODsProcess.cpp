@@ -0,0 +1,168 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "TestModelFactory.h"
+
+#include "PostProcessing/GenerateLODsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/commonMetaData.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace Assimp;
+
+class utGenerateLODsProcess : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utGenerateLODsProcess, simplifyGridTest) {
+    std::unique_ptr<aiMesh> mesh(TestModelFactory::createGridMesh(20, ai_real(0.001)));
+    std::unique_ptr<aiMesh> lod(GenerateLODsProcess::SimplifyMesh(mesh.get(), 200));
+    ASSERT_NE(nullptr, lod);
+    EXPECT_LE(lod->mNumFaces, 200u);
+    EXPECT_GT(lod->mNumFaces, 0u);
+    EXPECT_LT(lod->mNumVertices, mesh->mNumVertices);
+    ASSERT_TRUE(lod->HasTextureCoords(0));
+
+    // all vertices come from the source mesh and the corners stay
+    unsigned int corners = 0;
+    for (unsigned int i = 0; i < lod->mNumVertices; ++i) {
+        const aiVector3D &v = lod->mVertices[i];
+        const unsigned int x = static_cast<unsigned int>(v.x), y = static_cast<unsigned int>(v.y);
+        ASSERT_EQ(mesh->mVertices[y * 21 + x], v);
+        EXPECT_EQ(mesh->mTextureCoords[0][y * 21 + x], lod->mTextureCoords[0][i]);
+        if ((0 == x || 20 == x) && (0 == y || 20 == y)) {
+            ++corners;
+        }
+    }
+    EXPECT_EQ(4u, corners);
+
+    // the faces keep their orientation
+    for (unsigned int i = 0; i < lod->mNumFaces; ++i) {
+        const aiFace &face = lod->mFaces[i];
+        ASSERT_EQ(3u, face.mNumIndices);
+        const aiVector3D &a = lod->mVertices[face.mIndices[0]];
+        const aiVector3D n = (lod->mVertices[face.mIndices[1]] - a) ^ (lod->mVertices[face.mIndices[2]] - a);
+        EXPECT_GT(n.z, 0);
+    }
+}
+
+TEST_F(utGenerateLODsProcess, keepSeamTest) {
+    std::unique_ptr<aiMesh> mesh(TestModelFactory::createGridMesh(20, ai_real(0.001), true));
+    std::unique_ptr<aiMesh> lod(GenerateLODsProcess::SimplifyMesh(mesh.get(), 200));
+    ASSERT_NE(nullptr, lod);
+    EXPECT_LT(lod->mNumFaces, mesh->mNumFaces);
+
+    // both sides of the seam keep all of their vertices
+    unsigned int left = 0, right = 0;
+    for (unsigned int i = 0; i < lod->mNumVertices; ++i) {
+        if (lod->mVertices[i].x == 10) {
+            ++(lod->mTextureCoords[0][i].x == 1 ? right : left);
+        }
+    }
+    EXPECT_EQ(21u, left);
+    EXPECT_EQ(21u, right);
+}
+
+TEST_F(utGenerateLODsProcess, boundingBoxTest) {
+    std::unique_ptr<aiMesh> mesh(TestModelFactory::createGridMesh(20, ai_real(0.1)));
+    mesh->mAABB = aiAABB(aiVector3D(0, 0, 0), aiVector3D(20, 20, ai_real(0.4)));
+    std::unique_ptr<aiMesh> lod(GenerateLODsProcess::SimplifyMesh(mesh.get(), 200));
+    ASSERT_NE(nullptr, lod);
+    ASSERT_LT(0u, lod->mNumVertices);
+
+    // the box is per axis, the corner with the largest x and y does not have the largest z
+    aiVector3D min = lod->mVertices[0], max = lod->mVertices[0];
+    for (unsigned int i = 1; i < lod->mNumVertices; ++i) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            min[k] = std::min(min[k], lod->mVertices[i][k]);
+            max[k] = std::max(max[k], lod->mVertices[i][k]);
+        }
+    }
+    EXPECT_LT(0, max.z);
+    EXPECT_EQ(min, lod->mAABB.mMin);
+    EXPECT_EQ(max, lod->mAABB.mMax);
+}
+
+TEST_F(utGenerateLODsProcess, importTest) {
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_LOD_LEVELS, 3);
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ValidateDataStructure;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, scene);
+
+    Importer reference;
+    const aiScene *plain = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, plain);
+    ASSERT_GT(scene->mNumMeshes, plain->mNumMeshes);
+
+    // every node links the levels of its meshes
+    unsigned int links = 0;
+    std::vector<const aiNode *> nodes = { scene->mRootNode };
+    while (!nodes.empty()) {
+        const aiNode *node = nodes.back();
+        nodes.pop_back();
+        nodes.insert(nodes.end(), node->mChildren, node->mChildren + node->mNumChildren);
+        for (unsigned int a = 0; a < node->mNumMeshes; ++a) {
+            const unsigned int source = node->mMeshes[a];
+            ASSERT_LT(source, plain->mNumMeshes);
+            unsigned int faces = scene->mMeshes[source]->mNumFaces;
+            for (unsigned int level = 1; level <= 3; ++level) {
+                uint32_t index = 0;
+                const std::string key = AI_METADATA_LOD_PREFIX + std::to_string(level) + "_" + std::to_string(source);
+                if (nullptr == node->mMetaData || !node->mMetaData->Get(key, index)) {
+                    break;
+                }
+                ASSERT_GE(index, plain->mNumMeshes);
+                ASSERT_LT(index, scene->mNumMeshes);
+                const aiMesh *lod = scene->mMeshes[index];
+                EXPECT_LT(lod->mNumFaces, faces);
+                EXPECT_EQ(scene->mMeshes[source]->mMaterialIndex, lod->mMaterialIndex);
+                faces = lod->mNumFaces;
+                ++links;
+            }
+        }
+    }
+    EXPECT_EQ(scene->mNumMeshes - plain->mNumMeshes, links);
+}
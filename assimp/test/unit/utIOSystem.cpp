@@ -42,9 +42,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 #include "TestIOSystem.h"
+#include "Common/HeaderCacheIOSystem.h"
 
+#include <assimp/BaseImporter.h>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/IOSystem.hpp>
 
+#include <memory>
+
 using namespace std;
 using namespace Assimp;
 
@@ -77,3 +82,63 @@ TEST_F( IOSystemTest, accessDirectoryStackTest ) {
 TEST_F( IOSystemTest, delFileTest ) {
     EXPECT_FALSE( pImp->DeleteFile( "none" ) );
 }
+
+namespace {
+
+class CountingIOSystem : public IOSystem {
+public:
+    bool Exists(const char *pFile) const override {
+        return mIO.Exists(pFile);
+    }
+
+    char getOsSeparator() const override {
+        return mIO.getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        ++mOpens;
+        return mIO.Open(pFile, pMode);
+    }
+
+    void Close(IOStream *pFile) override {
+        mIO.Close(pFile);
+    }
+
+    DefaultIOSystem mIO;
+    unsigned int mOpens = 0;
+};
+
+} // namespace
+
+TEST_F( IOSystemTest, headerCacheTest ) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj";
+    CountingIOSystem counting;
+    std::unique_ptr<IOStream> direct(counting.Open(file));
+    ASSERT_NE(nullptr, direct);
+    std::vector<char> content(direct->FileSize());
+    ASSERT_EQ(content.size(), direct->Read(content.data(), 1, content.size()));
+    direct.reset();
+    counting.mOpens = 0;
+
+    HeaderCacheIOSystem io(&counting, file, 16);
+    EXPECT_TRUE(io.IsValid());
+    EXPECT_EQ(content.size(), io.GetFileSize());
+    EXPECT_EQ(1u, counting.mOpens);
+
+    // header reads don't touch the file again
+    const char *tokens[] = { "box" };
+    BaseImporter::SearchFileHeaderForToken(&io, file, tokens, 1, 16);
+    std::unique_ptr<IOStream> stream(io.Open(file));
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(content.size(), stream->FileSize());
+    char buffer[32];
+    ASSERT_EQ(16u, stream->Read(buffer, 1, 16));
+    EXPECT_EQ(0, memcmp(buffer, content.data(), 16));
+    EXPECT_EQ(1u, counting.mOpens);
+
+    // reading past the header falls back to the file
+    ASSERT_EQ(32u, stream->Read(buffer, 1, 32));
+    EXPECT_EQ(0, memcmp(buffer, content.data() + 16, 32));
+    EXPECT_EQ(2u, counting.mOpens);
+    EXPECT_EQ(48u, stream->Tell());
+}
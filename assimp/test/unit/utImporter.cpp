@@ -46,6 +46,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
+#include <assimp/ProgressHandler.hpp>
+#include <assimp/SceneCombiner.h>
+#include "Common/CancelToken.h"
+
+#include <chrono>
+#include <thread>
 
 using namespace ::std;
 using namespace ::Assimp;
@@ -244,6 +250,28 @@ TEST_F(ImporterTest, testExtensionCheck) {
     // TODO
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testLazyImporters) {
+    const size_t objIndex = pImp->GetImporterIndex(".obj");
+    ASSERT_NE(static_cast<size_t>(-1), objIndex);
+    ASSERT_NE(nullptr, pImp->GetImporterInfo(objIndex));
+
+    BaseImporter *obj = pImp->GetImporter(objIndex);
+    ASSERT_NE(nullptr, obj);
+    EXPECT_EQ(obj, pImp->GetImporter(objIndex));
+    EXPECT_EQ(obj, pImp->GetImporter("obj"));
+
+    // unregistering a built-in importer must not shift the others
+    BaseImporter *x = pImp->GetImporter(".x");
+    ASSERT_NE(nullptr, x);
+    EXPECT_EQ(AI_SUCCESS, pImp->UnregisterLoader(x));
+    delete x;
+    EXPECT_FALSE(pImp->IsExtensionSupported(".x"));
+    EXPECT_EQ(obj, pImp->GetImporter(".obj"));
+    EXPECT_TRUE(pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_ValidateDataStructure));
+    EXPECT_EQ(nullptr, pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/test.x", aiProcess_ValidateDataStructure));
+}
+
 // ------------------------------------------------------------------------------------------------
 TEST_F(ImporterTest, testMultipleReads) {
     // see http://sourceforge.net/projects/assimp/forums/forum/817654/topic/3591099
@@ -275,6 +303,212 @@ TEST_F(ImporterTest, testMultipleReads) {
     //EXPECT_TRUE(pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/dwarf.x",flags)); # is in nonbsd
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testMeshBuffersLifetime) {
+    pImp->SetPropertyBool(AI_CONFIG_PP_PI_ENABLE, true);
+    pImp->SetPropertyBool(AI_CONFIG_PP_ML_ENABLE, true);
+    pImp->SetPropertyBool(AI_CONFIG_PP_QV_ENABLE, true);
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        EXPECT_TRUE(mesh->HasIndexBuffer());
+        EXPECT_TRUE(mesh->HasMeshlets());
+        ASSERT_TRUE(mesh->HasQuantizedVertices());
+        EXPECT_EQ(mesh->mNumVertices, mesh->mQuantizedVertices->mNumVertices);
+    }
+
+    // copies get their own index buffers, meshlets and quantized streams
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene);
+    ASSERT_NE(nullptr, copy);
+    for (unsigned int i = 0; i < copy->mNumMeshes; ++i) {
+        const aiMesh *a = scene->mMeshes[i], *b = copy->mMeshes[i];
+        ASSERT_TRUE(b->HasIndexBuffer());
+        EXPECT_NE(a->mIndices, b->mIndices);
+        EXPECT_EQ(0, memcmp(a->mIndices, b->mIndices, a->mNumIndices * sizeof(unsigned int)));
+        ASSERT_TRUE(b->HasMeshlets());
+        EXPECT_EQ(a->mMeshletData->mNumMeshlets, b->mMeshletData->mNumMeshlets);
+        ASSERT_TRUE(b->HasQuantizedVertices());
+        EXPECT_NE(a->mQuantizedVertices->mPositions, b->mQuantizedVertices->mPositions);
+        EXPECT_EQ(0, memcmp(a->mQuantizedVertices->mPositions, b->mQuantizedVertices->mPositions, a->mNumVertices * 3 * sizeof(unsigned short)));
+    }
+    delete copy;
+
+    // further post-processing without the properties drops all of them
+    pImp->SetPropertyBool(AI_CONFIG_PP_PI_ENABLE, false);
+    pImp->SetPropertyBool(AI_CONFIG_PP_ML_ENABLE, false);
+    pImp->SetPropertyBool(AI_CONFIG_PP_QV_ENABLE, false);
+    scene = pImp->ApplyPostProcessing(aiProcess_FlipUVs);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        EXPECT_FALSE(mesh->HasIndexBuffer());
+        EXPECT_FALSE(mesh->HasMeshlets());
+        EXPECT_FALSE(mesh->HasQuantizedVertices());
+    }
+}
+
+namespace {
+
+// Cancels the import once the file has been read or once post-processing starts
+class CancellingProgressHandler : public ProgressHandler {
+public:
+    enum Stage {
+        None,
+        FileRead,
+        PostProcess
+    };
+
+    CancellingProgressHandler(Importer *imp) :
+            mImp(imp), mStage(None) {}
+
+    bool Update(float) override {
+        return true;
+    }
+
+    void UpdateFileRead(int, int) override {
+        if (mStage == FileRead) {
+            mImp->Cancel();
+        }
+    }
+
+    void UpdatePostProcess(int, int) override {
+        if (mStage == PostProcess) {
+            mImp->Cancel();
+        }
+    }
+
+    Importer *mImp;
+    Stage mStage;
+};
+
+} // namespace
+
+TEST_F(ImporterTest, testCancelToken) {
+    CancelToken token;
+    EXPECT_FALSE(token.IsCancelled());
+    token.Cancel();
+    EXPECT_TRUE(token.IsCancelled());
+    EXPECT_THROW(token.Check(), DeadlyImportError);
+
+    token.Reset(0);
+    EXPECT_FALSE(token.IsCancelled());
+    EXPECT_NO_THROW(token.Check());
+
+    token.Reset(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_TRUE(token.IsCancelled());
+    EXPECT_NO_THROW(token.Check(1));
+    EXPECT_THROW(token.Check(CancelToken::CheckInterval), DeadlyImportError);
+}
+
+TEST_F(ImporterTest, testCancelImport) {
+    // the importer takes ownership of the handler
+    CancellingProgressHandler *handler = new CancellingProgressHandler(pImp);
+    pImp->SetProgressHandler(handler);
+
+    handler->mStage = CancellingProgressHandler::FileRead;
+    EXPECT_EQ(nullptr, pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", 0));
+    EXPECT_STREQ("Import cancelled", pImp->GetErrorString());
+
+    handler->mStage = CancellingProgressHandler::PostProcess;
+    EXPECT_EQ(nullptr, pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenSmoothNormals));
+    EXPECT_STREQ("Import cancelled", pImp->GetErrorString());
+
+    // a fresh import starts with a cleared token
+    handler->mStage = CancellingProgressHandler::None;
+    EXPECT_NE(nullptr, pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_GenSmoothNormals));
+}
+
+namespace {
+
+// Records the streamed meshes and whether post-processing had started at that time
+class MeshRecordingProgressHandler : public ProgressHandler {
+public:
+    bool Update(float) override {
+        return true;
+    }
+
+    void UpdatePostProcess(int, int) override {
+        mPostProcessing = true;
+    }
+
+    void MeshReady(unsigned int meshIndex, const aiMesh *mesh) override {
+        mIndices.push_back(meshIndex);
+        mEarly.push_back(!mPostProcessing);
+        mTriangulated.push_back(mesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE && nullptr != mesh->mNormals);
+    }
+
+    bool mPostProcessing = false;
+    std::vector<unsigned int> mIndices;
+    std::vector<bool> mEarly;
+    std::vector<bool> mTriangulated;
+};
+
+} // namespace
+
+TEST_F(ImporterTest, testMeshStreaming) {
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace;
+    Importer reference;
+    const aiScene *expected = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+
+    // the importer takes ownership of the handler
+    MeshRecordingProgressHandler *handler = new MeshRecordingProgressHandler;
+    pImp->SetProgressHandler(handler);
+    pImp->SetPropertyBool(AI_CONFIG_IMPORT_MESH_STREAMING, true);
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    ASSERT_EQ(scene->mNumMeshes, handler->mIndices.size());
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(i, handler->mIndices[i]);
+        EXPECT_TRUE(handler->mEarly[i]);
+        EXPECT_TRUE(handler->mTriangulated[i]);
+
+        // streaming must not change the result
+        const aiMesh *a = expected->mMeshes[i], *b = scene->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ASSERT_NE(nullptr, b->mTangents);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mNormals[v], b->mNormals[v]);
+            EXPECT_EQ(a->mTangents[v], b->mTangents[v]);
+            EXPECT_EQ(a->mTextureCoords[0][v], b->mTextureCoords[0][v]);
+        }
+    }
+
+    // a step that needs the whole scene still gets the callbacks, just late
+    handler->mPostProcessing = false;
+    handler->mIndices.clear();
+    handler->mEarly.clear();
+    handler->mTriangulated.clear();
+    scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags | aiProcess_SortByPType);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(scene->mNumMeshes, handler->mIndices.size());
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_FALSE(handler->mEarly[i]);
+        EXPECT_TRUE(handler->mTriangulated[i]);
+    }
+
+    // so does a step enabled by a property, the meshes are handed out with their index buffers
+    handler->mPostProcessing = false;
+    handler->mIndices.clear();
+    handler->mEarly.clear();
+    handler->mTriangulated.clear();
+    pImp->SetPropertyBool(AI_CONFIG_PP_PI_ENABLE, true);
+    scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(scene->mNumMeshes, handler->mIndices.size());
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(i, handler->mIndices[i]);
+        EXPECT_FALSE(handler->mEarly[i]);
+        EXPECT_TRUE(handler->mTriangulated[i]);
+        EXPECT_TRUE(scene->mMeshes[i]->HasIndexBuffer());
+    }
+}
+
 TEST_F(ImporterTest, SearchFileHeaderForTokenTest) {
     //DefaultIOSystem ioSystem;
     //    BaseImporter::SearchFileHeaderForToken( &ioSystem, assetPath, Token, 2 )
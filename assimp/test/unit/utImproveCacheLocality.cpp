@@ -40,3 +40,165 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+
+#include "PostProcessing/ImproveCacheLocality.h"
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Assimp;
+
+class utImproveCacheLocality : public ::testing::Test {
+public:
+    utImproveCacheLocality() :
+            Test(), mProcess(nullptr), mMesh(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    void SetUp() override {
+        mProcess = new ImproveCacheLocalityProcess;
+
+        // a regular grid whose triangles are shuffled, the normals mirror the positions
+        // to check that the vertex arrays stay in sync
+        const unsigned int size = 24;
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = (size + 1) * (size + 1);
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNormals = new aiVector3D[mMesh->mNumVertices];
+        for (unsigned int y = 0; y <= size; ++y) {
+            for (unsigned int x = 0; x <= size; ++x) {
+                mMesh->mVertices[y * (size + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 0.f);
+                mMesh->mNormals[y * (size + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 0.f);
+            }
+        }
+
+        std::vector<std::array<unsigned int, 3>> triangles;
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                const unsigned int i = y * (size + 1) + x;
+                triangles.push_back({ { i, i + 1, i + size + 2 } });
+                triangles.push_back({ { i, i + size + 2, i + size + 1 } });
+            }
+        }
+        unsigned int seed = 12345;
+        for (size_t i = triangles.size() - 1; i > 0; --i) {
+            seed = seed * 1103515245u + 12345u;
+            std::swap(triangles[i], triangles[(seed >> 8) % (i + 1)]);
+        }
+
+        mMesh->mNumFaces = (unsigned int)triangles.size();
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            mMesh->mFaces[f].mNumIndices = 3;
+            mMesh->mFaces[f].mIndices = new unsigned int[3];
+            std::copy(triangles[f].begin(), triangles[f].end(), mMesh->mFaces[f].mIndices);
+        }
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+protected:
+    // cache misses per triangle for a FIFO cache
+    float ComputeACMR() const {
+        std::vector<unsigned int> cache;
+        unsigned int misses = 0;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < 3; ++i) {
+                const unsigned int idx = mMesh->mFaces[f].mIndices[i];
+                if (std::find(cache.begin(), cache.end(), idx) == cache.end()) {
+                    ++misses;
+                    cache.push_back(idx);
+                    if (cache.size() > PP_ICL_PTCACHE_SIZE) {
+                        cache.erase(cache.begin());
+                    }
+                }
+            }
+        }
+        return (float)misses / mMesh->mNumFaces;
+    }
+
+    // the triangles as positions, rotated to start at the smallest position to keep the winding
+    std::vector<std::array<float, 9>> GetTriangles() const {
+        std::vector<std::array<float, 9>> triangles;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            const unsigned int *idx = mMesh->mFaces[f].mIndices;
+            std::array<float, 9> triangle, rotated;
+            for (unsigned int i = 0; i < 3; ++i) {
+                const aiVector3D &v = mMesh->mVertices[idx[i]];
+                triangle[i * 3] = v.x;
+                triangle[i * 3 + 1] = v.y;
+                triangle[i * 3 + 2] = v.z;
+            }
+            for (unsigned int first = 0; first < 3; ++first) {
+                std::rotate_copy(triangle.begin(), triangle.begin() + first * 3, triangle.end(), rotated.begin());
+                if (first == 0 || rotated < triangles.back()) {
+                    if (first != 0) {
+                        triangles.pop_back();
+                    }
+                    triangles.push_back(rotated);
+                }
+            }
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    ImproveCacheLocalityProcess *mProcess;
+    aiMesh *mMesh;
+    aiScene *mScene;
+};
+
+TEST_F(utImproveCacheLocality, forsythReducesACMRTest) {
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, AI_ICL_ALGORITHM_FORSYTH);
+    mProcess->SetupProperties(&importer);
+
+    const float inputACMR = ComputeACMR();
+    const std::vector<std::array<float, 9>> inputTriangles = GetTriangles();
+    mProcess->Execute(mScene);
+
+    EXPECT_LT(ComputeACMR(), inputACMR * 0.5f);
+    EXPECT_EQ(inputTriangles, GetTriangles());
+}
+
+TEST_F(utImproveCacheLocality, overdrawAndVertexFetchTest) {
+    Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 1.05f);
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_REORDER_VERTICES, true);
+    mProcess->SetupProperties(&importer);
+
+    const std::vector<std::array<float, 9>> inputTriangles = GetTriangles();
+    mProcess->Execute(mScene);
+
+    EXPECT_EQ(inputTriangles, GetTriangles());
+
+    // vertices are numbered by first use and the attributes moved along
+    unsigned int next = 0;
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int idx = mMesh->mFaces[f].mIndices[i];
+            EXPECT_LE(idx, next);
+            if (idx == next) {
+                ++next;
+            }
+        }
+    }
+    EXPECT_EQ(mMesh->mNumVertices, next);
+    for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+        EXPECT_EQ(mMesh->mVertices[v], mMesh->mNormals[v]);
+    }
+}
@@ -40,7 +40,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 
+#include <assimp/config.h>
 #include <assimp/scene.h>
+#include <assimp/Importer.hpp>
 
 #include "PostProcessing/JoinVerticesProcess.h"
 
@@ -140,3 +142,27 @@ TEST_F(utJoinVertices, testProcess) {
     }
     EXPECT_EQ(150.f * 299.f * 3.f, fSum); // gaussian sum equation
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testProcessExactMatch) {
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_JIV_EXACT_MATCH, true);
+    piProcess->SetupProperties(&importer);
+
+    // a signed zero still matches, a tiny offset does not
+    pcMesh->mVertices[300] = aiVector3D(-0.f, 0.f, 0.f);
+    pcMesh->mVertices[899].x += 1e-3f;
+
+    piProcess->ProcessMesh(pcMesh, 0);
+
+    ASSERT_EQ(300U, pcMesh->mNumFaces);
+    ASSERT_EQ(301U, pcMesh->mNumVertices);
+
+    // vertices keep the order of their first appearance
+    for (unsigned int i = 0; i < 300; ++i) {
+        EXPECT_EQ(aiVector3D((float)i), pcMesh->mVertices[i]);
+    }
+    EXPECT_EQ(300U, pcMesh->mFaces[299].mIndices[2]);
+    EXPECT_EQ(0U, pcMesh->mFaces[100].mIndices[0]);
+    EXPECT_EQ(299U, pcMesh->mFaces[199].mIndices[2]);
+}
@@ -0,0 +1,200 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/AnimationEvaluator.h>
+#include <assimp/CreateAnimMesh.h>
+#include <assimp/MeshDeformer.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utMeshDeformer : public ::testing::Test {
+public:
+    // three vertices on the x axis, the first one bound to bone 0, the
+    // last one to bone 1 and the middle one to both
+    static aiMesh *MakeMesh() {
+        aiMesh *mesh = new aiMesh();
+        mesh->mNumVertices = 3;
+        mesh->mVertices = new aiVector3D[3];
+        mesh->mNormals = new aiVector3D[3];
+        for (unsigned int i = 0; i < 3; ++i) {
+            mesh->mVertices[i] = aiVector3D(ai_real(i), 0, 0);
+            mesh->mNormals[i] = aiVector3D(0, 1, 0);
+        }
+
+        const aiVertexWeight weights[2][2] = { { { 0, 1.0f }, { 1, 0.5f } }, { { 1, 0.5f }, { 2, 1.0f } } };
+        mesh->mNumBones = 2;
+        mesh->mBones = new aiBone *[2];
+        for (unsigned int b = 0; b < 2; ++b) {
+            aiBone *bone = mesh->mBones[b] = new aiBone();
+            bone->mName.Set(b ? "b1" : "b0");
+            bone->mNumWeights = 2;
+            bone->mWeights = new aiVertexWeight[2];
+            std::copy(weights[b], weights[b] + 2, bone->mWeights);
+        }
+        return mesh;
+    }
+};
+
+TEST_F(utMeshDeformer, influencesTest) {
+    std::unique_ptr<aiMesh> mesh(MakeMesh());
+    // a third, weaker bone on the middle vertex is dropped
+    aiBone *bones[3] = { mesh->mBones[0], mesh->mBones[1], new aiBone() };
+    bones[2]->mNumWeights = 1;
+    bones[2]->mWeights = new aiVertexWeight[1];
+    bones[2]->mWeights[0] = aiVertexWeight(1, 0.25f);
+    delete[] mesh->mBones;
+    mesh->mBones = new aiBone *[3];
+    std::copy(bones, bones + 3, mesh->mBones);
+    mesh->mNumBones = 3;
+
+    MeshDeformer deformer(mesh.get(), 2);
+    ASSERT_EQ(2u, deformer.GetNumInfluences());
+    const unsigned int *indices = deformer.GetBoneIndices();
+    const float *weights = deformer.GetBoneWeights();
+    EXPECT_EQ(0u, indices[0]);
+    EXPECT_FLOAT_EQ(1.0f, weights[0]);
+    EXPECT_FLOAT_EQ(0.0f, weights[1]);
+    EXPECT_FLOAT_EQ(1.0f, weights[2] + weights[3]);
+    EXPECT_FLOAT_EQ(0.5f, weights[2]);
+    EXPECT_EQ(1u, indices[3]);
+
+    // with a single influence the strongest bone takes it all
+    MeshDeformer single(mesh.get(), 1);
+    EXPECT_EQ(1u, single.GetBoneIndices()[2]);
+    EXPECT_FLOAT_EQ(1.0f, single.GetBoneWeights()[1]);
+}
+
+TEST_F(utMeshDeformer, skinningTest) {
+    std::unique_ptr<aiMesh> mesh(MakeMesh());
+    MeshDeformer deformer(mesh.get());
+
+    // bone 1 turns a quarter around z
+    aiMatrix4x4 bones[2];
+    aiMatrix4x4::RotationZ(ai_real(AI_MATH_HALF_PI), bones[1]);
+    aiVector3D positions[3], normals[3];
+
+    deformer.Deform(bones, nullptr, MeshDeformer::LinearBlend, positions, normals);
+    EXPECT_EQ(aiVector3D(0, 0, 0), positions[0]);
+    EXPECT_NEAR(0.0f, positions[2].x, 1e-5f);
+    EXPECT_NEAR(2.0f, positions[2].y, 1e-5f);
+    EXPECT_NEAR(-1.0f, normals[2].x, 1e-5f);
+    // linear blending pulls the joint inwards
+    EXPECT_NEAR(0.5f, positions[1].x, 1e-5f);
+    EXPECT_NEAR(0.5f, positions[1].y, 1e-5f);
+    EXPECT_NEAR(1.0f, normals[1].Length(), 1e-5f);
+
+    // dual quaternions keep it on the circle
+    deformer.Deform(bones, nullptr, MeshDeformer::DualQuaternion, positions, normals);
+    EXPECT_NEAR(0.0f, positions[2].x, 1e-5f);
+    EXPECT_NEAR(2.0f, positions[2].y, 1e-5f);
+    EXPECT_NEAR(std::sqrt(0.5f), positions[1].x, 1e-5f);
+    EXPECT_NEAR(std::sqrt(0.5f), positions[1].y, 1e-5f);
+    EXPECT_NEAR(-std::sqrt(0.5f), normals[1].x, 1e-5f);
+
+    // translations survive the conversion
+    aiMatrix4x4::Translation(aiVector3D(0, 0, 3), bones[0]);
+    deformer.Deform(bones, nullptr, MeshDeformer::DualQuaternion, positions, nullptr);
+    EXPECT_NEAR(3.0f, positions[0].z, 1e-5f);
+}
+
+TEST_F(utMeshDeformer, morphTest) {
+    std::unique_ptr<aiMesh> mesh(MakeMesh());
+    mesh->mNumAnimMeshes = 1;
+    mesh->mAnimMeshes = new aiAnimMesh *[1];
+    aiAnimMesh *target = mesh->mAnimMeshes[0] = aiCreateAnimMesh(mesh.get());
+    for (unsigned int i = 0; i < 3; ++i) {
+        target->mVertices[i].z += 1;
+    }
+    target->mWeight = 0.5f;
+
+    MeshDeformer deformer(mesh.get());
+    aiVector3D positions[3];
+    deformer.Deform(nullptr, nullptr, MeshDeformer::LinearBlend, positions, nullptr);
+    EXPECT_EQ(aiVector3D(1, 0, 0.5f), positions[1]);
+
+    // the morph is applied before skinning
+    const float weight = 1.0f;
+    aiMatrix4x4 bones[2];
+    aiMatrix4x4::Translation(aiVector3D(1, 0, 0), bones[1]);
+    deformer.Deform(bones, &weight, MeshDeformer::LinearBlend, positions, nullptr);
+    EXPECT_EQ(aiVector3D(3, 0, 1), positions[2]);
+}
+
+TEST_F(utMeshDeformer, boneMatricesTest) {
+    std::unique_ptr<aiScene> scene(new aiScene());
+    scene->mRootNode = new aiNode("root");
+    aiNode *children[2] = { new aiNode("body"), new aiNode("b1") };
+    children[0]->mTransformation.a4 = 1;
+    children[1]->mTransformation.b4 = 2;
+    scene->mRootNode->addChildren(2, children);
+
+    // the offset matrix of b1 is its inverse bind pose in mesh space
+    std::unique_ptr<aiMesh> mesh(MakeMesh());
+    aiMatrix4x4::Translation(aiVector3D(1, -2, 0), mesh->mBones[1]->mOffsetMatrix);
+
+    AnimationEvaluator evaluator(scene.get(), nullptr);
+    evaluator.Evaluate(0.0);
+    MeshDeformer deformer(mesh.get());
+    aiMatrix4x4 bones[2];
+    deformer.ComputeBoneMatrices(evaluator, evaluator.FindNode("body"), bones);
+    // b0 has no node, b1 is in its bind pose
+    EXPECT_TRUE(bones[0].IsIdentity());
+    EXPECT_TRUE(bones[1].IsIdentity());
+
+    // bound nodes give the same matrices, for every evaluator of the scene
+    children[1]->mTransformation.a4 = 3;
+    AnimationEvaluator other(scene.get(), nullptr);
+    other.Evaluate(0.0);
+    aiMatrix4x4 expected[2];
+    deformer.ComputeBoneMatrices(other, other.FindNode("body"), expected);
+    EXPECT_FALSE(expected[1].IsIdentity());
+    deformer.BindNodes(evaluator);
+    deformer.ComputeBoneMatrices(evaluator, evaluator.FindNode("body"), bones);
+    EXPECT_TRUE(bones[0].IsIdentity());
+    EXPECT_TRUE(bones[1].IsIdentity());
+    deformer.ComputeBoneMatrices(other, other.FindNode("body"), bones);
+    EXPECT_TRUE(bones[0].IsIdentity());
+    EXPECT_EQ(expected[1], bones[1]);
+}
@@ -42,6 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AssetLib/Obj/ObjTools.h"
 #include "UnitTestPCH.h"
 
+#include "Common/DefaultProgressHandler.h"
+#include <assimp/MemoryIOWrapper.h>
+
 using namespace ::Assimp;
 
 class utObjTools : public ::testing::Test {
@@ -66,6 +69,33 @@ public:
     }
 };
 
+// Parses an in-memory obj file and returns the faces of its only mesh
+static std::vector<std::vector<ObjFile::FaceIndex>> parseFaces(const std::string &data) {
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(data.c_str()), data.size());
+    IOStreamBuffer<char> streamBuffer;
+    streamBuffer.open(&stream);
+    DefaultProgressHandler progress;
+    ObjFileParser parser(streamBuffer, "test", nullptr, &progress, "test.obj");
+    streamBuffer.close();
+
+    std::vector<std::vector<ObjFile::FaceIndex>> faces;
+    const ObjFile::Model *model = parser.GetModel();
+    if (model->mMeshes.size() != 1) {
+        return faces;
+    }
+    const ObjFile::Mesh *mesh = model->mMeshes[0];
+    for (size_t i = 0; i < mesh->getNumFaces(); ++i) {
+        const ObjFile::FaceIndex *corners = mesh->getFaceIndices(i);
+        faces.emplace_back(corners, corners + mesh->getNumFaceIndices(i));
+    }
+    return faces;
+}
+
+static const char *ObjFaceHeader =
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+        "vt 0 0\nvt 1 0\nvt 1 1\n"
+        "vn 0 0 1\nvn 0 0 -1\n";
+
 TEST_F(utObjTools, skipDataLine_OneLine_Success) {
     std::vector<char> buffer;
     std::string data("v -0.5 -0.5 0.5\nend");
@@ -112,3 +142,41 @@ TEST_F(utObjTools, countComponents_TwoLines_Success) {
     size_t numComps = test_parser.testGetNumComponentsInDataDefinition();
     EXPECT_EQ(3U, numComps);
 }
+
+TEST_F(utObjTools, getFace_MixedFormats_Success) {
+    const unsigned int No = ObjFile::FaceIndex::NoIndex;
+    // v/vt, v//vn and negative v/vt/vn corners in one face
+    const auto faces = parseFaces(std::string(ObjFaceHeader) + "f 1/1 2//2 -1/-1/-1\n");
+    ASSERT_EQ(1u, faces.size());
+    ASSERT_EQ(3u, faces[0].size());
+    EXPECT_EQ(0u, faces[0][0].m_vertex);
+    EXPECT_EQ(0u, faces[0][0].m_texturCoord);
+    EXPECT_EQ(No, faces[0][0].m_normal);
+    EXPECT_EQ(1u, faces[0][1].m_vertex);
+    EXPECT_EQ(No, faces[0][1].m_texturCoord);
+    EXPECT_EQ(1u, faces[0][1].m_normal);
+    EXPECT_EQ(3u, faces[0][2].m_vertex);
+    EXPECT_EQ(2u, faces[0][2].m_texturCoord);
+    EXPECT_EQ(1u, faces[0][2].m_normal);
+}
+
+TEST_F(utObjTools, getFace_Malformed_Success) {
+    const unsigned int No = ObjFile::FaceIndex::NoIndex;
+    // the leading texture coordinate has no vertex and is dropped, the
+    // others stay with the corner they belong to
+    const auto faces = parseFaces(std::string(ObjFaceHeader) + "f /2 3 4/3 1//1\n");
+    ASSERT_EQ(1u, faces.size());
+    ASSERT_EQ(3u, faces[0].size());
+    EXPECT_EQ(2u, faces[0][0].m_vertex);
+    EXPECT_EQ(No, faces[0][0].m_texturCoord);
+    EXPECT_EQ(No, faces[0][0].m_normal);
+    EXPECT_EQ(3u, faces[0][1].m_vertex);
+    EXPECT_EQ(2u, faces[0][1].m_texturCoord);
+    EXPECT_EQ(No, faces[0][1].m_normal);
+    EXPECT_EQ(0u, faces[0][2].m_vertex);
+    EXPECT_EQ(No, faces[0][2].m_texturCoord);
+    EXPECT_EQ(0u, faces[0][2].m_normal);
+
+    // zero is not a valid obj index
+    EXPECT_THROW(parseFaces(std::string(ObjFaceHeader) + "f 1 0 2\n"), DeadlyImportError);
+}
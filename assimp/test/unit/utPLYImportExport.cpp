@@ -282,3 +282,70 @@ TEST_F(utPLYImportExport, parseInvalidDoubleCustomProperty) {
     const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+// Binary vertex and face records are decoded through a precompiled layout, check all channels and the byte order
+TEST_F(utPLYImportExport, importBinaryBigEndianWithNormalsAndColors) {
+    std::string data = "ply\n"
+                       "format binary_big_endian 1.0\n"
+                       "element vertex 3\n"
+                       "property float x\n"
+                       "property float y\n"
+                       "property float z\n"
+                       "property double nx\n"
+                       "property double ny\n"
+                       "property double nz\n"
+                       "property uchar red\n"
+                       "property uchar green\n"
+                       "property uchar blue\n"
+                       "element face 1\n"
+                       "property uchar flags\n"
+                       "property list uchar int vertex_indices\n"
+                       "end_header\n";
+
+    auto appendBE = [&data](const void *value, size_t size) {
+        const char *bytes = static_cast<const char *>(value);
+        for (size_t i = size; i > 0; --i) {
+            data.push_back(bytes[i - 1]);
+        }
+    };
+    for (int v = 0; v < 3; ++v) {
+        const float pos[3] = { 1.0f * v, 2.0f * v, -0.5f };
+        const double normal[3] = { 0.0, 0.0, 1.0 };
+        for (float f : pos) {
+            appendBE(&f, sizeof(f));
+        }
+        for (double d : normal) {
+            appendBE(&d, sizeof(d));
+        }
+        data.push_back(static_cast<char>(255));
+        data.push_back(0);
+        data.push_back(static_cast<char>(v == 2 ? 255 : 0));
+    }
+    data.push_back(7);
+    data.push_back(3);
+    for (int32_t i = 0; i < 3; ++i) {
+        appendBE(&i, sizeof(i));
+    }
+
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(3u, mesh->mNumVertices);
+    EXPECT_FLOAT_EQ(2.0f, mesh->mVertices[2].x);
+    EXPECT_FLOAT_EQ(4.0f, mesh->mVertices[2].y);
+    EXPECT_FLOAT_EQ(-0.5f, mesh->mVertices[2].z);
+    ASSERT_TRUE(mesh->HasNormals());
+    EXPECT_FLOAT_EQ(1.0f, mesh->mNormals[1].z);
+    ASSERT_TRUE(mesh->HasVertexColors(0));
+    EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][2].r);
+    EXPECT_FLOAT_EQ(0.0f, mesh->mColors[0][2].g);
+    EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][2].b);
+    EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][2].a);
+
+    ASSERT_EQ(1u, mesh->mNumFaces);
+    ASSERT_EQ(3u, mesh->mFaces[0].mNumIndices);
+    EXPECT_EQ(0u, mesh->mFaces[0].mIndices[0]);
+    EXPECT_EQ(1u, mesh->mFaces[0].mIndices[1]);
+    EXPECT_EQ(2u, mesh->mFaces[0].mIndices[2]);
+}
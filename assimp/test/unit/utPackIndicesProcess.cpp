@@ -0,0 +1,161 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/PackIndicesProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/SceneCombiner.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+using namespace Assimp;
+
+class utPackIndicesProcess : public ::testing::Test {
+public:
+    void SetUp() override {
+        // a quad, two triangles and a point
+        mMesh = new aiMesh();
+        mMesh->mNumVertices = 4;
+        mMesh->mVertices = new aiVector3D[4];
+        mMesh->mNumFaces = 4;
+        mMesh->mFaces = new aiFace[4];
+        const unsigned int sizes[] = { 4, 3, 3, 1 };
+        for (unsigned int i = 0; i < 4; ++i) {
+            aiFace &face = mMesh->mFaces[i];
+            face.mNumIndices = sizes[i];
+            face.mIndices = new unsigned int[sizes[i]];
+            for (unsigned int a = 0; a < sizes[i]; ++a) {
+                face.mIndices[a] = (i + a) % 4;
+            }
+        }
+    }
+
+    void TearDown() override {
+        delete mMesh;
+    }
+
+protected:
+    aiMesh *mMesh = nullptr;
+};
+
+TEST_F(utPackIndicesProcess, packMeshTest) {
+    PackIndicesProcess::PackMesh(mMesh, true);
+
+    ASSERT_TRUE(mMesh->HasIndexBuffer());
+    ASSERT_EQ(11u, mMesh->mNumIndices);
+    ASSERT_NE(nullptr, mMesh->mIndices16);
+    unsigned int offset = 0;
+    for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+        const aiFace &face = mMesh->mFaces[i];
+        EXPECT_EQ(mMesh->mIndices + offset, face.mIndices);
+        for (unsigned int a = 0; a < face.mNumIndices; ++a) {
+            EXPECT_EQ((i + a) % 4, face.mIndices[a]);
+            EXPECT_EQ(face.mIndices[a], mMesh->mIndices16[offset + a]);
+        }
+        offset += face.mNumIndices;
+    }
+
+    // packing again must rebuild the buffer
+    PackIndicesProcess::PackMesh(mMesh, false);
+    ASSERT_TRUE(mMesh->HasIndexBuffer());
+    EXPECT_EQ(nullptr, mMesh->mIndices16);
+    EXPECT_EQ(mMesh->mIndices + 7, mMesh->mFaces[2].mIndices);
+}
+
+TEST_F(utPackIndicesProcess, copyAndReleaseTest) {
+    PackIndicesProcess::PackMesh(mMesh, false);
+
+    aiMesh *copy = nullptr;
+    SceneCombiner::Copy(&copy, mMesh);
+    ASSERT_NE(nullptr, copy);
+    ASSERT_TRUE(copy->HasIndexBuffer());
+    EXPECT_NE(mMesh->mIndices, copy->mIndices);
+    EXPECT_EQ(copy->mIndices + 4, copy->mFaces[1].mIndices);
+    EXPECT_EQ(0, memcmp(mMesh->mIndices, copy->mIndices, 11 * sizeof(unsigned int)));
+
+    copy->ReleaseIndexBuffer();
+    EXPECT_FALSE(copy->HasIndexBuffer());
+    EXPECT_EQ(0u, copy->mNumIndices);
+    for (unsigned int i = 0; i < copy->mNumFaces; ++i) {
+        EXPECT_EQ(mMesh->mFaces[i], copy->mFaces[i]);
+        EXPECT_NE(mMesh->mFaces[i].mIndices, copy->mFaces[i].mIndices);
+    }
+    delete copy;
+}
+
+TEST_F(utPackIndicesProcess, emptyFaceTest) {
+    // an empty face at the end would otherwise point past the buffer
+    aiFace &last = mMesh->mFaces[3];
+    delete[] last.mIndices;
+    last.mIndices = nullptr;
+    last.mNumIndices = 0;
+
+    PackIndicesProcess::PackMesh(mMesh, false);
+    ASSERT_TRUE(mMesh->HasIndexBuffer());
+    ASSERT_EQ(10u, mMesh->mNumIndices);
+    EXPECT_EQ(nullptr, mMesh->mFaces[3].mIndices);
+
+    aiMesh *copy = nullptr;
+    SceneCombiner::Copy(&copy, mMesh);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_EQ(nullptr, copy->mFaces[3].mIndices);
+
+    copy->ReleaseIndexBuffer();
+    EXPECT_EQ(nullptr, copy->mFaces[3].mIndices);
+    EXPECT_EQ(mMesh->mFaces[2], copy->mFaces[2]);
+    delete copy;
+}
+
+TEST_F(utPackIndicesProcess, importTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_PI_ENABLE, true);
+    importer.SetPropertyBool(AI_CONFIG_PP_PI_16BIT, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        ASSERT_TRUE(mesh->HasIndexBuffer());
+        EXPECT_EQ(mesh->mNumFaces * 3, mesh->mNumIndices);
+        EXPECT_EQ(mesh->mIndices, mesh->mFaces[0].mIndices);
+        EXPECT_NE(nullptr, mesh->mIndices16);
+    }
+}
@@ -0,0 +1,143 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/QuantizeVerticesProcess.h"
+#include <assimp/scene.h>
+
+#include <cmath>
+#include <memory>
+
+using namespace Assimp;
+
+class utQuantizeVerticesProcess : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utQuantizeVerticesProcess, halfFloatTest) {
+    EXPECT_EQ(0x0000, QuantizeVerticesProcess::FloatToHalf(0.0f));
+    EXPECT_EQ(0x3c00, QuantizeVerticesProcess::FloatToHalf(1.0f));
+    EXPECT_EQ(0xc000, QuantizeVerticesProcess::FloatToHalf(-2.0f));
+    EXPECT_EQ(0x7bff, QuantizeVerticesProcess::FloatToHalf(65504.0f));
+    EXPECT_EQ(0x7c00, QuantizeVerticesProcess::FloatToHalf(70000.0f));
+    EXPECT_EQ(0x0001, QuantizeVerticesProcess::FloatToHalf(std::ldexp(1.0f, -24)));
+    EXPECT_EQ(0x0400, QuantizeVerticesProcess::FloatToHalf(std::ldexp(1.0f, -14)));
+    EXPECT_EQ(-2.0f, QuantizeVerticesProcess::HalfToFloat(0xc000));
+    EXPECT_EQ(std::ldexp(1.0f, -24), QuantizeVerticesProcess::HalfToFloat(0x0001));
+
+    for (float v = -4.0f; v < 4.0f; v += 0.0137f) {
+        const float decoded = QuantizeVerticesProcess::HalfToFloat(QuantizeVerticesProcess::FloatToHalf(v));
+        EXPECT_LE(std::fabs(decoded - v), std::max(std::fabs(v), std::ldexp(1.0f, -14)) * std::ldexp(1.0f, -11));
+    }
+}
+
+TEST_F(utQuantizeVerticesProcess, octahedralTest) {
+    short q[2];
+    for (int a = 0; a <= 36; ++a) {
+        for (int b = 0; b < 72; ++b) {
+            const float theta = a * 3.14159265f / 36, phi = b * 3.14159265f / 36;
+            const aiVector3D dir(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+            QuantizeVerticesProcess::EncodeOctahedral(dir * 3.0f, q);
+            const aiVector3D decoded = QuantizeVerticesProcess::DecodeOctahedral(q);
+            EXPECT_NEAR(1.0f, decoded.Length(), 1e-5f);
+            EXPECT_GT(decoded * dir, 0.99999f);
+        }
+    }
+
+    QuantizeVerticesProcess::EncodeOctahedral(aiVector3D(), q);
+    EXPECT_EQ(aiVector3D(0, 0, 1), QuantizeVerticesProcess::DecodeOctahedral(q));
+}
+
+TEST_F(utQuantizeVerticesProcess, quantizeMeshTest) {
+    std::unique_ptr<aiMesh> mesh(new aiMesh());
+    mesh->mNumVertices = 100;
+    mesh->mVertices = new aiVector3D[100];
+    mesh->mNormals = new aiVector3D[100];
+    mesh->mTextureCoords[0] = new aiVector3D[100];
+    mesh->mNumUVComponents[0] = 2;
+    mesh->mColors[0] = new aiColor4D[100];
+    for (unsigned int a = 0; a < 100; ++a) {
+        const float f = static_cast<float>(a);
+        mesh->mVertices[a] = aiVector3D(f * 0.37f - 10.0f, std::sin(f) * 5.0f, 2.0f);
+        mesh->mNormals[a] = aiVector3D(std::cos(f), std::sin(f), f / 50.0f - 1.0f).Normalize();
+        mesh->mTextureCoords[0][a] = aiVector3D(f / 99.0f, 1.0f - f / 33.0f, 0.0f);
+        mesh->mColors[0][a] = aiColor4D(f / 99.0f, 0.5f, 1.2f, 1.0f);
+    }
+
+    for (bool unorm : { false, true }) {
+        std::unique_ptr<aiQuantizedVertices> q(QuantizeVerticesProcess::Quantize(mesh.get(), unorm));
+        ASSERT_EQ(100u, q->mNumVertices);
+        ASSERT_NE(nullptr, q->mPositions);
+        ASSERT_NE(nullptr, q->mNormals);
+        EXPECT_EQ(nullptr, q->mTangents);
+        ASSERT_NE(nullptr, q->mTextureCoords[0]);
+        EXPECT_EQ(nullptr, q->mTextureCoords[1]);
+        ASSERT_NE(nullptr, q->mColors[0]);
+        EXPECT_EQ(2u, q->mNumUVComponents[0]);
+        EXPECT_EQ(unorm ? aiQuantizedUVFormat_UNORM16 : aiQuantizedUVFormat_HALF, q->mTextureCoordsFormat);
+
+        // the errors are reported and within the precision of the formats
+        EXPECT_EQ(aiVector3D(-10.0f, -5.0f, 2.0f).x, q->mPositionOffset.x);
+        EXPECT_EQ(0.0f, q->mPositionScale.z);
+        EXPECT_LE(q->mPositionError, q->mPositionScale.x / 65535.0f);
+        EXPECT_LT(q->mNormalError, 1e-4f);
+        EXPECT_LT(q->mTextureCoordsError, unorm ? 1e-4f : 1e-3f);
+        EXPECT_NEAR(0.2f, q->mColorError, 1e-5f);
+
+        ai_real positionError = 0, uvError = 0;
+        for (unsigned int a = 0; a < 100; ++a) {
+            for (unsigned int c = 0; c < 3; ++c) {
+                const ai_real decoded = q->mPositionOffset[c] + q->mPositionScale[c] * (q->mPositions[a * 3 + c] / ai_real(65535));
+                positionError = std::max(positionError, std::fabs(decoded - mesh->mVertices[a][c]));
+            }
+            EXPECT_GT(QuantizeVerticesProcess::DecodeOctahedral(q->mNormals + a * 2) * mesh->mNormals[a], 0.99999f);
+            for (unsigned int c = 0; c < 2; ++c) {
+                const unsigned short v = q->mTextureCoords[0][a * 2 + c];
+                const ai_real decoded = unorm ? q->mTextureCoordsOffset[0][c] + q->mTextureCoordsScale[0][c] * (v / ai_real(65535))
+                                              : QuantizeVerticesProcess::HalfToFloat(v);
+                uvError = std::max(uvError, std::fabs(decoded - mesh->mTextureCoords[0][a][c]));
+            }
+            EXPECT_EQ(255, q->mColors[0][a * 4 + 2]);
+        }
+        EXPECT_NEAR(q->mPositionError, positionError, 1e-5f);
+        EXPECT_NEAR(q->mTextureCoordsError, uvError, 1e-6f);
+    }
+}
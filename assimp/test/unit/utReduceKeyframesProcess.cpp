@@ -0,0 +1,179 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/ReduceKeyframesProcess.h"
+#include <assimp/AnimationEvaluator.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class utReduceKeyframesProcess : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utReduceKeyframesProcess, linearAndConstantTest) {
+    aiNodeAnim channel;
+    // moves along x for 50 ticks and stays there for 50 more
+    channel.mNumPositionKeys = 101;
+    channel.mPositionKeys = new aiVectorKey[101];
+    for (unsigned int i = 0; i <= 100; ++i) {
+        channel.mPositionKeys[i] = aiVectorKey(i, aiVector3D(ai_real(std::min(i, 50u)), 1, 2));
+    }
+    // a constant rotation
+    channel.mNumRotationKeys = 11;
+    channel.mRotationKeys = new aiQuatKey[11];
+    for (unsigned int i = 0; i <= 10; ++i) {
+        channel.mRotationKeys[i] = aiQuatKey(i * 10, aiQuaternion(aiVector3D(0, 1, 0), 0.5f));
+    }
+    // a scaling jittering more than the tolerance
+    channel.mNumScalingKeys = 10;
+    channel.mScalingKeys = new aiVectorKey[10];
+    for (unsigned int i = 0; i < 10; ++i) {
+        channel.mScalingKeys[i] = aiVectorKey(i, aiVector3D(1, 1, 1 + (i & 1) * ai_real(0.001)));
+    }
+
+    EXPECT_EQ(98u + 10u, ReduceKeyframesProcess::ReduceChannel(&channel, 1e-4f, 1e-4f, 1e-4f));
+    ASSERT_EQ(3u, channel.mNumPositionKeys);
+    EXPECT_EQ(0.0, channel.mPositionKeys[0].mTime);
+    EXPECT_EQ(50.0, channel.mPositionKeys[1].mTime);
+    EXPECT_EQ(100.0, channel.mPositionKeys[2].mTime);
+    EXPECT_EQ(aiVector3D(50, 1, 2), channel.mPositionKeys[2].mValue);
+    ASSERT_EQ(1u, channel.mNumRotationKeys);
+    EXPECT_EQ(aiQuaternion(aiVector3D(0, 1, 0), 0.5f), channel.mRotationKeys[0].mValue);
+    EXPECT_EQ(10u, channel.mNumScalingKeys);
+
+    // with a larger tolerance the jitter goes away as well
+    EXPECT_EQ(9u, ReduceKeyframesProcess::ReduceChannel(&channel, 1e-4f, 1e-4f, 1e-2f));
+    EXPECT_EQ(1u, channel.mNumScalingKeys);
+}
+
+TEST_F(utReduceKeyframesProcess, longTrackTest) {
+    aiNodeAnim channel;
+    // a long linear motion is split into spans of bounded length
+    channel.mNumPositionKeys = 200;
+    channel.mPositionKeys = new aiVectorKey[200];
+    for (unsigned int i = 0; i < 200; ++i) {
+        channel.mPositionKeys[i] = aiVectorKey(i, aiVector3D(ai_real(i), 0, 0));
+    }
+    // while a long constant track still collapses to one key
+    channel.mNumScalingKeys = 1000;
+    channel.mScalingKeys = new aiVectorKey[1000];
+    for (unsigned int i = 0; i < 1000; ++i) {
+        channel.mScalingKeys[i] = aiVectorKey(i, aiVector3D(2, 2, 2));
+    }
+
+    ReduceKeyframesProcess::ReduceChannel(&channel, 1e-4f, 1e-4f, 1e-4f);
+    ASSERT_EQ(5u, channel.mNumPositionKeys);
+    EXPECT_EQ(64.0, channel.mPositionKeys[1].mTime);
+    EXPECT_EQ(199.0, channel.mPositionKeys[4].mTime);
+    EXPECT_EQ(1u, channel.mNumScalingKeys);
+}
+
+TEST_F(utReduceKeyframesProcess, rotationAndStepTest) {
+    aiNodeAnim channel;
+    // a quarter turn sampled from a slerp only needs its ends
+    const aiQuaternion from, to(aiVector3D(0, 0, 1), ai_real(AI_MATH_HALF_PI));
+    channel.mNumRotationKeys = 11;
+    channel.mRotationKeys = new aiQuatKey[11];
+    for (unsigned int i = 0; i <= 10; ++i) {
+        aiQuaternion::Interpolate(channel.mRotationKeys[i].mValue, from, to, i / ai_real(10.0));
+        channel.mRotationKeys[i].mTime = i;
+    }
+    // step keys hold their value, so only the changes are kept besides the end
+    const ai_real steps[5] = { 0, 0, 5, 5, 5 };
+    channel.mNumPositionKeys = 5;
+    channel.mPositionKeys = new aiVectorKey[5];
+    for (unsigned int i = 0; i < 5; ++i) {
+        channel.mPositionKeys[i] = aiVectorKey(i, aiVector3D(steps[i], 0, 0));
+        channel.mPositionKeys[i].mInterpolation = aiAnimInterpolation_Step;
+    }
+
+    ReduceKeyframesProcess::ReduceChannel(&channel, 1e-4f, 1e-4f, 1e-4f);
+    EXPECT_EQ(2u, channel.mNumRotationKeys);
+    ASSERT_EQ(3u, channel.mNumPositionKeys);
+    EXPECT_EQ(2.0, channel.mPositionKeys[1].mTime);
+    EXPECT_EQ(4.0, channel.mPositionKeys[2].mTime);
+}
+
+TEST_F(utReduceKeyframesProcess, importTest) {
+    Importer reference;
+    const aiScene *plain = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/BVH/01_01.bvh", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, plain);
+    ASSERT_GT(plain->mNumAnimations, 0u);
+
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_RK_ENABLE, true);
+    importer.SetPropertyFloat(AI_CONFIG_PP_RK_POSITION_ERROR, 1e-3f);
+    importer.SetPropertyFloat(AI_CONFIG_PP_RK_ROTATION_ERROR, 1e-3f);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/BVH/01_01.bvh", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    size_t keysIn = 0, keysOut = 0;
+    const aiAnimation *original = plain->mAnimations[0], *reduced = scene->mAnimations[0];
+    ASSERT_EQ(original->mNumChannels, reduced->mNumChannels);
+    for (unsigned int c = 0; c < original->mNumChannels; ++c) {
+        keysIn += original->mChannels[c]->mNumPositionKeys + original->mChannels[c]->mNumRotationKeys;
+        keysOut += reduced->mChannels[c]->mNumPositionKeys + reduced->mChannels[c]->mNumRotationKeys;
+    }
+    EXPECT_LT(keysOut, keysIn);
+
+    // the local transformations stay within the tolerances
+    AnimationEvaluator expected(plain, original), actual(scene, reduced);
+    ASSERT_EQ(expected.GetNumNodes(), actual.GetNumNodes());
+    for (double t = 0; t < original->mDuration; t += 0.37) {
+        expected.EvaluateTicks(t);
+        actual.EvaluateTicks(t);
+        for (unsigned int n = 0; n < expected.GetNumNodes(); ++n) {
+            const aiMatrix4x4 &a = expected.GetLocalTransforms()[n], &b = actual.GetLocalTransforms()[n];
+            for (unsigned int i = 0; i < 3; ++i) {
+                for (unsigned int j = 0; j < 3; ++j) {
+                    ASSERT_NEAR(a[i][j], b[i][j], 2e-3f);
+                }
+                ASSERT_NEAR(a[i][3], b[i][3], 2e-3f);
+            }
+        }
+    }
+}
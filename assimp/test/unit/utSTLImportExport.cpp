@@ -47,6 +47,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
+#include <tuple>
 #include <vector>
 
 using namespace Assimp;
@@ -99,6 +101,29 @@ TEST_F(utSTLImporterExporter, test_with_empty_solid) {
     EXPECT_EQ(nullptr, scene2);
 }
 
+TEST_F(utSTLImporterExporter, importBinaryWeldVertices) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const unsigned int numFaces = scene->mMeshes[0]->mNumFaces;
+    ASSERT_EQ(numFaces * 3, scene->mMeshes[0]->mNumVertices);
+
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, true);
+    scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+    EXPECT_EQ(numFaces, mesh->mNumFaces);
+    EXPECT_LT(mesh->mNumVertices, numFaces * 3);
+    ASSERT_TRUE(mesh->HasNormals());
+
+    // no two vertices share a position
+    std::vector<aiVector3D> positions(mesh->mVertices, mesh->mVertices + mesh->mNumVertices);
+    std::sort(positions.begin(), positions.end(), [](const aiVector3D &a, const aiVector3D &b) {
+        return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+    });
+    EXPECT_EQ(positions.end(), std::adjacent_find(positions.begin(), positions.end()));
+}
+
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
 TEST_F(utSTLImporterExporter, exporterTest) {
@@ -60,3 +60,84 @@ TEST_F( utSimd, SSE2SupportedTest ) {
         std::cout << "Not supported" << std::endl;
     }
 }
+
+namespace {
+
+std::vector<aiVector3D> MakeVectors(unsigned int count) {
+    std::vector<aiVector3D> vecs(count);
+    for (unsigned int i = 0; i < count; ++i) {
+        vecs[i] = aiVector3D(std::sin(i * 1.7f) * 3.f, std::cos(i * 0.3f) - 0.5f, i * 0.25f - 2.f);
+    }
+    return vecs;
+}
+
+} // namespace
+
+TEST_F(utSimd, transformPointsTest) {
+    aiMatrix4x4 mat;
+    aiMatrix4x4::Rotation(0.7f, aiVector3D(1, 2, 3).Normalize(), mat);
+    mat = mat * aiMatrix4x4(aiVector3D(2, 3, 0.5f), aiQuaternion(), aiVector3D(1, -4, 9));
+
+    // cover the vector blocks and all tail lengths, in and out of place
+    for (unsigned int count = 0; count < 14; ++count) {
+        const std::vector<aiVector3D> in = MakeVectors(count);
+        std::vector<aiVector3D> out(count), inPlace = in;
+        TransformPoints(mat, in.data(), out.data(), count);
+        TransformPoints(mat, inPlace.data(), inPlace.data(), count);
+        for (unsigned int i = 0; i < count; ++i) {
+            EXPECT_EQ(mat * in[i], out[i]);
+            EXPECT_EQ(mat * in[i], inPlace[i]);
+        }
+    }
+}
+
+TEST_F(utSimd, transformDirectionsTest) {
+    const aiMatrix3x3 mat = aiMatrix3x3(1, 2, 0, -1, 0.5f, 3, 0, 4, 1).Inverse().Transpose();
+    for (unsigned int count = 0; count < 14; ++count) {
+        std::vector<aiVector3D> in = MakeVectors(count);
+        if (count > 5) {
+            in[5] = aiVector3D();
+        }
+        std::vector<aiVector3D> out(count);
+        TransformDirections(mat, in.data(), out.data(), count);
+        for (unsigned int i = 0; i < count; ++i) {
+            aiVector3D expected = mat * in[i];
+            EXPECT_EQ(expected.Normalize(), out[i]);
+        }
+    }
+}
+
+TEST_F(utSimd, scaleVectorsTest) {
+    const aiVector3D factor(-1, -1, 1);
+    for (unsigned int count = 0; count < 14; ++count) {
+        const std::vector<aiVector3D> in = MakeVectors(count);
+        std::vector<aiVector3D> vecs = in;
+        ScaleVectors(vecs.data(), count, factor);
+        for (unsigned int i = 0; i < count; ++i) {
+            EXPECT_EQ(aiVector3D(-in[i].x, -in[i].y, in[i].z), vecs[i]);
+        }
+    }
+}
+
+TEST_F(utSimd, minMaxVectorsTest) {
+    for (unsigned int count = 1; count < 14; ++count) {
+        std::vector<aiVector3D> vecs = MakeVectors(count);
+        vecs[count / 2].y = std::numeric_limits<float>::quiet_NaN();
+
+        aiVector3D min(1e10f, 1e10f, 1e10f), max(-1e10f, -1e10f, -1e10f);
+        aiVector3D expectedMin = min, expectedMax = max;
+        for (const aiVector3D &v : vecs) {
+            for (unsigned int k = 0; k < 3; ++k) {
+                if (v[k] < expectedMin[k]) {
+                    expectedMin[k] = v[k];
+                }
+                if (v[k] > expectedMax[k]) {
+                    expectedMax[k] = v[k];
+                }
+            }
+        }
+        MinMaxVectors(vecs.data(), count, min, max);
+        EXPECT_EQ(expectedMin, min);
+        EXPECT_EQ(expectedMax, max);
+    }
+}
@@ -44,6 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "PostProcessing/TriangulateProcess.h"
 
+#include <memory>
+
 using namespace std;
 using namespace Assimp;
 
@@ -135,3 +137,50 @@ TEST_F(TriangulateProcessTest, testTriangulation) {
     // we should have no valid normal vectors now because we aren't a pure polygon mesh
     EXPECT_TRUE(pcMesh->mNormals == nullptr);
 }
+
+TEST_F(TriangulateProcessTest, testConvexAndConcavePolygons) {
+    // a convex octagon in the xz plane and a concave L-shaped hexagon in
+    // the yz plane, both facing along a negative axis
+    std::unique_ptr<aiMesh> mesh(new aiMesh());
+    mesh->mPrimitiveTypes = aiPrimitiveType_POLYGON;
+    mesh->mNumVertices = 14;
+    mesh->mVertices = new aiVector3D[14];
+    for (unsigned int i = 0; i < 8; ++i) {
+        const float angle = i * (float)AI_MATH_TWO_PI / 8;
+        mesh->mVertices[i] = aiVector3D(std::cos(angle), 0.f, std::sin(angle));
+    }
+    const float shape[6][2] = { { 1, 2 }, { 1, 1 }, { 2, 1 }, { 2, 0 }, { 0, 0 }, { 0, 2 } };
+    for (unsigned int i = 0; i < 6; ++i) {
+        mesh->mVertices[8 + i] = aiVector3D(0.f, shape[i][0], shape[i][1]);
+    }
+
+    mesh->mNumFaces = 2;
+    mesh->mFaces = new aiFace[2];
+    for (unsigned int f = 0; f < 2; ++f) {
+        aiFace &face = mesh->mFaces[f];
+        face.mNumIndices = f ? 6 : 8;
+        face.mIndices = new unsigned int[face.mNumIndices];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            face.mIndices[i] = (f ? 8 : 0) + i;
+        }
+    }
+
+    ASSERT_TRUE(piProcess->TriangulateMesh(mesh.get()));
+    ASSERT_EQ(6u + 4u, mesh->mNumFaces);
+
+    // the triangles keep the winding of their polygon and cover its area
+    const aiVector3D normals[2] = { aiVector3D(0, -1, 0), aiVector3D(-1, 0, 0) };
+    const float areas[2] = { 2.f * std::sqrt(2.f), 3.f };
+    for (unsigned int p = 0, f = 0; p < 2; ++p) {
+        float area = 0.f;
+        for (unsigned int end = f + (p ? 4 : 6); f < end; ++f) {
+            const aiFace &face = mesh->mFaces[f];
+            ASSERT_EQ(3u, face.mNumIndices);
+            const aiVector3D &a = mesh->mVertices[face.mIndices[0]];
+            const aiVector3D n = (mesh->mVertices[face.mIndices[1]] - a) ^ (mesh->mVertices[face.mIndices[2]] - a);
+            EXPECT_GT(n * normals[p], 0.f);
+            area += n.Length() * 0.5f;
+        }
+        EXPECT_NEAR(areas[p], area, 1e-4f);
+    }
+}
@@ -44,7 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
-#include <ValidateDataStructure.h>
+#include <assimp/Importer.hpp>
+#include "PostProcessing/ValidateDataStructure.h"
 
 using namespace std;
 using namespace Assimp;
@@ -60,6 +61,13 @@ public:
 protected:
 
 
+    // adds a mesh with a single triangle, which uses the vertex index
+    // 'last' and the given material
+    void AddTriangleMesh(unsigned int last, unsigned int material);
+
+    // runs the step at the given level, returns the error message if any
+    std::string Validate(aiValidationLevel level);
+
     ValidateDSProcess* vds;
     aiScene* scene;
 };
@@ -90,6 +98,78 @@ void ValidateDataStructureTest::TearDown()
 
 
 
+// ------------------------------------------------------------------------------------------------
+void ValidateDataStructureTest::AddTriangleMesh(unsigned int last, unsigned int material)
+{
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mMaterialIndex = material;
+    mesh->mNumVertices = 3;
+    mesh->mVertices = new aiVector3D[3];
+    mesh->mNumFaces = 1;
+    mesh->mFaces = new aiFace[1];
+    mesh->mFaces[0].mNumIndices = 3;
+    mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, last };
+
+    aiMesh **meshes = new aiMesh *[scene->mNumMeshes + 1];
+    std::copy(scene->mMeshes, scene->mMeshes + scene->mNumMeshes, meshes);
+    meshes[scene->mNumMeshes++] = mesh;
+    delete[] scene->mMeshes;
+    scene->mMeshes = meshes;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ValidateDataStructureTest::Validate(aiValidationLevel level)
+{
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_VDS_LEVEL, level);
+    vds->SetupProperties(&importer);
+    try {
+        vds->Execute(scene);
+    } catch (const DeadlyImportError &error) {
+        return error.what();
+    }
+    return std::string();
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, testLevels)
+{
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1]{ new aiMaterial() };
+    AddTriangleMesh(2, 0);
+    AddTriangleMesh(2, 0);
+    EXPECT_EQ("", Validate(aiValidationLevel_FULL));
+
+    // an index out of range is only found by the sweep over the faces
+    scene->mMeshes[1]->mFaces[0].mIndices[2] = 3;
+    EXPECT_EQ("", Validate(aiValidationLevel_STRUCTURE));
+    EXPECT_NE(std::string::npos, Validate(aiValidationLevel_BOUNDS).find("is out of range"));
+    EXPECT_NE(std::string::npos, Validate(aiValidationLevel_FULL).find("is out of range"));
+
+    // a face without indices breaks the layout, which every level checks
+    scene->mMeshes[1]->mFaces[0].mIndices[2] = 0;
+    delete[] scene->mMeshes[0]->mFaces[0].mIndices;
+    scene->mMeshes[0]->mFaces[0].mIndices = nullptr;
+    EXPECT_NE(std::string::npos, Validate(aiValidationLevel_STRUCTURE).find("mIndices is nullptr"));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, testFirstErrorIsReported)
+{
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1]{ new aiMaterial() };
+    for (unsigned int i = 0; i < 16; ++i) {
+        AddTriangleMesh(i == 9 ? 5 : 2, i == 12 ? 1 : 0);
+    }
+
+    // the meshes are validated concurrently, but the error of the first
+    // broken mesh wins
+    for (int run = 0; run < 8; ++run) {
+        EXPECT_NE(std::string::npos, Validate(aiValidationLevel_FULL).find("is out of range"));
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 //Template
 //TEST_F(ScenePreprocessorTest, test)
@@ -195,5 +275,3 @@ void ValidateDataStructureTest::TearDown()
 //965: ReportError("aiString::length is too large (%i, maximum is %lu)",
 //974: ReportError("aiString::data is invalid: the terminal zero is at a wrong offset");
 //979: ReportError("aiString::data is invalid. There is no terminal character");
-}
-